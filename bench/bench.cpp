@@ -0,0 +1,460 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <iostream>
+#include <vector>
+#include <utf8.hpp>
+
+#include "corpus.h"
+
+using utf8::char_t;
+
+namespace {
+
+struct corpus {
+  std::string raw;     // with invalid bytes
+  utf8::string valid;  // `raw` after `parse_lossy`
+  size_t chars;
+  char_t absent;  // needle that makes searches scan everything
+};
+
+auto corpus_of(const bench::script& script) -> const corpus& {
+  static std::map<std::string, corpus> cache;
+  if (auto found = cache.find(script.name); found != cache.end()) {
+    return found->second;
+  }
+
+  auto raw = bench::generate(script, bench::corpus_size(), bench::invalid_ratio());
+  auto valid = utf8::parse_lossy(raw);
+  auto chars = size_t(std::ranges::distance(valid.chars()));
+  auto absent = char_t(utf8::unsafe, script.absent);
+  return cache.emplace(script.name, corpus{std::move(raw), std::move(valid), chars, absent})
+      .first->second;
+}
+
+void report(benchmark::State& state, size_t bytes, size_t chars) {
+  state.SetBytesProcessed(int64_t(state.iterations() * bytes));
+  state.counters["chars"] = benchmark::Counter(double(state.iterations() * chars),
+                                               benchmark::Counter::kIsRate);
+}
+
+using bench_fn = std::function<void(benchmark::State&, const corpus&)>;
+
+const std::vector<std::pair<const char*, bench_fn>> BENCHES = {
+    {"validate",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::validate(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"is_utf8",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::is_utf8(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"parse_lossy",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::parse_lossy(text.raw));
+       }
+       report(state, text.raw.size(), text.chars);
+     }},
+    {"to_utf16",
+     [](auto& state, auto& text) {
+       std::u16string place(utf8::utf16_length_from_utf8(text.valid), u'\0');
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::to_utf16(text.valid, place.data()));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"from_utf16",
+     [](auto& state, auto& text) {
+       auto units = utf8::to_utf16(text.valid);
+       std::string place(utf8::utf8_length_from_utf16(units), '\0');
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::from_utf16(units, place.data()));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"encode_all",
+     [](auto& state, auto& text) {
+       std::vector<char_t> chars(text.valid.chars().begin(), text.valid.chars().end());
+       std::string place(text.valid.size(), '\0');
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::encode_all(chars, place.data()));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"decode_all",
+     [](auto& state, auto& text) {
+       std::vector<char_t> place(text.chars, char_t('\0'));
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::decode_all(text.valid, place));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"chars",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         std::uint32_t sum = 0;
+         for (char_t ch : text.valid.chars()) {
+           sum += std::uint32_t(ch);
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"chars_table",
+     [](auto& state, auto& text) {
+       auto chars = utf8::basic_chars_view<utf8::table_decoder>(utf8::string_view(text.valid));
+       for (auto _ : state) {
+         std::uint32_t sum = 0;
+         for (char_t ch : chars) {
+           sum += std::uint32_t(ch);
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"chars_blocks",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         std::uint32_t sum = 0;
+         for (auto block : text.valid.chars().blocks()) {
+           for (char_t ch : block) {
+             sum += std::uint32_t(ch);
+           }
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"parse_lossy_chars",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         std::uint32_t sum = 0;
+         auto valid = utf8::parse_lossy(text.raw);
+         for (char_t ch : valid.chars()) {
+           sum += std::uint32_t(ch);
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.raw.size(), text.chars);
+     }},
+    {"chars_lossy",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         std::uint32_t sum = 0;
+         for (char_t ch : utf8::chars_lossy(text.raw)) {
+           sum += std::uint32_t(ch);
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.raw.size(), text.chars);
+     }},
+    {"char_indices",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         size_t sum = 0;
+         for (auto [idx, ch] : text.valid.char_indices()) {
+           sum += idx ^ std::uint32_t(ch);
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"count_chars",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::count_chars(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"graphemes",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         size_t bytes = 0;
+         for (auto cluster : text.valid.graphemes()) {
+           bytes += cluster.size();
+         }
+         benchmark::DoNotOptimize(bytes);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"count_graphemes",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::count_graphemes(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"words",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         size_t count = 0;
+         for (auto word : text.valid.words()) {
+           count += word.size() > 1;
+         }
+         benchmark::DoNotOptimize(count);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"sentences",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(std::ranges::distance(text.valid.sentences()));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"line_breaks",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         size_t mandatory = 0;
+         for (auto brk : text.valid.line_break_opportunities()) {
+           mandatory += brk.mandatory;
+         }
+         benchmark::DoNotOptimize(mandatory);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"split",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(std::ranges::distance(text.valid.split(' ')));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"lines",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(std::ranges::distance(text.valid.lines()));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"split_whitespace",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(std::ranges::distance(text.valid.split_whitespace()));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"indexed_char_at",
+     [](auto& state, auto& text) {
+       // index once, then jump to every 97th char
+       for (auto _ : state) {
+         utf8::indexed_string_view indexed(text.valid);
+         std::uint32_t sum = 0;
+         for (size_t n = 0; n < indexed.char_count(); n += 97) {
+           sum += std::uint32_t(indexed.char_at(n));
+         }
+         benchmark::DoNotOptimize(sum);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"find_char",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(text.valid.find(text.absent));
+         benchmark::DoNotOptimize(text.valid.rfind(text.absent));
+       }
+       report(state, 2 * text.valid.size(), 2 * text.chars);
+     }},
+    {"count_char",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(text.valid.count(text.absent));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"find_str",
+     [](auto& state, auto& text) {
+       utf8::string str;
+       str.push_back('a');
+       str.push_back(text.absent);
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(text.valid.find(str));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"find_searcher",
+     [](auto& state, auto& text) {
+       utf8::string str;
+       str.push_back('a');
+       str.push_back(text.absent);
+       auto needle = utf8::searcher(str);
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(text.valid.find(needle));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"find_first_of",
+     [](auto& state, auto& text) {
+       auto set = utf8::string(utf8::string_view("!?#@%&*"));
+       set.push_back(text.absent);
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(text.valid.find_first_of(set));
+         benchmark::DoNotOptimize(text.valid.find_last_not_of(set));
+       }
+       report(state, 2 * text.valid.size(), 2 * text.chars);
+     }},
+    {"char_set",
+     [](auto& state, auto& text) {
+       // a sanitizer-like set of ascii punctuation and controls, compiled once
+       auto set = utf8::char_set("<>&\"'`\\{}[]|^~$#@%;=\x01\x02\x03\x04\x05\x06\x07\x08\x7F");
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(text.valid.find_first_of(set));
+         benchmark::DoNotOptimize(text.valid.find_last_of(set));
+       }
+       report(state, 2 * text.valid.size(), 2 * text.chars);
+     }},
+    {"multi_search_few",
+     [](auto& state, auto& text) {
+       std::vector<utf8::string> patterns(4);
+       for (size_t i = 0; i < patterns.size(); i++) {
+         patterns[i].push_back(char_t(char('a' + i)));
+         patterns[i].push_back(text.absent);
+       }
+       auto searcher = utf8::multi_searcher(patterns);
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(std::ranges::distance(searcher.matches(text.valid)));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"multi_search_many",
+     [](auto& state, auto& text) {
+       // blocked terms that start like the text but never occur in it
+       std::vector<utf8::string> patterns;
+       auto chars = utf8::string_view(text.valid).chars();
+       size_t skip = 0;
+       for (auto iter = chars.begin(); patterns.size() < 2000 && iter != chars.end(); iter++) {
+         if (skip++ % 37 != 0) {
+           continue;
+         }
+         auto& term = patterns.emplace_back();
+         for (auto ch = iter; ch != chars.end() && term.size() < 6; ch++) {
+           term.push_back(*ch);
+         }
+         term.push_back(text.absent);
+       }
+       auto searcher = utf8::multi_searcher(patterns);
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(std::ranges::distance(searcher.matches(text.valid)));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"to_lower",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::to_lower(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"to_upper",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::to_upper(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"do_lower",
+     [](auto& state, auto& text) {
+       auto place = text.valid;
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::do_lower(place));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"do_upper",
+     [](auto& state, auto& text) {
+       auto place = text.valid;
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::do_upper(place));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"eq_icase",
+     [](auto& state, auto& text) {
+       // chars that expand (`ß` into `SS`) stay as they are, so that the strings compare equal
+       utf8::string upper;
+       for (auto ch : text.valid.chars()) {
+         auto mapped = utf8::to_upper(ch);
+         upper.push_back(mapped.size() == 1 ? *mapped.begin() : ch);
+       }
+       if (not utf8::eq_icase(text.valid, upper)) {
+         state.SkipWithError("the operands differ");
+       }
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::eq_icase(text.valid, upper));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"find_icase",
+     [](auto& state, auto& text) {
+       utf8::string str;
+       str.push_back('A');
+       str.push_back(text.absent);
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::find_icase(text.valid, str));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"icase_hash",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         benchmark::DoNotOptimize(utf8::icase_hash{}(text.valid));
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"push_back",
+     [](auto& state, auto& text) {
+       for (auto _ : state) {
+         utf8::string place;
+         for (char_t ch : text.valid.chars()) {
+           place.push_back(ch);
+         }
+         benchmark::DoNotOptimize(place);
+       }
+       report(state, text.valid.size(), text.chars);
+     }},
+    {"insert_erase",
+     [](auto& state, auto& text) {
+       // edits near the beginning of a 64 KiB prefix, the worst case for moving bytes
+       auto len = std::min<size_t>(text.valid.size(), 1 << 16);
+       while (not text.valid.is_boundary(len)) {
+         len--;
+       }
+
+       auto place = utf8::string(text.valid.substr(0, len));
+       auto ch = text.absent;
+       for (auto _ : state) {
+         place.insert(0, ch);
+         place.erase(0, ch.size_utf8());
+       }
+       report(state, 2 * len, 2);
+     }},
+};
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  benchmark::Initialize(&argc, argv);
+
+  for (const auto& script : bench::scripts()) {
+    for (const auto& [name, fn] : BENCHES) {
+      auto title = std::string(name) + "/" + script.name;
+      benchmark::RegisterBenchmark(title.c_str(), [&script, fn = fn](benchmark::State& state) {
+        fn(state, corpus_of(script));
+      });
+    }
+  }
+
+  std::cerr << "corpus: " << bench::corpus_size() << " bytes, invalid ratio "
+            << bench::invalid_ratio() << "\n";
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utf8.hpp>
+#include <vector>
+
+namespace bench {
+
+struct script {
+  const char* name;
+  // code point ranges of "letters" and the probability to take one instead of ascii
+  std::vector<std::pair<char32_t, char32_t>> ranges;
+  double share;
+  char32_t absent;  // same width as the letters, but never generated
+};
+
+inline auto scripts() -> const std::vector<script>& {
+  static const std::vector<script> all = {
+      {"ascii", {}, 0.0, U'!'},
+      {"latin1", {{0xC0, 0xFF}}, 0.3, U'¿'},
+      {"cyrillic", {{0x410, 0x44F}}, 1.0, U'Ё'},
+      {"cjk", {{0x4E00, 0x9FFF}}, 1.0, U'あ'},
+      {"emoji", {{0x1F300, 0x1F5FF}, {0x1F600, 0x1F64F}}, 1.0, U'🚀'},
+      // every width in random order, the worst case for branchy decoding
+      {"mixed", {{0xC0, 0xFF}, {0x410, 0x44F}, {0x4E00, 0x9FFF}, {0x1F600, 0x1F64F}}, 0.7, U'あ'},
+  };
+  return all;
+}
+
+inline auto env(const char* name, double fallback) -> double {
+  auto value = std::getenv(name);
+  return value ? std::atof(value) : fallback;
+}
+
+// `UTF8_BENCH_SIZE` - corpus size in bytes
+inline auto corpus_size() -> size_t {
+  return size_t(env("UTF8_BENCH_SIZE", 1 << 20));
+}
+
+// `UTF8_BENCH_INVALID` - share of random invalid bytes in `raw` corpora
+inline auto invalid_ratio() -> double {
+  return env("UTF8_BENCH_INVALID", 0.001);
+}
+
+inline void append(std::string& out, char32_t code) {
+  char place[4] = {};
+  auto encoded = utf8::char_t(utf8::unsafe, code).encode_utf8(place);
+  out.append(std::string_view(encoded));
+}
+
+// words of `script` letters with ascii spaces, punctuation and line breaks
+inline auto generate(const script& script, size_t size, double invalid = 0.0) -> std::string {
+  std::mt19937 rng(2023);
+  std::bernoulli_distribution is_letter(script.share), is_invalid(invalid), is_newline(1.0 / 12);
+  std::uniform_int_distribution<size_t> range(0, std::max<size_t>(script.ranges.size(), 1) - 1);
+  std::uniform_int_distribution<int> ascii('a', 'z'), word(1, 9), byte(0x80, 0xFF);
+
+  std::string out;
+  out.reserve(size + 8);
+  while (out.size() < size) {
+    for (auto n = word(rng); n > 0; n--) {
+      if (is_invalid(rng)) {
+        out.push_back(char(byte(rng)));
+      } else if (not script.ranges.empty() && is_letter(rng)) {
+        auto [first, last] = script.ranges[range(rng)];
+        // `char32_t` is not an IntType the distributions accept
+        append(out, char32_t(std::uniform_int_distribution<std::uint32_t>(first, last)(rng)));
+      } else {
+        out.push_back(char(ascii(rng)));
+      }
+    }
+    out.push_back(is_newline(rng) ? '\n' : ' ');
+  }
+  return out;
+}
+
+}  // namespace bench
@@ -72,10 +72,19 @@ struct basic_string {
   FROM_STRING_VIEW(max_size)
   FROM_STRING_VIEW(find)
   FROM_STRING_VIEW(rfind)
+  FROM_STRING_VIEW(count)
+  FROM_STRING_VIEW(find_all)
   FROM_STRING_VIEW(is_boundary)
   FROM_STRING_VIEW(substr)
   FROM_STRING_VIEW(chars)
   FROM_STRING_VIEW(char_indices)
+  FROM_STRING_VIEW(graphemes)
+  FROM_STRING_VIEW(words)
+  FROM_STRING_VIEW(sentences)
+  FROM_STRING_VIEW(line_break_opportunities)
+  FROM_STRING_VIEW(split)
+  FROM_STRING_VIEW(lines)
+  FROM_STRING_VIEW(split_whitespace)
   FROM_STRING_VIEW(bytes)
   FROM_STRING_VIEW(find_first_of)
   FROM_STRING_VIEW(find_first_not_of)
@@ -252,35 +261,113 @@ constexpr auto parse(std::string_view str) -> string_view {
   }
 }
 
+inline auto parse(std::string_view str, size_t threads) -> string_view {
+  if (auto error = validate(str, threads)) {
+    throw utf8_error(*error);
+  } else {
+    return {noexport::unsafe, str};
+  }
+}
+
 constexpr auto parse(noexport::unsafe_t unsafe, std::string_view str) -> string_view {
   return {unsafe, str};
 }
 
+namespace noexport {
+constexpr string_view REPLACEMENT = "\uFFFD";
+
+// passes valid runs and replacements to `append`, every byte is validated once
+constexpr void lossy_pieces(std::string_view str, auto&& append) {
+  while (auto error = validate(str)) {
+    auto [valid_to, error_len] = *error;
+
+    append(str.substr(0, valid_to));
+    append(std::string_view(REPLACEMENT));
+    if (not error_len) {
+      return;
+    }
+    str = str.substr(valid_to + *error_len);
+  }
+  append(str);
+}
+}  // namespace noexport
+
 constexpr auto parse_lossy(std::string_view str) -> string {
   string place;
+  place.reserve(str.size());
 
-  while (true) {
-    // fixme: extract to char or string_view constant
-    constexpr string_view replacement = "\uFFFD";
+  noexport::lossy_pieces(str, [&](std::string_view piece) { place._inner.append(piece); });
+  return place;
+}
 
-    if (auto error = validate(str)) {
-      auto [valid_to, error_len] = *error;
-      auto [valid, tail] = std::pair{str.substr(0, valid_to), str.substr(valid_to)};
+/// writes the repaired bytes to `out` (up to 3 bytes per input byte), no allocations
+template <std::output_iterator<char> Out>
+constexpr auto parse_lossy(std::string_view str, Out out) -> Out {
+  noexport::lossy_pieces(str, [&](std::string_view piece) {
+    out = std::ranges::copy(piece, std::move(out)).out;
+  });
+  return out;
+}
 
-      place.append(string_view(noexport::unsafe, valid));
-      place.append(replacement);
+namespace noexport {
+// size of `str` after the repair
+constexpr auto lossy_size(std::string_view str) -> size_t {
+  size_t size = 0;
+  lossy_pieces(str, [&](std::string_view piece) { size += piece.size(); });
+  return size;
+}
 
-      if (error_len) {
-        str = tail.substr(*error_len);
-      } else {
-        return place;
-      }
-    } else {
-      place.append(string_view(noexport::unsafe, str));
-      return place;
+struct compacted {
+  size_t write;  // repaired bytes at the beginning of the buffer
+  size_t read;   // where the rest starts if U+FFFD did not fit (or the end)
+};
+
+// repairs the bytes of `place` from `read` on into its beginning, until U+FFFD is longer than the
+// invalid bytes it replaces plus the room left before `read`
+constexpr auto lossy_compact(std::span<char> place, size_t read = 0) -> compacted {
+  using traits = std::string::traits_type;
+  auto replacement = std::string_view(REPLACEMENT);
+
+  size_t write = 0;
+  while (auto error = validate({place.data() + read, place.size() - read})) {
+    auto [valid_to, error_len] = *error;
+
+    traits::move(place.data() + write, place.data() + read, valid_to);
+    write += valid_to;
+    read += valid_to;
+
+    auto skip = error_len.value_or(place.size() - read);
+    if (write + replacement.size() > read + skip) {
+      return {write, read};
     }
+    traits::copy(place.data() + write, replacement.data(), replacement.size());
+    write += replacement.size();
+    read += skip;
+  }
+  traits::move(place.data() + write, place.data() + read, place.size() - read);
+  return {write + place.size() - read, place.size()};
+}
+}  // namespace noexport
+
+/// repairs `str` in its own buffer, which grows once to the repaired size if U+FFFD does not fit
+/// in place of invalid bytes
+constexpr auto parse_lossy_in_place(std::string&& str) -> string {
+  using traits = std::string::traits_type;
+  auto place = std::move(str);
+
+  auto [write, read] = noexport::lossy_compact(place);
+  if (read < place.size()) {
+    // U+FFFD replaces 1 to 3 bytes, so with the rest moved to the end of the grown buffer
+    // the repair never overtakes the bytes it has not read yet
+    auto rest = place.size() - read;
+    auto size = write + noexport::lossy_size(std::string_view(place).substr(read));
+    place.resize(size);
+    traits::move(place.data() + size - rest, place.data() + read, rest);
+    noexport::lossy_compact(std::span(place).subspan(write), size - rest - write);
+    write = size;
   }
-  // unreachable
+  place.resize(write);
+  return {noexport::unsafe, std::move(place)};
 }
 
 }  // namespace utf8
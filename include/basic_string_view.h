@@ -10,13 +10,8 @@
 namespace utf8 {
 
 struct char_t;
-
-namespace noexport {
-constexpr auto is_utf8_bound(char8_t ch) noexcept -> bool {
-  // equivalent to: b < 128 || b >= 192
-  return int8_t(ch) >= -0x40;
-}
-}  // namespace noexport
+class char_set;
+class searcher;
 
 #define mutable requires std::same_as<Q, mut>
 #define immutable requires std::same_as<Q, immut>
@@ -64,6 +59,14 @@ class basic_string_view {
 
   [[nodiscard("iterators are lazy")]] constexpr auto char_indices() const noexcept;
 
+  [[nodiscard("iterators are lazy")]] constexpr auto graphemes() const noexcept;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto words() const noexcept;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto sentences() const noexcept;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto line_break_opportunities() const noexcept;
+
   [[nodiscard("iterators are lazy")]] constexpr auto bytes() const noexcept;
 
   [[nodiscard("iterators are lazy")]] constexpr auto bytes_mut(noexport::unsafe_t) const noexcept
@@ -122,6 +125,11 @@ class basic_string_view {
   [[nodiscard]] constexpr auto find(char_t ch) const noexcept -> size_t;
   [[nodiscard]] constexpr auto rfind(char_t ch) const noexcept -> size_t;
 
+  /// occurrences of `ch`, they never overlap
+  [[nodiscard]] constexpr auto count(char_t ch) const noexcept -> size_t;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto find_all(char_t ch) const noexcept;
+
   [[nodiscard]] constexpr auto find(string_view str) const noexcept -> size_t {
     return _inner.find(str._inner);
   }
@@ -130,13 +138,30 @@ class basic_string_view {
     return _inner.rfind(str._inner);
   }
 
-  [[nodiscard]] constexpr auto find_first_of(string_view str) const noexcept -> size_t;
+  [[nodiscard]] constexpr auto find(const searcher& needle) const noexcept -> size_t;
 
-  [[nodiscard]] constexpr auto find_first_not_of(string_view str) const noexcept -> size_t;
+  [[nodiscard]] constexpr auto rfind(const searcher& needle) const noexcept -> size_t;
 
-  [[nodiscard]] constexpr auto find_last_of(string_view str) const noexcept -> size_t;
+  // the `string_view` overloads build a `char_set` on each call, which may allocate
+  [[nodiscard]] constexpr auto find_first_of(string_view str) const -> size_t;
+  [[nodiscard]] constexpr auto find_first_of(const char_set& set) const noexcept -> size_t;
 
-  [[nodiscard]] constexpr auto find_last_not_of(string_view str) const noexcept -> size_t;
+  [[nodiscard]] constexpr auto find_first_not_of(string_view str) const -> size_t;
+  [[nodiscard]] constexpr auto find_first_not_of(const char_set& set) const noexcept -> size_t;
+
+  [[nodiscard]] constexpr auto find_last_of(string_view str) const -> size_t;
+  [[nodiscard]] constexpr auto find_last_of(const char_set& set) const noexcept -> size_t;
+
+  [[nodiscard]] constexpr auto find_last_not_of(string_view str) const -> size_t;
+  [[nodiscard]] constexpr auto find_last_not_of(const char_set& set) const noexcept -> size_t;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto split(char_t delimiter) const noexcept;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto split(string_view delimiter) const noexcept;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto lines() const noexcept;
+
+  [[nodiscard("iterators are lazy")]] constexpr auto split_whitespace() const noexcept;
 
   [[nodiscard]] constexpr auto starts_with(char_t ch) const noexcept -> bool;
 
@@ -153,6 +178,10 @@ class basic_string_view {
   [[nodiscard]] constexpr auto contains(auto str) const noexcept -> bool {
     return find(str) != npos;
   }
+
+  [[nodiscard]] constexpr auto contains(const searcher& needle) const noexcept -> bool {
+    return find(needle) != npos;
+  }
 };
 
 using string_view = basic_string_view<immut>;
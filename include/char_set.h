@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>  // std::ranges::sort
+#include <vector>
+
+namespace utf8 {
+
+/// chars to look for with the `find_*_of` family, compiled once and reused:
+/// ascii chars go to a bitmap, the others to sorted ranges of code points
+class char_set {
+  struct range {
+    std::uint32_t first, last;
+  };
+
+  // bit `byte >> 4` of `_ascii[byte & 15]` for each ascii char, the layout SIMD lookups take
+  std::array<std::uint8_t, 16> _ascii{};
+  std::vector<range> _ranges;  // disjoint and sorted
+
+  [[nodiscard]] constexpr auto contains_code(std::uint32_t code) const noexcept -> bool {
+    if (code < 0x80) {
+      return _ascii[code & 15] >> (code >> 4) & 1;
+    }
+    auto after = std::ranges::upper_bound(_ranges, code, {}, &range::first);
+    return after != _ranges.begin() && code <= std::prev(after)->last;
+  }
+
+  // ascii bytes are looked up without decoding
+  [[nodiscard]] constexpr auto contains_at(const char* place) const noexcept -> bool {
+    char8_t byte = *place;
+    if (byte < 0x80) {
+      return _ascii[byte & 15] >> (byte >> 4) & 1;
+    }
+    return not _ranges.empty() && contains_code(noexport::decode_char(place));
+  }
+
+  // first char that is (or with `in` unset is not) in the set
+  [[nodiscard]] constexpr auto find(std::string_view str, bool in) const noexcept -> size_t {
+    size_t pos = 0;
+    if not consteval {
+      if (is_ascii()) {
+        pos = noexport::simd::find_ascii(str.data(), str.size(), _ascii, in);
+      }
+    }
+    // the SIMD scan may stop in the middle of a char
+    while (pos < str.size() && not noexport::is_utf8_bound(str[pos])) {
+      pos++;
+    }
+    for (; pos < str.size(); pos += noexport::thin_decode(str[pos])) {
+      if (contains_at(str.data() + pos) == in) {
+        return pos;
+      }
+    }
+    return str.npos;
+  }
+
+  // the same from the end
+  [[nodiscard]] constexpr auto rfind(std::string_view str, bool in) const noexcept -> size_t {
+    size_t end = str.size();
+    if not consteval {
+      if (is_ascii()) {
+        end = noexport::simd::rfind_ascii(str.data(), str.size(), _ascii, in);
+      }
+    }
+    while (end > 0) {
+      auto pos = end - 1;
+      while (pos > 0 && not noexport::is_utf8_bound(str[pos])) {
+        pos--;
+      }
+      if (contains_at(str.data() + pos) == in) {
+        return pos;
+      }
+      end = pos;
+    }
+    return str.npos;
+  }
+
+  template <typename Q>
+  friend class basic_string_view;
+
+ public:
+  constexpr char_set() noexcept = default;
+
+  explicit constexpr char_set(string_view chars) {
+    std::vector<std::uint32_t> codes;
+    for (auto ch : chars.chars()) {
+      if (auto code = std::uint32_t(ch); code < 0x80) {
+        _ascii[code & 15] |= 1 << (code >> 4);
+      } else {
+        codes.push_back(code);
+      }
+    }
+    std::ranges::sort(codes);
+    for (auto code : codes) {
+      if (not _ranges.empty() && code <= _ranges.back().last + 1) {
+        _ranges.back().last = code;  // duplicates and adjacent chars extend the last range
+      } else {
+        _ranges.push_back({code, code});
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr auto contains(char_t ch) const noexcept -> bool {
+    return contains_code(std::uint32_t(ch));
+  }
+
+  /// whether all chars are ascii, then the search is a SIMD scan
+  [[nodiscard]] constexpr auto is_ascii() const noexcept -> bool {
+    return _ranges.empty();
+  }
+};
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_first_of(const char_set& set) const noexcept -> size_t {
+  return set.find(_inner, true);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_first_not_of(const char_set& set) const noexcept
+    -> size_t {
+  return set.find(_inner, false);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_last_of(const char_set& set) const noexcept -> size_t {
+  return set.rfind(_inner, true);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_last_not_of(const char_set& set) const noexcept
+    -> size_t {
+  return set.rfind(_inner, false);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_first_of(string_view str) const -> size_t {
+  return find_first_of(char_set(str));
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_first_not_of(string_view str) const -> size_t {
+  return find_first_not_of(char_set(str));
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_last_of(string_view str) const -> size_t {
+  return find_last_of(char_set(str));
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_last_not_of(string_view str) const -> size_t {
+  return find_last_not_of(char_set(str));
+}
+
+}  // namespace utf8
@@ -10,7 +10,8 @@ namespace utf8 {
 
 struct char_t {
   // static constexpr auto replacement = char_t("⌛");
-  static constexpr auto unicode_version = std::array<std::uint8_t, 3>{15, 0, 0};
+  // the UCD of the tables in include/unicode, kept in sync by tools/unicode_tables.py
+  static constexpr auto unicode_version = std::array<std::uint8_t, 3>{14, 0, 0};
 
   std::uint32_t inner;
 
@@ -0,0 +1,212 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+enum class sequence : std::uint8_t { valid, invalid, truncated };
+
+struct checked_char {
+  std::uint32_t code;  // U+FFFD unless the sequence is valid
+  std::uint32_t len;
+  sequence status;
+};
+
+// decodes the char at `ptr` while validating it, an invalid sequence takes its longest valid
+// prefix (or one byte), just as `validate` reports it in `error_len`
+constexpr auto decode_checked(const char* ptr, const char* end) noexcept -> checked_char {
+  char8_t first = *ptr;
+  if (first < 0x80) {
+    return {first, 1, sequence::valid};
+  }
+
+  auto width = std::uint32_t(char_width(first));
+  if (width == 0) {
+    return {0xFFFD, 1, sequence::invalid};
+  }
+
+  // only the second byte has narrower bounds: overlongs, surrogates and codes past U+10FFFF
+  char8_t low = first == 0xE0 ? 0xA0 : first == 0xF0 ? 0x90 : 0x80;
+  char8_t high = first == 0xED ? 0x9F : first == 0xF4 ? 0x8F : 0xBF;
+
+  auto code = first_byte(first, width);
+  for (std::uint32_t len = 1; len < width; len++) {
+    if (ptr + len == end) {
+      return {0xFFFD, len, sequence::truncated};
+    }
+    char8_t next = ptr[len];
+    if (next < low || next > high) {
+      return {0xFFFD, len, sequence::invalid};
+    }
+    code = acc_cont_byte(code, next);
+    low = 0x80, high = 0xBF;
+  }
+  return {code, width, sequence::valid};
+}
+
+// the char under the iterator is decoded once, when the iterator gets to it;
+// the bytes ahead are validated by SIMD a window at a time while they are in cache,
+// so only chars near invalid bytes (or at the end of a window) are checked one by one
+class checked_iter_base {
+ protected:
+  static constexpr size_t WINDOW = 16 * simd::BLOCK;
+
+  const char* _ptr = nullptr;
+  const char* _end = nullptr;
+  const char* _valid_to = nullptr;
+  const char* _scan_at = nullptr;
+  checked_char _current{};
+
+  // non-ascii chars inside the validated window are decoded without checks
+  auto read_windowed() noexcept -> bool {
+    if (_ptr >= _scan_at) {
+      auto valid = simd::validate_prefix(_ptr, std::min<size_t>(_end - _ptr, WINDOW));
+      _valid_to = _ptr + valid;
+      // a block with an error is passed by checked chars before scanning again
+      _scan_at = _ptr + std::max(valid, simd::BLOCK);
+    }
+    auto width = thin_decode(*_ptr);
+    if (_ptr + width > _valid_to) {
+      return false;
+    }
+    _current = {decode_char(_ptr), std::uint32_t(width), sequence::valid};
+    return true;
+  }
+
+  constexpr void read() noexcept {
+    if (_ptr == _end) {
+      return;
+    }
+    if not consteval {
+      if (char8_t(*_ptr) >= 0x80 && read_windowed()) {
+        return;
+      }
+    }
+    _current = decode_checked(_ptr, _end);
+  }
+
+ public:
+  constexpr checked_iter_base() noexcept = default;
+  constexpr checked_iter_base(const char* ptr, const char* end) noexcept : _ptr(ptr), _end(end) {
+    read();
+  }
+
+  constexpr auto operator==(const checked_iter_base& other) const noexcept -> bool {
+    return _ptr == other._ptr;
+  }
+};
+
+struct lossy_char_iter : checked_iter_base {
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = char_t;
+  using difference_type = std::ptrdiff_t;
+
+  using checked_iter_base::checked_iter_base;
+
+  constexpr auto operator++() noexcept -> lossy_char_iter& {
+    _ptr += _current.len;
+    read();
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> lossy_char_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return char_t(unsafe, _current.code);
+  }
+};
+
+struct try_char_iter : checked_iter_base {
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::expected<char_t, utf8_error>;
+  using difference_type = std::ptrdiff_t;
+
+  const char* _begin = nullptr;
+
+  constexpr try_char_iter() noexcept = default;
+  constexpr try_char_iter(const char* begin, const char* ptr, const char* end) noexcept
+      : checked_iter_base(ptr, end), _begin(begin) {}
+
+  // nothing is read after an error
+  constexpr auto operator++() noexcept -> try_char_iter& {
+    _ptr = _current.status == sequence::valid ? _ptr + _current.len : _end;
+    read();
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> try_char_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    if (_current.status == sequence::valid) {
+      return char_t(unsafe, _current.code);
+    }
+    auto error_len = _current.status == sequence::invalid ? std::optional<size_t>(_current.len)
+                                                          : std::nullopt;
+    return std::unexpected(utf8_error(size_t(_ptr - _begin), error_len));
+  }
+};
+}  // namespace noexport
+
+/// chars of unvalidated bytes, every invalid sequence is a U+FFFD just as in `parse_lossy`
+class lossy_chars_view : public std::ranges::view_interface<lossy_chars_view> {
+  std::string_view _bytes;
+
+ public:
+  constexpr lossy_chars_view() noexcept = default;
+  explicit constexpr lossy_chars_view(std::string_view bytes) noexcept : _bytes(bytes) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::lossy_char_iter(_bytes.data(), _bytes.data() + _bytes.size());
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return noexport::lossy_char_iter(_bytes.data() + _bytes.size(), _bytes.data() + _bytes.size());
+  }
+};
+
+/// chars of unvalidated bytes, the first invalid sequence is a `utf8_error` that ends the range
+class try_chars_view : public std::ranges::view_interface<try_chars_view> {
+  std::string_view _bytes;
+
+ public:
+  constexpr try_chars_view() noexcept = default;
+  explicit constexpr try_chars_view(std::string_view bytes) noexcept : _bytes(bytes) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    auto end = _bytes.data() + _bytes.size();
+    return noexport::try_char_iter(_bytes.data(), _bytes.data(), end);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    auto end = _bytes.data() + _bytes.size();
+    return noexport::try_char_iter(_bytes.data(), end, end);
+  }
+};
+
+/// decodes and validates `bytes` in a single pass, without `parse_lossy` copying them
+[[nodiscard]] constexpr auto chars_lossy(std::string_view bytes) noexcept -> lossy_chars_view {
+  return lossy_chars_view(bytes);
+}
+
+/// decodes and validates `bytes` in a single pass, without `parse` going over them first
+[[nodiscard]] constexpr auto try_chars(std::string_view bytes) noexcept -> try_chars_view {
+  return try_chars_view(bytes);
+}
+
+}  // namespace utf8
+
+namespace std::ranges {
+template <>
+constexpr bool enable_borrowed_range<utf8::lossy_chars_view> = true;
+template <>
+constexpr bool enable_borrowed_range<utf8::try_chars_view> = true;
+}  // namespace std::ranges
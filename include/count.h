@@ -0,0 +1,95 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+// bytes that start a char, `str` may begin or end in the middle of one
+constexpr auto count_leads(std::string_view str) noexcept -> size_t {
+  size_t pos = 0, count = 0;
+  if not consteval {
+    auto [bytes, leads] = simd::skip_leads(str.data(), str.size(), SIZE_MAX);
+    pos = bytes;
+    count = leads;
+  }
+  for (; pos + 8 <= str.size(); pos += 8) {
+    count += word_leads(load_word(str.data() + pos));
+  }
+  for (; pos < str.size(); pos++) {
+    count += size_t(is_utf8_bound(str[pos]));
+  }
+  return count;
+}
+
+// chars of UTF-8 never overlap, so every place of `bytes` is a whole char
+constexpr auto count_encoded(std::string_view str, std::string_view bytes) noexcept -> size_t {
+  size_t pos = 0, count = 0;
+  if not consteval {
+    auto [skipped, found] = simd::count_encoded(str.data(), str.size(), bytes.data(), bytes.size());
+    pos = skipped;
+    count = found;
+  }
+  for (pos = str.find(bytes, pos); pos != str.npos; pos = str.find(bytes, pos + bytes.size())) {
+    count++;
+  }
+  return count;
+}
+}  // namespace noexport
+
+/// number of chars without decoding them
+[[nodiscard]] constexpr auto count_chars(string_view str) noexcept -> size_t {
+  return noexport::count_leads(str);
+}
+
+/// byte offset of the char `n`, `count_chars(str)` is the end of the string
+[[nodiscard]] constexpr auto byte_offset_of_char(string_view str, size_t n) -> size_t {
+  auto bytes = std::string_view(str);
+
+  size_t pos = 0, chars = 0;
+  if not consteval {
+    auto [skipped, leads] = noexport::simd::skip_leads(bytes.data(), bytes.size(), n);
+    pos = skipped;
+    chars = leads;
+  }
+  for (; pos + 8 <= bytes.size(); pos += 8) {
+    auto leads = noexport::word_leads(noexport::load_word(bytes.data() + pos));
+    if (chars + leads > n) {
+      break;  // the char `n` starts in this word
+    }
+    chars += leads;
+  }
+  for (; pos < bytes.size(); pos++) {
+    if (noexport::is_utf8_bound(bytes[pos])) {
+      if (chars == n) {
+        return pos;
+      }
+      chars++;
+    }
+  }
+
+  if (chars != n) {
+    throw std::out_of_range(
+        std::format("char `{}` is out of the string of {} chars", n, chars));
+  }
+  return bytes.size();
+}
+
+/// index of the char that contains the byte `offset`, the end of the string is `count_chars(str)`
+[[nodiscard]] constexpr auto char_index_of_byte(string_view str, size_t offset) -> size_t {
+  auto bytes = std::string_view(str);
+  if (offset > bytes.size()) {
+    throw std::out_of_range(
+        std::format("byte `{}` is out of the string of {} bytes", offset, bytes.size()));
+  }
+  if (offset == bytes.size()) {
+    return count_chars(str);
+  }
+  return noexport::count_leads(bytes.substr(0, offset + 1)) - 1;
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::count(char_t ch) const noexcept -> size_t {
+  char place[4] = {};
+  return noexport::count_encoded(_inner, ch.encode_utf8(std::span(place)));
+}
+
+}  // namespace utf8
@@ -0,0 +1,112 @@
+#pragma once
+
+namespace utf8 {
+
+/// `string_view` that remembers the byte offset of every `stride`-th char, so a char is found
+/// by its position in O(stride) steps instead of walking `chars()` from the beginning,
+/// ascii strings need no index at all
+class indexed_string_view {
+  string_view _str;
+  size_t _stride;
+  size_t _chars = 0;
+  std::vector<size_t> _marks;  // offset of the char `i * _stride`, empty for ascii
+
+  [[nodiscard]] auto bytes() const noexcept -> std::string_view {
+    return _str;
+  }
+
+  void mark_word(size_t pos, size_t len) {
+    for (auto byte : bytes().substr(pos, len)) {
+      if (noexport::is_utf8_bound(byte)) {
+        if (_chars == _marks.size() * _stride) {
+          _marks.push_back(pos);
+        }
+        _chars++;
+      }
+      pos++;
+    }
+  }
+
+ public:
+  static constexpr size_t DEFAULT_STRIDE = 64;
+  static constexpr auto npos = string_view::npos;
+
+  explicit indexed_string_view(string_view str, size_t stride = DEFAULT_STRIDE)
+      : _str(str), _stride(std::max<size_t>(stride, 1)) {
+    auto data = bytes();
+    if (noexport::skip_ascii(data, 0) == data.size()) {
+      _chars = data.size();
+      return;
+    }
+
+    _marks.reserve(data.size() / _stride + 1);
+    size_t pos = 0;
+    for (; pos + 8 <= data.size(); pos += 8) {
+      auto leads = noexport::word_leads(noexport::load_word(data.data() + pos));
+
+      if (_chars + leads > _marks.size() * _stride) {
+        mark_word(pos, 8);  // the next marked char is in this word
+      } else {
+        _chars += leads;
+      }
+    }
+    mark_word(pos, data.size() - pos);
+  }
+
+  [[nodiscard]] auto view() const noexcept -> string_view {
+    return _str;
+  }
+
+  operator string_view() const noexcept {
+    return _str;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_t {
+    return _str.size();
+  }
+
+  [[nodiscard]] auto char_count() const noexcept -> size_t {
+    return _chars;
+  }
+
+  [[nodiscard]] auto is_ascii() const noexcept -> bool {
+    return _chars == size();
+  }
+
+  /// byte offset of the char `n`, `char_count()` is the end of the string
+  [[nodiscard]] auto char_offset(size_t n) const -> size_t {
+    if (n > _chars) {
+      throw std::out_of_range(
+          std::format("char `{}` is out of the string of {} chars", n, _chars));
+    }
+    if (n == _chars) {
+      return size();
+    }
+    if (is_ascii()) {
+      return n;
+    }
+
+    auto pos = _marks[n / _stride];
+    for (auto left = n % _stride; left > 0; left--) {
+      pos += noexport::thin_decode(bytes()[pos]);
+    }
+    return pos;
+  }
+
+  [[nodiscard]] auto char_at(size_t n) const -> char_t {
+    if (n >= _chars) {
+      throw std::out_of_range(
+          std::format("char `{}` is out of the string of {} chars", n, _chars));
+    }
+    return char_t(noexport::unsafe, noexport::decode_char(bytes().data() + char_offset(n)));
+  }
+
+  /// `count` chars from the char `pos` (or less if the string ends earlier)
+  [[nodiscard]] auto substr_chars(size_t pos, size_t count = npos) const -> string_view {
+    auto begin = char_offset(pos);
+    auto end = count >= _chars - pos ? size() : char_offset(pos + count);
+    return {noexport::unsafe, bytes().substr(begin, end - begin)};
+  }
+};
+
+}  // namespace utf8
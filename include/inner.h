@@ -2,7 +2,9 @@
 
 namespace utf8 {
 namespace noexport {
-struct char_iter {
+// chars are read forward by `Decoder`, backward by `decode_char_back`
+template <typename Decoder>
+struct basic_char_iter {
   using iterator_concept = std::bidirectional_iterator_tag;
   using iterator_category = std::bidirectional_iterator_tag;
   using value_type = char_t;
@@ -10,40 +12,42 @@ struct char_iter {
 
   const char* ptr;
 
-  explicit constexpr char_iter() noexcept = default;
-  explicit constexpr char_iter(const char* ptr) noexcept : ptr(ptr) {}
+  explicit constexpr basic_char_iter() noexcept = default;
+  explicit constexpr basic_char_iter(const char* ptr) noexcept : ptr(ptr) {}
 
-  constexpr auto operator++() -> char_iter& {
-    ptr += noexport::thin_decode(*ptr);
+  constexpr auto operator++() -> basic_char_iter& {
+    ptr += Decoder::width(ptr);
     return *this;
   }
 
-  constexpr auto operator++(int) -> char_iter {
+  constexpr auto operator++(int) -> basic_char_iter {
     auto tmp = *this;
     ++(*this);
     return tmp;
   }
 
-  constexpr auto operator--() -> char_iter& {
+  constexpr auto operator--() -> basic_char_iter& {
     ptr -= noexport::seek_decode_back(ptr);
     return *this;
   }
 
-  constexpr auto operator--(int) -> char_iter {
+  constexpr auto operator--(int) -> basic_char_iter {
     auto tmp = *this;
     --(*this);
     return tmp;
   }
 
   constexpr auto operator*() const -> value_type {
-    return char_t(noexport::unsafe, noexport::decode_char(ptr));
+    return char_t(noexport::unsafe, Decoder::decode(ptr));
   }
 
-  constexpr auto operator==(const char_iter& other) const noexcept -> bool {
+  constexpr auto operator==(const basic_char_iter& other) const noexcept -> bool {
     return ptr == other.ptr;
   }
 };
 
+using char_iter = basic_char_iter<default_decoder>;
+
 struct char_indices_iter {
   using iterator_concept = std::bidirectional_iterator_tag;
   using iterator_category = std::bidirectional_iterator_tag;
@@ -91,16 +95,126 @@ struct char_indices_iter {
 };
 }  // namespace noexport
 
-class chars_view : public std::ranges::view_interface<chars_view> {
-  noexport::char_iter _begin{}, _end{};
+/// a batch of `chars_view::decode_into`
+struct decoded {
+  size_t chars;
+  size_t bytes;
+};
+
+namespace noexport {
+// decodes chars to `dst` until it has `want` of them (or `ptr` reaches `end`), whole registers
+// of the SIMD kernel may write up to 15 more of them if `dst` has room for them
+constexpr auto decode_into(const char* ptr, const char* end, std::span<char_t> dst,
+                           size_t want) noexcept -> decoded {
+  auto begin = ptr;
+  auto room = std::min(dst.size(), want + 15);
+
+  size_t out = 0;
+  while (ptr != end && out < want) {
+#ifdef _UTF8_SIMD_SSE2
+    if not consteval {
+      auto [read, written] = simd::decode_utf32(
+          ptr, size_t(end - ptr), reinterpret_cast<std::uint32_t*>(dst.data() + out), room - out);
+      ptr += read;
+      out += written;
+      if (ptr == end || out >= want) {
+        break;
+      }
+    }
+#endif
+    // the kernel stops at the tail, near `want` or (without SSE4.2) at a 4-byte char,
+    // go on until it may take an ascii or a 2-byte run again
+    do {
+      auto width = thin_decode(*ptr);
+      dst[out++] = char_t(unsafe, decode_char(ptr));
+      ptr += width;
+    } while (ptr != end && out < want &&
+             (end - ptr < 16 || out + 16 > room || std::uint8_t(*ptr) >= 0xE0));
+  }
+  return {out, size_t(ptr - begin)};
+}
+}  // namespace noexport
+
+/// decodes `N` chars per step, a block is a `std::span<const char_t>` of up to `N` chars
+template <size_t N>
+class char_blocks_view : public std::ranges::view_interface<char_blocks_view<N>> {
+  const char* _begin;
+  const char* _end;
 
  public:
-  explicit constexpr chars_view(noexport::unsafe_t, std::string_view str) noexcept
+  class iterator {
+    // room for the chars that the last register of a block decodes past `N`,
+    // they start the next block
+    static constexpr size_t SIZE = N + 15;
+
+    const char* _ptr;
+    const char* _end;
+    size_t _len = 0;
+    size_t _extra = 0;
+    std::array<char_t, SIZE> _block = []<size_t... I>(std::index_sequence<I...>) {
+      return std::array<char_t, SIZE>{(void(I), char_t('\0'))...};
+    }(std::make_index_sequence<SIZE>());
+
+    constexpr void next() noexcept {
+      std::copy_n(_block.begin() + _len, _extra, _block.begin());
+      auto want = _extra < N ? N - _extra : 0;
+      auto [chars, bytes] =
+          noexport::decode_into(_ptr, _end, std::span(_block).subspan(_extra), want);
+      _ptr += bytes;
+      _len = std::min(_extra + chars, N);
+      _extra = _extra + chars - _len;
+    }
+
+   public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = std::span<const char_t>;
+    using difference_type = ptrdiff_t;
+
+    constexpr iterator(const char* ptr, const char* end) noexcept : _ptr(ptr), _end(end) {
+      next();
+    }
+
+    constexpr auto operator++() noexcept -> iterator& {
+      next();
+      return *this;
+    }
+
+    constexpr void operator++(int) noexcept {
+      next();
+    }
+
+    constexpr auto operator*() const noexcept -> value_type {
+      return {_block.data(), _len};
+    }
+
+    constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool {
+      return _len == 0;
+    }
+  };
+
+  explicit constexpr char_blocks_view(noexport::unsafe_t, std::string_view str) noexcept
+      : _begin(str.data()), _end(str.data() + str.size()) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return iterator(_begin, _end);
+  }
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return std::default_sentinel;
+  }
+};
+
+/// `basic_chars_view<table_decoder>(str)` iterates `str` with another decoder than `chars()`
+template <typename Decoder>
+class basic_chars_view : public std::ranges::view_interface<basic_chars_view<Decoder>> {
+  noexport::basic_char_iter<Decoder> _begin{}, _end{};
+
+ public:
+  explicit constexpr basic_chars_view(noexport::unsafe_t, std::string_view str) noexcept
       : _begin(str.begin()), _end(str.end()) {}
 
   template <typename Q>
-  explicit constexpr chars_view(basic_string_view<Q> str) noexcept
-      : chars_view(noexport::unsafe, str._inner) {}
+  explicit constexpr basic_chars_view(basic_string_view<Q> str) noexcept
+      : basic_chars_view(noexport::unsafe, str._inner) {}
 
   [[nodiscard]] constexpr auto begin() const noexcept {
     return _begin;
@@ -108,8 +222,22 @@ class chars_view : public std::ranges::view_interface<chars_view> {
   [[nodiscard]] constexpr auto end() const noexcept {
     return _end;
   }
+
+  /// decodes the first chars to fill `dst` (or the whole view if it is shorter),
+  /// 16 bytes at once
+  constexpr auto decode_into(std::span<char_t> dst) const noexcept -> decoded {
+    return noexport::decode_into(_begin.ptr, _end.ptr, dst, dst.size());
+  }
+
+  /// `for (std::span<const char_t> block : str.chars().blocks())`
+  template <size_t N = 64>
+  [[nodiscard]] constexpr auto blocks() const noexcept {
+    return char_blocks_view<N>(noexport::unsafe, {_begin.ptr, _end.ptr});
+  }
 };
 
+using chars_view = basic_chars_view<default_decoder>;
+
 class char_indices_view : public std::ranges::view_interface<char_indices_view> {
   noexport::char_indices_iter _begin, _end;
 
@@ -188,58 +316,40 @@ consteval char_t::char_t(noexport::unsafe_t, std::string_view raw) {
   }
 }
 
-template <typename Q>
-constexpr auto basic_string_view<Q>::find(char_t ch) const noexcept -> size_t {
-  char place[4] = {};
-  auto str = ch.encode_utf8(std::span(place));
-  return _inner.find(str);
-}
-
-template <typename Q>
-constexpr auto basic_string_view<Q>::rfind(char_t ch) const noexcept -> size_t {
-  char place[4] = {};
-  auto str = ch.encode_utf8(std::span(place));
-  return _inner.rfind(str);
-}
-
-template <typename Q>
-constexpr auto basic_string_view<Q>::find_first_of(string_view str) const noexcept -> size_t {
-  for (auto [idx, ch] : char_indices()) {
-    if (str.find(ch) != npos) {
-      return idx;
+namespace noexport {
+// an ascii char is a `memchr`, wider chars compare each of their bytes in SIMD registers
+constexpr auto find_encoded(std::string_view str, std::string_view bytes, size_t pos = 0) noexcept
+    -> size_t {
+  if (bytes.size() == 1) {
+    return str.find(bytes[0], pos);
+  }
+  if not consteval {
+    if (pos < str.size()) {
+      pos += simd::find_encoded(str.data() + pos, str.size() - pos, bytes.data(), bytes.size());
     }
   }
-  return npos;
+  return str.find(bytes, pos);
 }
 
-template <typename Q>
-constexpr auto basic_string_view<Q>::find_first_not_of(string_view str) const noexcept -> size_t {
-  for (auto [idx, ch] : char_indices()) {
-    if (str.find(ch) == npos) {
-      return idx;
-    }
+constexpr auto rfind_encoded(std::string_view str, std::string_view bytes) noexcept -> size_t {
+  auto end = str.size();
+  if not consteval {
+    end = simd::rfind_encoded(str.data(), str.size(), bytes.data(), bytes.size());
   }
-  return npos;
+  return str.substr(0, end).rfind(bytes);
 }
+}  // namespace noexport
 
 template <typename Q>
-constexpr auto basic_string_view<Q>::find_last_of(string_view str) const noexcept -> size_t {
-  for (auto [idx, ch] : char_indices() | std::views::reverse) {
-    if (str.find(ch) != npos) {
-      return idx;
-    }
-  }
-  return npos;
+constexpr auto basic_string_view<Q>::find(char_t ch) const noexcept -> size_t {
+  char place[4] = {};
+  return noexport::find_encoded(_inner, ch.encode_utf8(std::span(place)));
 }
 
 template <typename Q>
-constexpr auto basic_string_view<Q>::find_last_not_of(string_view str) const noexcept -> size_t {
-  for (auto [idx, ch] : char_indices() | std::views::reverse) {
-    if (str.find(ch) == npos) {
-      return idx;
-    }
-  }
-  return npos;
+constexpr auto basic_string_view<Q>::rfind(char_t ch) const noexcept -> size_t {
+  char place[4] = {};
+  return noexport::rfind_encoded(_inner, ch.encode_utf8(std::span(place)));
 }
 
 template <typename Q>
@@ -255,8 +365,8 @@ constexpr auto basic_string_view<Q>::ends_with(char_t ch) const noexcept -> bool
 }  // namespace utf8
 
 namespace std::ranges {
-template <>
-constexpr bool enable_borrowed_range<utf8::chars_view> = true;
+template <typename Decoder>
+constexpr bool enable_borrowed_range<utf8::basic_chars_view<Decoder>> = true;
 template <>
 constexpr bool enable_borrowed_range<utf8::char_indices_view> = true;
 template <>
@@ -1,3 +1,25 @@
 #pragma once
 
-namespace utf8 {}  // namespace utf8
\ No newline at end of file
+namespace utf8 {
+
+/// only answers whether `str` is valid UTF-8, `validate` also finds the error (at the same speed)
+[[nodiscard]] constexpr auto is_utf8(std::string_view str) noexcept -> bool {
+  if consteval {
+    return not noexport::validate_scalar(str);
+  } else {
+    if (auto valid = noexport::simd::is_valid(str.data(), str.size())) {
+      return *valid;
+    }
+    return not noexport::validate_scalar(str);
+  }
+}
+
+[[nodiscard]] inline auto is_utf8(std::span<const char8_t> bytes) noexcept -> bool {
+  return is_utf8({reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+}
+
+[[nodiscard]] inline auto is_utf8(std::span<const std::byte> bytes) noexcept -> bool {
+  return is_utf8({reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+}
+
+}  // namespace utf8
@@ -0,0 +1,144 @@
+#pragma once
+
+#if __has_include(<sys/mman.h>)
+
+// `mutable` is redefined by basic_string_view.h
+#pragma push_macro("mutable")
+#undef mutable
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#pragma pop_macro("mutable")
+
+namespace utf8 {
+
+namespace noexport {
+class mapping {
+  void* _addr = nullptr;
+  size_t _size = 0;
+
+  [[noreturn]] static void fail(int error, const char* what) {
+    throw std::system_error(error, std::generic_category(), what);
+  }
+
+ public:
+  mapping(const std::filesystem::path& path, bool writable) {
+    auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      fail(errno, "open");
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) < 0) {
+      auto error = errno;  // `close` may overwrite it
+      ::close(fd);
+      fail(error, "fstat");
+    }
+
+    _size = size_t(info.st_size);
+    if (_size > 0) {
+      // private mapping: pages written by a lossy repair are copied, the file stays intact
+      auto prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+      _addr = ::mmap(nullptr, _size, prot, MAP_PRIVATE, fd, 0);
+      if (_addr == MAP_FAILED) {
+        _addr = nullptr;
+        auto error = errno;
+        ::close(fd);
+        fail(error, "mmap");
+      }
+      ::madvise(_addr, _size, MADV_SEQUENTIAL);
+      ::madvise(_addr, _size, MADV_WILLNEED);
+    }
+    ::close(fd);
+  }
+
+  mapping(const mapping&) = delete;
+  auto operator=(const mapping&) -> mapping& = delete;
+
+  ~mapping() {
+    if (_addr) {
+      ::munmap(_addr, _size);
+    }
+  }
+
+  [[nodiscard]] auto bytes() const noexcept -> std::span<char> {
+    return {static_cast<char*>(_addr), _size};
+  }
+};
+}  // namespace noexport
+
+/// validated read-only file contents without copying them into memory,
+/// copies share the mapping, which lives as long as any of them
+class mapped_file {
+  std::shared_ptr<const void> _owner;
+  std::string_view _bytes;
+  bool _repaired = false;
+
+ public:
+  // throws `utf8_error` if the file is not valid UTF-8
+  explicit mapped_file(const std::filesystem::path& path) {
+    auto place = std::make_shared<const noexport::mapping>(path, false);
+    auto bytes = place->bytes();
+
+    _bytes = parse({bytes.data(), bytes.size()});
+    _owner = std::move(place);
+  }
+
+  // invalid bytes are replaced by U+FFFD in the (copy-on-write) mapping while the replacement
+  // fits, otherwise the file is repaired into memory
+  mapped_file(const std::filesystem::path& path, lossy_t) {
+    auto place = std::make_shared<const noexport::mapping>(path, true);
+    auto bytes = place->bytes();
+
+    if (is_utf8({bytes.data(), bytes.size()})) {
+      _bytes = {bytes.data(), bytes.size()};
+      _owner = std::move(place);
+      return;
+    }
+
+    _repaired = true;
+    if (auto [write, read] = noexport::lossy_compact(bytes); read == bytes.size()) {
+      _bytes = {bytes.data(), write};
+      _owner = std::move(place);
+    } else {
+      auto rest = std::string_view(bytes.data() + read, bytes.size() - read);
+      auto out = std::make_shared<std::string>();
+      out->reserve(write + noexport::lossy_size(rest));
+      out->append(bytes.data(), write);
+      noexport::lossy_pieces(rest, [&](std::string_view piece) { out->append(piece); });
+      _bytes = *out;
+      _owner = std::move(out);
+    }
+  }
+
+  [[nodiscard]] auto view() const& noexcept -> string_view {
+    return {noexport::unsafe, _bytes};
+  }
+
+  // forbid `use after free`
+  auto view() && = delete;
+
+  operator string_view() const& noexcept {
+    return view();
+  }
+
+  operator string_view() && = delete;
+
+  [[nodiscard]] auto size() const noexcept -> size_t {
+    return _bytes.size();
+  }
+
+  // some bytes were replaced by U+FFFD
+  [[nodiscard]] auto repaired() const noexcept -> bool {
+    return _repaired;
+  }
+};
+
+}  // namespace utf8
+
+#endif
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>  // std::ranges::stable_sort
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace utf8 {
+
+/// a pattern of a `multi_searcher` found at the byte `pos`
+struct multi_match {
+  size_t pattern;  // index of the pattern in the list the searcher is built from
+  size_t pos;
+
+  constexpr auto operator==(const multi_match&) const noexcept -> bool = default;
+};
+
+namespace noexport {
+// where a scan over a haystack stopped
+struct multi_cursor {
+  std::string_view str;
+  bool teddy = false;
+  size_t pos = 0;  // bytes fed to the automaton or the fingerprint place after the last one
+  std::uint32_t state = 0;
+  std::uint32_t out = 0, out_end = 0;  // matches of `state` not reported yet
+  std::uint8_t bits = 0;               // patterns of the last fingerprint not verified yet
+  multi_match current{0, SIZE_MAX};
+};
+
+class multi_match_iter;
+}  // namespace noexport
+
+/// every occurrence of many patterns in one pass, overlapping ones too: Teddy (a SIMD filter
+/// by the last bytes of the patterns) for up to 8 of them, an Aho-Corasick automaton otherwise,
+/// empty patterns are never found
+class multi_searcher {
+  static constexpr size_t TEDDY_PATTERNS = 8;
+  static constexpr auto NONE = std::uint32_t(-1);
+
+  std::vector<std::string> _patterns;
+  std::vector<std::uint32_t> _order;  // non-empty patterns, the longest first
+
+  // bit `i` of the masks is `_order[i]`
+  noexport::simd::teddy_t _teddy;
+
+  // bytes that occur in no pattern share the class 0, states from `_first_match` on
+  // are the ends of some patterns
+  std::array<std::uint8_t, 256> _classes{};
+  size_t _stride = 1;
+  std::vector<std::uint32_t> _next;
+  std::uint32_t _first_match = 0;
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> _outputs;  // ranges of `_ids`
+  std::vector<std::uint32_t> _ids;
+
+  constexpr void build_teddy() {
+    auto len = _patterns[_order.back()].size();
+    _teddy.len = std::min<size_t>(len, _teddy.low.size());
+    for (size_t bit = 0; bit < _order.size(); bit++) {
+      auto& pattern = _patterns[_order[bit]];
+      auto tail = std::string_view(pattern).substr(pattern.size() - _teddy.len);
+      for (size_t k = 0; k < _teddy.len; k++) {
+        char8_t byte = tail[k];
+        _teddy.low[k][byte & 15] |= 1 << bit;
+        _teddy.high[k][byte >> 4] |= 1 << bit;
+      }
+    }
+  }
+
+  constexpr void build_automaton() {
+    for (auto& pattern : _patterns) {
+      for (char8_t byte : pattern) {
+        if (_classes[byte] == 0) {
+          _classes[byte] = _stride++;
+        }
+      }
+    }
+
+    // trie of the patterns, `own` are the patterns that end in each state
+    std::vector<std::uint32_t> next(_stride, NONE);
+    std::vector<std::vector<std::uint32_t>> own(1);
+    for (std::uint32_t id = 0; id < _patterns.size(); id++) {
+      if (_patterns[id].empty()) {
+        continue;
+      }
+      std::uint32_t state = 0;
+      for (char8_t byte : _patterns[id]) {
+        auto at = state * _stride + _classes[byte];
+        if (next[at] == NONE) {
+          next[at] = own.size();
+          own.emplace_back();
+          next.resize(next.size() + _stride, NONE);
+        }
+        state = next[at];
+      }
+      own[state].push_back(id);
+    }
+
+    // missing transitions follow the failure links, states are visited by depth
+    std::vector<std::uint32_t> fail(own.size(), 0), queue{0};
+    std::vector<std::vector<std::uint32_t>> out(own.size());
+    for (size_t head = 0; head < queue.size(); head++) {
+      auto state = queue[head];
+      for (size_t cls = 0; cls < _stride; cls++) {
+        auto fallback = state == 0 ? 0 : next[fail[state] * _stride + cls];
+        auto& to = next[state * _stride + cls];
+        if (to == NONE) {
+          to = fallback;
+        } else {
+          fail[to] = fallback;
+          queue.push_back(to);
+        }
+      }
+      out[state] = own[state];
+      if (state != 0) {
+        auto& shorter = out[fail[state]];  // patterns that end with this one go after it
+        out[state].insert(out[state].end(), shorter.begin(), shorter.end());
+      }
+    }
+
+    // states with matches are numbered last, so the scan checks them with a single compare
+    std::vector<std::uint32_t> rename(own.size());
+    std::uint32_t id = 0;
+    for (auto state : queue) {
+      if (out[state].empty()) {
+        rename[state] = id++;
+      }
+    }
+    _first_match = id;
+    _outputs.resize(own.size() - id);
+    for (auto state : queue) {
+      if (not out[state].empty()) {
+        rename[state] = id++;
+        auto begin = std::uint32_t(_ids.size());
+        _ids.insert(_ids.end(), out[state].begin(), out[state].end());
+        _outputs[rename[state] - _first_match] = {begin, std::uint32_t(_ids.size())};
+      }
+    }
+    _next.resize(next.size());
+    for (size_t state = 0; state < own.size(); state++) {
+      for (size_t cls = 0; cls < _stride; cls++) {
+        _next[rename[state] * _stride + cls] = rename[next[state * _stride + cls]];
+      }
+    }
+  }
+
+  template <typename R>
+  constexpr void build(R&& patterns) {
+    for (string_view pattern : patterns) {
+      _patterns.emplace_back(pattern);
+    }
+    for (std::uint32_t id = 0; id < _patterns.size(); id++) {
+      if (not _patterns[id].empty()) {
+        _order.push_back(id);
+      }
+    }
+    std::ranges::stable_sort(_order, std::greater{}, [&](auto id) { return _patterns[id].size(); });
+
+    if (not _order.empty() && _order.size() <= TEDDY_PATTERNS) {
+      build_teddy();
+    }
+    build_automaton();
+  }
+
+  // patterns whose fingerprint may start at `pos`
+  [[nodiscard]] constexpr auto fingerprint(std::string_view str, size_t pos) const noexcept
+      -> std::uint8_t {
+    std::uint8_t bits = 0xFF;
+    for (size_t k = 0; k < _teddy.len; k++) {
+      char8_t byte = str[pos + k];
+      bits &= _teddy.low[k][byte & 15] & _teddy.high[k][byte >> 4];
+    }
+    return bits;
+  }
+
+  constexpr void advance_teddy(noexport::multi_cursor& cursor) const noexcept {
+    auto str = cursor.str;
+    while (true) {
+      while (cursor.bits != 0) {
+        auto id = _order[std::countr_zero(cursor.bits)];
+        cursor.bits &= cursor.bits - 1;
+        auto& pattern = _patterns[id];
+        auto end = cursor.pos - 1 + _teddy.len;
+        if (end >= pattern.size() && str.substr(end - pattern.size(), pattern.size()) == pattern) {
+          cursor.current = {id, end - pattern.size()};
+          return;
+        }
+      }
+
+      auto pos = cursor.pos;
+      if not consteval {
+        pos += noexport::simd::find_teddy(str.data() + pos, str.size() - pos, _teddy);
+      }
+      for (; pos + _teddy.len <= str.size(); pos++) {
+        if (auto bits = fingerprint(str, pos)) {
+          cursor.bits = bits;
+          break;
+        }
+      }
+      if (pos + _teddy.len > str.size()) {
+        cursor.current.pos = SIZE_MAX;
+        return;
+      }
+      cursor.pos = pos + 1;
+    }
+  }
+
+  constexpr void advance_automaton(noexport::multi_cursor& cursor) const noexcept {
+    if (cursor.out == cursor.out_end) {
+      auto str = cursor.str;
+      auto state = cursor.state;
+      auto pos = cursor.pos;
+      do {
+        if (pos == str.size()) {
+          cursor.current.pos = SIZE_MAX;
+          return;
+        }
+        state = _next[state * _stride + _classes[char8_t(str[pos++])]];
+      } while (state < _first_match);
+      cursor.state = state;
+      cursor.pos = pos;
+      std::tie(cursor.out, cursor.out_end) = _outputs[state - _first_match];
+    }
+    auto id = _ids[cursor.out++];
+    cursor.current = {id, cursor.pos - _patterns[id].size()};
+  }
+
+  // the match after the ones `cursor` has reported
+  constexpr void advance(noexport::multi_cursor& cursor) const noexcept {
+    cursor.teddy ? advance_teddy(cursor) : advance_automaton(cursor);
+  }
+
+  friend class noexport::multi_match_iter;
+
+ public:
+  template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, string_view>
+  explicit constexpr multi_searcher(R&& patterns) {
+    build(patterns);
+  }
+
+  constexpr multi_searcher(std::initializer_list<string_view> patterns) {
+    build(patterns);
+  }
+
+  /// matches ordered by where they end, the longer one first
+  [[nodiscard("iterators are lazy")]] constexpr auto matches(string_view haystack) const noexcept;
+};
+
+namespace noexport {
+class multi_match_iter {
+  const multi_searcher* _searcher = nullptr;
+  multi_cursor _cursor;
+
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = multi_match;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr multi_match_iter() noexcept = default;
+  constexpr multi_match_iter(const multi_searcher& searcher, std::string_view str) noexcept
+      : _searcher(&searcher), _cursor{.str = str} {
+    if not consteval {
+      _cursor.teddy = searcher._teddy.len != 0 && simd::best() != simd::isa::none;
+    }
+    _searcher->advance(_cursor);
+  }
+
+  constexpr auto operator++() noexcept -> multi_match_iter& {
+    _searcher->advance(_cursor);
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> multi_match_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return _cursor.current;
+  }
+
+  constexpr auto operator==(const multi_match_iter& other) const noexcept -> bool {
+    return _cursor.current == other._cursor.current;
+  }
+
+  constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool {
+    return _cursor.current.pos == SIZE_MAX;
+  }
+};
+}  // namespace noexport
+
+class multi_matches_view : public std::ranges::view_interface<multi_matches_view> {
+  const multi_searcher* _searcher = nullptr;
+  std::string_view _str;
+
+ public:
+  constexpr multi_matches_view() noexcept = default;
+  constexpr multi_matches_view(const multi_searcher& searcher, string_view str) noexcept
+      : _searcher(&searcher), _str(str) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::multi_match_iter(*_searcher, _str);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return std::default_sentinel;
+  }
+};
+
+constexpr auto multi_searcher::matches(string_view haystack) const noexcept {
+  return multi_matches_view(*this, haystack);
+}
+
+}  // namespace utf8
+
+namespace std::ranges {
+template <>
+constexpr bool enable_borrowed_range<utf8::multi_matches_view> = true;
+}  // namespace std::ranges
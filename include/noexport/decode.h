@@ -89,4 +89,66 @@ constexpr auto decode_char_back(const char* place) noexcept -> std::uint32_t {
   return ch;
 }
 
-}  // namespace utf8::noexport
\ No newline at end of file
+}  // namespace utf8::noexport
+
+namespace utf8 {
+
+// how `basic_char_iter` reads a char: its width in bytes and its code
+
+// branch per lead byte, cheap when the text is mostly in one script
+struct branchy_decoder {
+  static constexpr auto width(const char* place) noexcept -> size_t {
+    return noexport::thin_decode(*place);
+  }
+
+  static constexpr auto decode(const char* place) noexcept -> std::uint32_t {
+    return noexport::decode_char(place);
+  }
+};
+
+// one lookup of the lead byte classifies the char (width, payload mask and final shift),
+// then continuation bytes are merged without branches, so mixed scripts do not mispredict;
+// a shorter char reads its own bytes again instead of the next ones and they are shifted out
+struct table_decoder {
+  struct lead_t {
+    std::uint8_t width, mask, shift;
+  };
+
+  static constexpr auto LEADS = [] {
+    std::array<lead_t, 256> leads{};
+    for (size_t byte = 0; byte < 256; byte++) {
+      if (byte < 0xC0) {
+        leads[byte] = {1, 0x7F, 18};  // continuation bytes never start a valid char
+      } else if (byte < 0xE0) {
+        leads[byte] = {2, 0x1F, 12};
+      } else if (byte < 0xF0) {
+        leads[byte] = {3, 0x0F, 6};
+      } else {
+        leads[byte] = {4, 0x07, 0};
+      }
+    }
+    return leads;
+  }();
+
+  static constexpr auto width(const char* place) noexcept -> size_t {
+    return LEADS[std::uint8_t(*place)].width;
+  }
+
+  static constexpr auto decode(const char* place) noexcept -> std::uint32_t {
+    auto [width, mask, shift] = LEADS[std::uint8_t(*place)];
+    std::uint32_t b0 = std::uint8_t(place[0]);
+    std::uint32_t b1 = std::uint8_t(place[width > 1]);
+    std::uint32_t b2 = std::uint8_t(place[(width > 2) * 2]);
+    std::uint32_t b3 = std::uint8_t(place[(width > 3) * 3]);
+
+    auto code = (b0 & mask) << 18 | (b1 & CONT_MASK) << 12 | (b2 & CONT_MASK) << 6 |
+                (b3 & CONT_MASK);
+    return code >> shift;
+  }
+};
+
+// `table_decoder` is slower on every kind of text, even on mixed scripts it only comes close:
+// the lookup is on the path from one char to the next, a predicted branch is not
+using default_decoder = branchy_decoder;
+
+}  // namespace utf8
@@ -28,15 +28,10 @@ constexpr auto size_utf8(std::uint32_t code) noexcept -> size_t {
   }
 }
 
-constexpr auto encode_utf8(std::uint32_t code, std::span<char> dst) -> std::span<char> {
+// `dst` must have room for `size_utf8(code)` bytes
+constexpr auto encode_utf8_unchecked(std::uint32_t code, char* dst) noexcept -> size_t {
   auto len = size_utf8(code);
 
-  if (len > 4 || len > dst.size()) {
-    throw std::logic_error(
-        std::format("encode_utf8: need {} bytes to encode U+{:x} code, but the buffer has {}", len,
-                    code, dst.size()));
-  }
-
   switch (len) {
     case 1:
       dst[0] = char(code);
@@ -61,7 +56,19 @@ constexpr auto encode_utf8(std::uint32_t code, std::span<char> dst) -> std::span
       std::abort();
   }
 
-  return dst.subspan(0, len);
+  return len;
+}
+
+constexpr auto encode_utf8(std::uint32_t code, std::span<char> dst) -> std::span<char> {
+  auto len = size_utf8(code);
+
+  if (len > 4 || len > dst.size()) {
+    throw std::logic_error(
+        std::format("encode_utf8: need {} bytes to encode U+{:x} code, but the buffer has {}", len,
+                    code, dst.size()));
+  }
+
+  return dst.subspan(0, encode_utf8_unchecked(code, dst.data()));
 }
 
 constexpr auto is_valid_code(std::uint32_t c) noexcept -> bool {
@@ -0,0 +1,352 @@
+#pragma once
+
+#include <algorithm>  // std::min
+#include <array>
+#include <bit>  // std::popcount
+#include <cstddef>  // size_t
+#include <cstdint>  // std::uint8_t
+#include <cstring>  // std::memcpy
+#include <optional>
+
+// SIMD kernels are compiled for several instruction sets and chosen at runtime,
+// define `_UTF8_NO_SIMD` to always use the portable code
+#if !defined(_UTF8_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define _UTF8_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace utf8::noexport::simd {
+
+enum class isa : std::uint8_t { none, sse42, avx2, avx512 };
+
+// lookup tables of "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser, Lemire)
+// clang-format off
+constexpr std::uint8_t TOO_SHORT   = 1 << 0;  // 11______ 0_______ | 11______ 11______
+constexpr std::uint8_t TOO_LONG    = 1 << 1;  // 0_______ 10______
+constexpr std::uint8_t OVERLONG_3  = 1 << 2;  // 11100000 100_____
+constexpr std::uint8_t TOO_LARGE   = 1 << 3;  // 11110100 1001____ | 11110101.. 10______
+constexpr std::uint8_t SURROGATE   = 1 << 4;  // 11101101 101_____
+constexpr std::uint8_t OVERLONG_2  = 1 << 5;  // 1100000_ 10______
+constexpr std::uint8_t TOO_LARGE_1000 = 1 << 6;  // 11110101.. 1000____
+constexpr std::uint8_t OVERLONG_4  = 1 << 6;  // 11110000 1000____
+constexpr std::uint8_t TWO_CONTS   = 1 << 7;  // 10______ 10______
+constexpr std::uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+constexpr auto BYTE_1_HIGH = std::to_array<std::uint8_t>({
+    // 0_______ ________ <ascii in byte 1>
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    // 10______ ________ <continuation in byte 1>
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    // 1100____ ________ <two byte lead in byte 1>
+    TOO_SHORT | OVERLONG_2,
+    // 1101____ ________ <two byte lead in byte 1>
+    TOO_SHORT,
+    // 1110____ ________ <three byte lead in byte 1>
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    // 1111____ ________ <four+ byte lead in byte 1>
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+});
+
+constexpr auto BYTE_1_LOW = std::to_array<std::uint8_t>({
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,  // ____0000 ________
+    CARRY | OVERLONG_2,                            // ____0001 ________
+    CARRY,                                         // ____001_ ________
+    CARRY,
+    CARRY | TOO_LARGE,                             // ____0100 ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000,            // ____0101 ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000,            // ____011_ ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,            // ____1___ ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,  // ____1101 ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+});
+
+constexpr auto BYTE_2_HIGH = std::to_array<std::uint8_t>({
+    // ________ 0_______ <ascii in byte 2>
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    // ________ 1000____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    // ________ 1001____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    // ________ 101_____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    // ________ 11______
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+});
+// clang-format on
+
+// bytes that may start a White_Space char: 0x09-0x0D and 0x20, or the leads 0xC2 (U+0085,
+// U+00A0) and 0xE1-0xE3 (U+1680, U+2000-U+205F, U+3000), a bit per kind in both nibble tables
+constexpr auto SPACE_HIGH = std::to_array<std::uint8_t>({
+    1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 0,
+});
+constexpr auto SPACE_LOW = std::to_array<std::uint8_t>({
+    2, 8, 4 | 8, 8, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+});
+
+// bit of the high nibble of an ascii byte in the rows of a `char_set` bitmap,
+// zero for the other bytes so they are never in it
+constexpr auto ASCII_BIT = std::to_array<std::uint8_t>({
+    1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+});
+
+// 1 for `A`-`O` and 2 for `P`-`Z` by the nibbles of a byte (`LOWER_HIGH` is for `a`-`z`),
+// then `0x20` for either of them: the bit that changes the case of an ascii letter
+constexpr auto UPPER_HIGH = std::to_array<std::uint8_t>({
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+});
+constexpr auto LOWER_HIGH = std::to_array<std::uint8_t>({
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+});
+constexpr auto LETTER_LOW = std::to_array<std::uint8_t>({
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1,
+});
+constexpr auto CASE_BIT = std::to_array<std::uint8_t>({
+    0, 0x20, 0x20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+});
+
+// places of the set bits of a byte, then 8 for the rest: the char leads of 8 bytes
+constexpr auto LEAD_PLACES = [] {
+  std::array<std::array<std::uint8_t, 8>, 256> table{};
+  for (size_t bits = 0; bits < 256; bits++) {
+    size_t n = 0;
+    for (std::uint8_t i = 0; i < 8; i++) {
+      if (bits >> i & 1) {
+        table[bits][n++] = i;
+      }
+    }
+    for (; n < 8; n++) {
+      table[bits][n] = 8;
+    }
+  }
+  return table;
+}();
+
+// shuffle that joins the `LEAD_PLACES` of 2 halves with `n` leads in the low one:
+// its `n` places, then the 8 of the high half (the last of them fills the rest)
+constexpr auto MERGE_PLACES = [] {
+  std::array<std::array<std::uint8_t, 16>, 9> table{};
+  for (std::uint8_t n = 0; n <= 8; n++) {
+    for (std::uint8_t i = 0; i < 16; i++) {
+      table[n][i] = std::uint8_t(i < n ? i : std::min(8 + i - n, 15));
+    }
+  }
+  return table;
+}();
+
+// bytes per iteration of every kernel, so each one can stop at the same blocks
+constexpr size_t BLOCK = 64;
+
+struct leads_t {
+  size_t bytes;
+  size_t leads;
+};
+
+struct found_t {
+  size_t bytes;
+  size_t count;
+};
+
+// nibble masks of the fingerprints of up to 8 patterns, a bit per pattern:
+// byte `k` of a fingerprint matches if both of its nibbles have the bit in `low[k]`, `high[k]`
+struct teddy_t {
+  std::array<std::array<std::uint8_t, 16>, 3> low{}, high{};
+  size_t len = 0;  // bytes in each fingerprint, 1-3
+};
+
+}  // namespace utf8::noexport::simd
+
+#ifdef _UTF8_SIMD_X86
+#include "simd/sse42.h"
+#include "simd/avx2.h"
+#include "simd/avx512.h"
+#endif
+
+namespace utf8::noexport::simd {
+
+inline auto detect() noexcept -> isa {
+#ifdef _UTF8_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+    return isa::avx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return isa::avx2;
+  }
+  if (__builtin_cpu_supports("sse4.2")) {
+    return isa::sse42;
+  }
+#endif
+  return isa::none;
+}
+
+// resolved once per process
+inline auto best() noexcept -> isa {
+  static const auto best = detect();
+  return best;
+}
+
+#ifdef _UTF8_SIMD_X86
+// pointer to `$kernel` of the best instruction set or to `$fallback`
+#define _UTF8_SIMD_DISPATCH($kernel, $fallback) \
+  [] {                                          \
+    switch (best()) {                           \
+      case isa::avx512:                         \
+        return &avx512::$kernel;                \
+      case isa::avx2:                           \
+        return &avx2::$kernel;                  \
+      case isa::sse42:                          \
+        return &sse42::$kernel;                 \
+      default:                                  \
+        return +$fallback;                      \
+    }                                           \
+  }()
+#else
+#define _UTF8_SIMD_DISPATCH($kernel, $fallback) (+$fallback)
+#endif
+
+// every char that ends before the returned offset is valid UTF-8,
+// the offset itself is a multiple of `BLOCK` and may split a char
+inline auto validate_prefix(const char* data, size_t len) noexcept -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      validate_prefix, [](const char*, size_t) noexcept -> size_t { return 0; });
+  return kernel(data, len);
+}
+
+// whole buffer at once without looking for the error position,
+// `nullopt` if there is no SIMD kernel
+inline auto is_valid(const char* data, size_t len) noexcept -> std::optional<bool> {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      is_valid, [](const char*, size_t) noexcept -> std::optional<bool> { return std::nullopt; });
+  return kernel(data, len);
+}
+
+// whole blocks from the beginning while they have at most `limit` chars,
+// `SIZE_MAX` counts all of them
+inline auto skip_leads(const char* data, size_t len, size_t limit) noexcept -> leads_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      skip_leads, [](const char*, size_t, size_t) noexcept { return leads_t{}; });
+  return kernel(data, len, limit);
+}
+
+// whole registers from the beginning while none of their bytes may start a White_Space char,
+// returns the first byte that may (or the end of the registers)
+inline auto skip_non_space(const char* data, size_t len) noexcept -> size_t {
+  static const auto kernel =
+      _UTF8_SIMD_DISPATCH(skip_non_space, [](const char*, size_t) noexcept -> size_t { return 0; });
+  return kernel(data, len);
+}
+
+// first byte of whole registers from the beginning that is (or with `in` unset is not)
+// an ascii char of the bitmap `rows` (or the end of the registers)
+inline auto find_ascii(const char* data, size_t len, const std::array<std::uint8_t, 16>& rows,
+                       bool in) noexcept -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      find_ascii,
+      [](const char*, size_t, const std::array<std::uint8_t, 16>&, bool) noexcept -> size_t {
+        return 0;
+      });
+  return kernel(data, len, rows, in);
+}
+
+// the same from the end, returns the byte after the found one (or the start of the registers)
+inline auto rfind_ascii(const char* data, size_t len, const std::array<std::uint8_t, 16>& rows,
+                        bool in) noexcept -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      rfind_ascii,
+      [](const char*, size_t len, const std::array<std::uint8_t, 16>&, bool) noexcept -> size_t {
+        return len;
+      });
+  return kernel(data, len, rows, in);
+}
+
+// first place of whole registers from the beginning where a fingerprint of `teddy` may start
+// (or the end of the registers)
+inline auto find_teddy(const char* data, size_t len, const teddy_t& teddy) noexcept -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      find_teddy, [](const char*, size_t, const teddy_t&) noexcept -> size_t { return 0; });
+  return kernel(data, len, teddy);
+}
+
+// first place of whole registers from the beginning where a needle of at least 2 bytes starts
+// (or the end of the registers)
+inline auto find_substr(const char* data, size_t len, const char* needle, size_t n) noexcept
+    -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      find_substr, [](const char*, size_t, const char*, size_t) noexcept -> size_t { return 0; });
+  return kernel(data, len, needle, n);
+}
+
+// the same from the end, returns the end of the found needle (or the end of what is left)
+inline auto rfind_substr(const char* data, size_t len, const char* needle, size_t n) noexcept
+    -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      rfind_substr,
+      [](const char*, size_t len, const char*, size_t) noexcept -> size_t { return len; });
+  return kernel(data, len, needle, n);
+}
+
+// first place of whole registers from the beginning where the encoded char `bytes` of `n`
+// bytes starts (or the end of the registers)
+inline auto find_encoded(const char* data, size_t len, const char* bytes, size_t n) noexcept
+    -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      find_encoded, [](const char*, size_t, const char*, size_t) noexcept -> size_t { return 0; });
+  return kernel(data, len, bytes, n);
+}
+
+// the same from the end, returns the end of the found char (or the end of what is left)
+inline auto rfind_encoded(const char* data, size_t len, const char* bytes, size_t n) noexcept
+    -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      rfind_encoded,
+      [](const char*, size_t len, const char*, size_t) noexcept -> size_t { return len; });
+  return kernel(data, len, bytes, n);
+}
+
+// the encoded char `bytes` that start in whole registers from the beginning
+inline auto count_encoded(const char* data, size_t len, const char* bytes, size_t n) noexcept
+    -> found_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      count_encoded, [](const char*, size_t, const char*, size_t) noexcept { return found_t{}; });
+  return kernel(data, len, bytes, n);
+}
+
+// bytes from the beginning of both while they are ascii and equal ignoring case,
+// up to the end of the whole registers
+inline auto icase_prefix(const char* a, const char* b, size_t len) noexcept -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      icase_prefix, [](const char*, const char*, size_t) noexcept -> size_t { return 0; });
+  return kernel(a, b, len);
+}
+
+// the case of ascii letters of the bytes from the beginning changed while they are ascii,
+// up to the end of the whole registers, `letters` is `UPPER_HIGH` or `LOWER_HIGH` for the ones
+// to change, `dst` (`data` itself too) must have room for all of them
+inline auto convert_ascii(const char* data, size_t len, char* dst,
+                          const std::array<std::uint8_t, 16>& letters) noexcept -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      convert_ascii,
+      [](const char*, size_t, char*, const std::array<std::uint8_t, 16>&) noexcept -> size_t {
+        return 0;
+      });
+  return kernel(data, len, dst, letters);
+}
+
+// first place of whole registers from the beginning with any of three bytes
+// (or the end of the registers)
+inline auto find_any_byte(const char* data, size_t len, char a, char b, char c) noexcept
+    -> size_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      find_any_byte, [](const char*, size_t, char, char, char) noexcept -> size_t { return 0; });
+  return kernel(data, len, a, b, c);
+}
+
+}  // namespace utf8::noexport::simd
@@ -0,0 +1,79 @@
+#pragma once
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace utf8::noexport::simd::avx2 {
+
+struct vec {
+  using reg = __m256i;
+  static constexpr size_t width = 32;
+
+  static auto load(const void* ptr) noexcept -> reg {
+    return _mm256_loadu_si256(static_cast<const reg*>(ptr));
+  }
+
+  static void store(void* ptr, reg x) noexcept {
+    _mm256_storeu_si256(static_cast<reg*>(ptr), x);
+  }
+
+  static auto splat(std::uint8_t byte) noexcept -> reg {
+    return _mm256_set1_epi8(char(byte));
+  }
+
+  static auto lookup(const std::array<std::uint8_t, 16>& table, reg idx) noexcept -> reg {
+    auto lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data()));
+    return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(lane), idx);
+  }
+
+  static auto shr4(reg x) noexcept -> reg {
+    return _mm256_and_si256(_mm256_srli_epi16(x, 4), splat(0x0F));
+  }
+
+  // `N` last bytes of `prev` followed by the beginning of `input`
+  template <int N>
+  static auto prev(reg input, reg prev) noexcept -> reg {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+  }
+
+  static auto subs(reg a, reg b) noexcept -> reg {
+    return _mm256_subs_epu8(a, b);
+  }
+
+  static auto any(reg x) noexcept -> bool {
+    return not _mm256_testz_si256(x, x);
+  }
+
+  static auto is_ascii(reg x) noexcept -> bool {
+    return _mm256_movemask_epi8(x) == 0;
+  }
+
+  // bit per byte that starts a char (all but `10______`)
+  static auto leads(reg x) noexcept -> std::uint64_t {
+    return unsigned(_mm256_movemask_epi8(_mm256_cmpgt_epi8(x, _mm256_set1_epi8(-0x41))));
+  }
+
+  // bit per nonzero byte
+  static auto nonzero(reg x) noexcept -> std::uint64_t {
+    return ~unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_setzero_si256())));
+  }
+
+  // bit per byte that is the same in both
+  static auto equal(reg a, reg b) noexcept -> std::uint64_t {
+    return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+  }
+};
+
+#include "kernels.h"
+
+}  // namespace utf8::noexport::simd::avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,81 @@
+#pragma once
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f,avx512bw"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw")
+#endif
+
+namespace utf8::noexport::simd::avx512 {
+
+struct vec {
+  using reg = __m512i;
+  static constexpr size_t width = 64;
+
+  static auto load(const void* ptr) noexcept -> reg {
+    return _mm512_loadu_si512(ptr);
+  }
+
+  static void store(void* ptr, reg x) noexcept {
+    _mm512_storeu_si512(ptr, x);
+  }
+
+  static auto splat(std::uint8_t byte) noexcept -> reg {
+    return _mm512_set1_epi8(char(byte));
+  }
+
+  static auto lookup(const std::array<std::uint8_t, 16>& table, reg idx) noexcept -> reg {
+    auto lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data()));
+    return _mm512_shuffle_epi8(_mm512_maskz_broadcast_i32x4(0xFFFF, lane), idx);
+  }
+
+  static auto shr4(reg x) noexcept -> reg {
+    return _mm512_and_si512(_mm512_srli_epi16(x, 4), splat(0x0F));
+  }
+
+  // `N` last bytes of `prev` followed by the beginning of `input`
+  template <int N>
+  static auto prev(reg input, reg prev) noexcept -> reg {
+    // 128-bit lanes: [prev.3, input.0, input.1, input.2]
+    auto shifted = _mm512_permutex2var_epi64(input, _mm512_set_epi64(5, 4, 3, 2, 1, 0, 15, 14), prev);
+    return _mm512_alignr_epi8(input, shifted, 16 - N);
+  }
+
+  static auto subs(reg a, reg b) noexcept -> reg {
+    return _mm512_subs_epu8(a, b);
+  }
+
+  static auto any(reg x) noexcept -> bool {
+    return _mm512_test_epi8_mask(x, x) != 0;
+  }
+
+  static auto is_ascii(reg x) noexcept -> bool {
+    return _mm512_movepi8_mask(x) == 0;
+  }
+
+  // bit per byte that starts a char (all but `10______`)
+  static auto leads(reg x) noexcept -> std::uint64_t {
+    return _mm512_cmpgt_epi8_mask(x, _mm512_set1_epi8(-0x41));
+  }
+
+  // bit per nonzero byte
+  static auto nonzero(reg x) noexcept -> std::uint64_t {
+    return _mm512_test_epi8_mask(x, x);
+  }
+
+  // bit per byte that is the same in both
+  static auto equal(reg a, reg b) noexcept -> std::uint64_t {
+    return _mm512_cmpeq_epi8_mask(a, b);
+  }
+};
+
+#include "kernels.h"
+
+}  // namespace utf8::noexport::simd::avx512
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,410 @@
+// Kernels shared by every instruction set, this file is included into the namespace of each
+// of them (sse42.h, avx2.h, avx512.h) after its `vec` operations, so it has no include guard
+
+struct utf8_checker {
+  using reg = vec::reg;
+
+  // last three bytes of a register must not start a char that needs more bytes
+  static constexpr auto INCOMPLETE = [] {
+    std::array<std::uint8_t, vec::width> bound{};
+    bound.fill(0xFF);
+    bound[vec::width - 3] = 0xF0 - 1;
+    bound[vec::width - 2] = 0xE0 - 1;
+    bound[vec::width - 1] = 0xC0 - 1;
+    return bound;
+  }();
+
+  reg error, prev_input, prev_incomplete;
+
+  // user-provided to be compiled for the target instruction set
+  utf8_checker() noexcept
+      : error(vec::splat(0)), prev_input(vec::splat(0)), prev_incomplete(vec::splat(0)) {}
+
+  static auto special_cases(reg input, reg prev1) noexcept -> reg {
+    auto byte_1_high = vec::lookup(BYTE_1_HIGH, vec::shr4(prev1));
+    auto byte_1_low = vec::lookup(BYTE_1_LOW, prev1 & vec::splat(0x0F));
+    auto byte_2_high = vec::lookup(BYTE_2_HIGH, vec::shr4(input));
+    return byte_1_high & byte_1_low & byte_2_high;
+  }
+
+  static auto multibyte_lengths(reg input, reg prev_input, reg special) noexcept -> reg {
+    auto prev2 = vec::prev<2>(input, prev_input);
+    auto prev3 = vec::prev<3>(input, prev_input);
+    // only 111_____ and 1111____ leads become >= 0x80
+    auto is_third_byte = vec::subs(prev2, vec::splat(0xE0 - 0x80));
+    auto is_fourth_byte = vec::subs(prev3, vec::splat(0xF0 - 0x80));
+    auto must_be_cont = (is_third_byte | is_fourth_byte) & vec::splat(0x80);
+    return must_be_cont ^ special;
+  }
+
+  void check(reg input) noexcept {
+    auto prev1 = vec::prev<1>(input, prev_input);
+    error = error | multibyte_lengths(input, prev_input, special_cases(input, prev1));
+    prev_input = input;
+  }
+
+  void check_block(const char* ptr) noexcept {
+    constexpr auto N = BLOCK / vec::width;
+
+    reg input[N];
+    auto high = vec::splat(0);
+    for (size_t i = 0; i < N; i++) {
+      input[i] = vec::load(ptr + i * vec::width);
+      high = high | input[i];
+    }
+
+    if (vec::is_ascii(high)) {
+      error = error | prev_incomplete;
+      prev_incomplete = vec::splat(0);
+      prev_input = input[N - 1];
+    } else {
+      for (auto chunk : input) {
+        check(chunk);
+      }
+      prev_incomplete = vec::subs(input[N - 1], vec::load(INCOMPLETE.data()));
+    }
+  }
+};
+
+inline auto validate_prefix(const char* data, size_t len) noexcept -> size_t {
+  utf8_checker checker;
+
+  size_t pos = 0;
+  for (; pos + BLOCK <= len; pos += BLOCK) {
+    checker.check_block(data + pos);
+    if (vec::any(checker.error)) {
+      break;
+    }
+  }
+  return pos;
+}
+
+// accumulates errors over the whole buffer, the tail is padded with zeros (ascii)
+inline auto is_valid(const char* data, size_t len) noexcept -> std::optional<bool> {
+  utf8_checker checker;
+
+  size_t pos = 0;
+  for (; pos + BLOCK <= len; pos += BLOCK) {
+    checker.check_block(data + pos);
+  }
+  if (pos < len) {
+    char tail[BLOCK] = {};
+    std::memcpy(tail, data + pos, len - pos);
+    checker.check_block(tail);
+  }
+  return not vec::any(checker.error | checker.prev_incomplete);
+}
+
+inline auto block_leads(const char* ptr) noexcept -> size_t {
+  size_t count = 0;
+  for (size_t i = 0; i < BLOCK / vec::width; i++) {
+    count += std::popcount(vec::leads(vec::load(ptr + i * vec::width)));
+  }
+  return count;
+}
+
+// skips whole blocks while they have at most `limit` char leads in total,
+// returns the bytes skipped and the leads in them
+inline auto skip_leads(const char* data, size_t len, size_t limit) noexcept -> leads_t {
+  leads_t done{0, 0};
+  for (; done.bytes + BLOCK <= len; done.bytes += BLOCK) {
+    auto count = block_leads(data + done.bytes);
+    if (done.leads + count > limit) {
+      break;
+    }
+    done.leads += count;
+  }
+  return done;
+}
+
+inline auto skip_non_space(const char* data, size_t len) noexcept -> size_t {
+  size_t pos = 0;
+  for (; pos + vec::width <= len; pos += vec::width) {
+    auto input = vec::load(data + pos);
+    auto kinds = vec::lookup(SPACE_HIGH, vec::shr4(input)) &
+                 vec::lookup(SPACE_LOW, input & vec::splat(0x0F));
+    if (auto found = vec::nonzero(kinds)) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+// bit per byte of `input` that is an ascii char of the bitmap `rows`
+inline auto ascii_hits(vec::reg input, const std::array<std::uint8_t, 16>& rows) noexcept
+    -> std::uint64_t {
+  return vec::nonzero(vec::lookup(rows, input & vec::splat(0x0F)) &
+                      vec::lookup(ASCII_BIT, vec::shr4(input)));
+}
+
+inline auto find_ascii(const char* data, size_t len, const std::array<std::uint8_t, 16>& rows,
+                       bool in) noexcept -> size_t {
+  std::uint64_t flip = in ? 0 : ~std::uint64_t(0) >> (64 - vec::width);
+  size_t pos = 0;
+  for (; pos + vec::width <= len; pos += vec::width) {
+    if (auto found = ascii_hits(vec::load(data + pos), rows) ^ flip) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+inline auto rfind_ascii(const char* data, size_t len, const std::array<std::uint8_t, 16>& rows,
+                        bool in) noexcept -> size_t {
+  std::uint64_t flip = in ? 0 : ~std::uint64_t(0) >> (64 - vec::width);
+  size_t end = len;
+  for (; end >= vec::width; end -= vec::width) {
+    if (auto found = ascii_hits(vec::load(data + end - vec::width), rows) ^ flip) {
+      return end - vec::width + std::bit_width(found);
+    }
+  }
+  return end;
+}
+
+inline auto find_teddy(const char* data, size_t len, const teddy_t& teddy) noexcept -> size_t {
+  size_t pos = 0;
+  for (; pos + teddy.len - 1 + vec::width <= len; pos += vec::width) {
+    auto bits = vec::splat(0xFF);
+    for (size_t k = 0; k < teddy.len; k++) {
+      auto input = vec::load(data + pos + k);
+      bits = bits & vec::lookup(teddy.low[k], input & vec::splat(0x0F)) &
+             vec::lookup(teddy.high[k], vec::shr4(input));
+    }
+    if (auto found = vec::nonzero(bits)) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+// the "SIMD-friendly" substring search of Wojciech Mula: places where both the first
+// and the last byte of the needle match are compared in full
+inline auto find_substr(const char* data, size_t len, const char* needle, size_t n) noexcept
+    -> size_t {
+  auto first = vec::splat(needle[0]);
+  auto last = vec::splat(needle[n - 1]);
+  size_t pos = 0;
+  for (; pos + n - 1 + vec::width <= len; pos += vec::width) {
+    auto found = vec::equal(vec::load(data + pos), first) &
+                 vec::equal(vec::load(data + pos + n - 1), last);
+    for (; found != 0; found &= found - 1) {
+      auto at = pos + std::countr_zero(found);
+      if (std::memcmp(data + at + 1, needle + 1, n - 2) == 0) {
+        return at;
+      }
+    }
+  }
+  return pos;
+}
+
+inline auto rfind_substr(const char* data, size_t len, const char* needle, size_t n) noexcept
+    -> size_t {
+  auto first = vec::splat(needle[0]);
+  auto last = vec::splat(needle[n - 1]);
+  size_t end = len;  // of the needle
+  for (; end >= n - 1 + vec::width; end -= vec::width) {
+    auto pos = end - n + 1 - vec::width;
+    auto found = vec::equal(vec::load(data + pos), first) &
+                 vec::equal(vec::load(data + pos + n - 1), last);
+    while (found != 0) {
+      auto bit = std::bit_width(found) - 1;
+      found ^= std::uint64_t(1) << bit;
+      if (std::memcmp(data + pos + bit + 1, needle + 1, n - 2) == 0) {
+        return pos + bit + n;
+      }
+    }
+  }
+  return end;
+}
+
+// every byte of an encoded char is compared in its own register shifted by its place,
+// so a match needs no verification (chars of UTF-8 never overlap)
+struct encoded_char {
+  vec::reg bytes[4];
+  size_t n;
+
+  encoded_char(const char* encoded, size_t n) noexcept : n(n) {
+    for (size_t k = 0; k < n; k++) {
+      bytes[k] = vec::splat(encoded[k]);
+    }
+  }
+
+  auto starts(const char* ptr) const noexcept -> std::uint64_t {
+    auto found = vec::equal(vec::load(ptr), bytes[0]);
+    for (size_t k = 1; k < n; k++) {
+      found &= vec::equal(vec::load(ptr + k), bytes[k]);
+    }
+    return found;
+  }
+};
+
+inline auto find_encoded(const char* data, size_t len, const char* bytes, size_t n) noexcept
+    -> size_t {
+  encoded_char ch(bytes, n);
+  size_t pos = 0;
+  for (; pos + n - 1 + vec::width <= len; pos += vec::width) {
+    if (auto found = ch.starts(data + pos)) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+inline auto rfind_encoded(const char* data, size_t len, const char* bytes, size_t n) noexcept
+    -> size_t {
+  encoded_char ch(bytes, n);
+  size_t end = len;
+  for (; end >= n - 1 + vec::width; end -= vec::width) {
+    auto pos = end - n + 1 - vec::width;
+    if (auto found = ch.starts(data + pos)) {
+      return pos + std::bit_width(found) - 1 + n;
+    }
+  }
+  return end;
+}
+
+inline auto count_encoded(const char* data, size_t len, const char* bytes, size_t n) noexcept
+    -> found_t {
+  encoded_char ch(bytes, n);
+  found_t done{0, 0};
+  for (; done.bytes + n - 1 + vec::width <= len; done.bytes += vec::width) {
+    done.count += std::popcount(ch.starts(data + done.bytes));
+  }
+  return done;
+}
+
+// ascii letters of `input` that `letters` selects with their case changed, other bytes stay
+inline auto change_case(vec::reg input, const std::array<std::uint8_t, 16>& letters) noexcept
+    -> vec::reg {
+  auto found = vec::lookup(letters, vec::shr4(input)) &
+               vec::lookup(LETTER_LOW, input & vec::splat(0x0F));
+  return input ^ vec::lookup(CASE_BIT, found);
+}
+
+inline auto icase_prefix(const char* a, const char* b, size_t len) noexcept -> size_t {
+  size_t pos = 0;
+  for (; pos + vec::width <= len; pos += vec::width) {
+    auto x = vec::load(a + pos);
+    auto y = vec::load(b + pos);
+    auto diff = (change_case(x, UPPER_HIGH) ^ change_case(y, UPPER_HIGH)) |
+                ((x | y) & vec::splat(0x80));
+    if (auto found = vec::nonzero(diff)) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+// `dst` takes whole registers, even the one with the first non-ascii byte
+inline auto convert_ascii(const char* data, size_t len, char* dst,
+                          const std::array<std::uint8_t, 16>& letters) noexcept -> size_t {
+  size_t pos = 0;
+  for (; pos + vec::width <= len; pos += vec::width) {
+    auto input = vec::load(data + pos);
+    vec::store(dst + pos, change_case(input, letters));
+    if (auto found = vec::nonzero(input & vec::splat(0x80))) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+inline auto find_any_byte(const char* data, size_t len, char a, char b, char c) noexcept
+    -> size_t {
+  auto first = vec::splat(a), second = vec::splat(b), third = vec::splat(c);
+  size_t pos = 0;
+  for (; pos + vec::width <= len; pos += vec::width) {
+    auto input = vec::load(data + pos);
+    if (auto found = vec::equal(input, first) | vec::equal(input, second) |
+                     vec::equal(input, third)) {
+      return pos + std::countr_zero(found);
+    }
+  }
+  return pos;
+}
+
+// the code of a char in each 32-bit lane of `x`: its last byte in the lowest one, its lead
+// in the highest one it has, zeros above
+[[gnu::always_inline]] inline auto lane_codes(__m128i x) noexcept -> __m128i {
+  auto code = _mm_and_si128(x, _mm_set1_epi32(0x7F));
+  code = _mm_or_si128(code, _mm_srli_epi32(_mm_and_si128(x, _mm_set1_epi32(0x3F00)), 2));
+  // the third byte is a continuation only in the lanes of 4-byte chars (the lead is in the top)
+  auto third = _mm_or_si128(_mm_set1_epi32(0x0F0000),
+                            _mm_and_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(0x300000)));
+  code = _mm_or_si128(code, _mm_srli_epi32(_mm_and_si128(x, third), 4));
+  return _mm_or_si128(code, _mm_srli_epi32(_mm_and_si128(x, _mm_set1_epi32(0x07000000)), 6));
+}
+
+// codes of the chars `4 * G`..`4 * G + 3` of `bytes`, `starts` has the place of the lead
+// of every char and then the place after the last one
+template <int G>
+[[gnu::always_inline]] inline auto group_codes(__m128i bytes, __m128i starts) noexcept
+    -> __m128i {
+  constexpr char i = 4 * G;
+  // the place of the lead and of the end of 4 chars broadcast to the bytes of their lanes
+  auto group = _mm_setr_epi8(i, i, i, i, i + 1, i + 1, i + 1, i + 1, i + 2, i + 2, i + 2, i + 2,
+                             i + 3, i + 3, i + 3, i + 3);
+  auto start = _mm_shuffle_epi8(starts, group);
+  auto end = _mm_shuffle_epi8(_mm_srli_si128(starts, 1), group);
+  // the bytes of a char from its end, the places before its lead give zeros
+  auto idx = _mm_sub_epi8(end, _mm_setr_epi8(1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4));
+  return lane_codes(_mm_shuffle_epi8(bytes, _mm_or_si128(idx, _mm_cmpgt_epi8(start, idx))));
+}
+
+// 16 bytes per step on every instruction set: the bytes of each char are moved into its own
+// 32-bit lane by a shuffle of the whole register, so chars of any width are decoded
+// without a branch per lane, `src` must start at a char boundary and stays at one,
+// `dst` takes whole registers
+inline auto decode_utf32(const char* src, size_t len, std::uint32_t* dst, size_t cap) noexcept
+    -> leads_t {
+  size_t pos = 0, out = 0;
+  while (pos + 16 <= len && out + 16 <= cap) {
+    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+    auto lanes = reinterpret_cast<__m128i*>(dst + out);
+    if (not _mm_movemask_epi8(bytes)) {
+      _mm_storeu_si128(lanes, _mm_cvtepu8_epi32(bytes));
+      _mm_storeu_si128(lanes + 1, _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4)));
+      _mm_storeu_si128(lanes + 2, _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+      _mm_storeu_si128(lanes + 3, _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12)));
+      pos += 16;
+      out += 16;
+      continue;
+    }
+
+    auto leads = unsigned(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(-0x41))));
+    // 110xxxxx 10xxxxxx in every 16-bit lane, only the last lead may start a longer char
+    if (leads == 0x5555 && std::uint8_t(src[pos + 14]) < 0xE0) {
+      auto lead = _mm_and_si128(bytes, _mm_set1_epi16(0x1F));
+      auto cont = _mm_and_si128(_mm_srli_epi16(bytes, 8), _mm_set1_epi16(0x3F));
+      auto codes = _mm_or_si128(_mm_slli_epi16(lead, 6), cont);
+      _mm_storeu_si128(lanes, _mm_cvtepu16_epi32(codes));
+      _mm_storeu_si128(lanes + 1, _mm_cvtepu16_epi32(_mm_srli_si128(codes, 8)));
+      pos += 16;
+      out += 8;
+      continue;
+    }
+
+    // places of the leads and then 16, a char ends at the place of the next lead
+    auto low = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(LEAD_PLACES[leads & 0xFF].data()));
+    auto high = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(LEAD_PLACES[leads >> 8].data()));
+    auto merge = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(MERGE_PLACES[std::popcount(leads & 0xFF)].data()));
+    auto starts = _mm_shuffle_epi8(
+        _mm_unpacklo_epi64(low, _mm_add_epi8(high, _mm_set1_epi8(8))), merge);
+
+    // chars that start in the first 13 bytes end in the 16, only the groups of 4 lanes
+    // with one of them are decoded, the lanes after the last one are overwritten by the next step
+    auto chars = size_t(std::popcount(leads & 0x1FFF));
+    _mm_storeu_si128(lanes, group_codes<0>(bytes, starts));
+    if (chars > 4) {
+      _mm_storeu_si128(lanes + 1, group_codes<1>(bytes, starts));
+    }
+    if (chars > 8) {
+      _mm_storeu_si128(lanes + 2, group_codes<2>(bytes, starts));
+      _mm_storeu_si128(lanes + 3, group_codes<3>(bytes, starts));
+    }
+    pos += 13 + size_t(std::countr_zero((leads | 0x10000) >> 13));
+    out += chars;
+  }
+  return {pos, out};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+#endif
+
+namespace utf8::noexport::simd::sse42 {
+
+struct vec {
+  using reg = __m128i;
+  static constexpr size_t width = 16;
+
+  static auto load(const void* ptr) noexcept -> reg {
+    return _mm_loadu_si128(static_cast<const reg*>(ptr));
+  }
+
+  static void store(void* ptr, reg x) noexcept {
+    _mm_storeu_si128(static_cast<reg*>(ptr), x);
+  }
+
+  static auto splat(std::uint8_t byte) noexcept -> reg {
+    return _mm_set1_epi8(char(byte));
+  }
+
+  static auto lookup(const std::array<std::uint8_t, 16>& table, reg idx) noexcept -> reg {
+    return _mm_shuffle_epi8(load(table.data()), idx);
+  }
+
+  static auto shr4(reg x) noexcept -> reg {
+    return _mm_and_si128(_mm_srli_epi16(x, 4), splat(0x0F));
+  }
+
+  // `N` last bytes of `prev` followed by the beginning of `input`
+  template <int N>
+  static auto prev(reg input, reg prev) noexcept -> reg {
+    return _mm_alignr_epi8(input, prev, 16 - N);
+  }
+
+  static auto subs(reg a, reg b) noexcept -> reg {
+    return _mm_subs_epu8(a, b);
+  }
+
+  static auto any(reg x) noexcept -> bool {
+    return not _mm_testz_si128(x, x);
+  }
+
+  static auto is_ascii(reg x) noexcept -> bool {
+    return _mm_movemask_epi8(x) == 0;
+  }
+
+  // bit per byte that starts a char (all but `10______`)
+  static auto leads(reg x) noexcept -> std::uint64_t {
+    return unsigned(_mm_movemask_epi8(_mm_cmpgt_epi8(x, _mm_set1_epi8(-0x41))));
+  }
+
+  // bit per nonzero byte
+  static auto nonzero(reg x) noexcept -> std::uint64_t {
+    return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_setzero_si128()))) ^ 0xFFFF;
+  }
+
+  // bit per byte that is the same in both
+  static auto equal(reg a, reg b) noexcept -> std::uint64_t {
+    return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+  }
+};
+
+#include "kernels.h"
+
+}  // namespace utf8::noexport::simd::sse42
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <bit>      // std::countr_one
+#include <cstdint>  // std::uint16_t | std::uint32_t
+#include <cstring>  // std::memcpy
+#include <utility>  // std::pair
+
+// SSE2 is a part of x86-64, so these blocks need no runtime dispatch
+#if defined(_UTF8_SIMD_X86) && defined(__SSE2__)
+#define _UTF8_SIMD_SSE2
+#endif
+
+namespace utf8::noexport {
+
+#ifdef _UTF8_SIMD_SSE2
+namespace sse2 {
+// 8 16-bit lanes as UTF-16 units or as UTF-32 codes
+template <typename Unit>
+inline void store_units(__m128i lanes, Unit* dst) noexcept {
+  auto out = reinterpret_cast<__m128i*>(dst);
+  if constexpr (sizeof(Unit) == 2) {
+    _mm_storeu_si128(out, lanes);
+  } else {
+    _mm_storeu_si128(out, _mm_unpacklo_epi16(lanes, _mm_setzero_si128()));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lanes, _mm_setzero_si128()));
+  }
+}
+
+// code of the char at every byte of `bytes` as if each of them were a lead of a char
+// of up to 3 bytes, in 16-bit lanes for the first 8 bytes (`Half` 0) or the next 8
+template <int Half>
+inline auto decode_lanes(__m128i bytes) noexcept -> __m128i {
+  auto zero = _mm_setzero_si128();
+  auto widen = [&](__m128i x) {
+    return Half == 0 ? _mm_unpacklo_epi8(x, zero) : _mm_unpackhi_epi8(x, zero);
+  };
+  auto lead = widen(bytes);
+  auto cont_1 = _mm_and_si128(widen(_mm_srli_si128(bytes, 1)), _mm_set1_epi16(0x3F));
+  auto cont_2 = _mm_and_si128(widen(_mm_srli_si128(bytes, 2)), _mm_set1_epi16(0x3F));
+
+  auto is_two = _mm_cmpeq_epi16(_mm_and_si128(lead, _mm_set1_epi16(0xE0)), _mm_set1_epi16(0xC0));
+  auto is_three = _mm_cmpeq_epi16(_mm_and_si128(lead, _mm_set1_epi16(0xF0)), _mm_set1_epi16(0xE0));
+  auto two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(lead, _mm_set1_epi16(0x1F)), 6), cont_1);
+  auto three = _mm_or_si128(_mm_slli_epi16(lead, 12),
+                            _mm_or_si128(_mm_slli_epi16(cont_1, 6), cont_2));
+
+  auto codes = _mm_andnot_si128(_mm_or_si128(is_two, is_three), lead);
+  codes = _mm_or_si128(codes, _mm_and_si128(is_two, two));
+  return _mm_or_si128(codes, _mm_and_si128(is_three, three));
+}
+
+// decodes blocks of 16 ascii bytes, of 8 2-byte chars, of 5 3-byte chars or of 14 bytes
+// with chars of up to 3 bytes, `src` must start at a char boundary and stays at one,
+// stops at a 4-byte char or before writing more than `cap` units,
+// returns the bytes read and the units written
+template <typename Unit>
+inline auto decode_runs(const char* src, size_t len, Unit* dst, size_t cap) noexcept
+    -> std::pair<size_t, size_t> {
+  auto zero = _mm_setzero_si128();
+  auto mask = [](__m128i bytes, int bits, int value) {
+    auto masked = _mm_and_si128(bytes, _mm_set1_epi8(char(bits)));
+    return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(masked, _mm_set1_epi8(char(value)))));
+  };
+
+  size_t pos = 0, out = 0;
+  while (pos + 16 <= len) {
+    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+    if (not _mm_movemask_epi8(bytes)) {
+      if (out + 16 > cap) {
+        break;
+      }
+      store_units(_mm_unpacklo_epi8(bytes, zero), dst + out);
+      store_units(_mm_unpackhi_epi8(bytes, zero), dst + out + 8);
+      pos += 16;
+      out += 16;
+      continue;
+    }
+
+    // 110xxxxx 10xxxxxx in every 16-bit lane: the lead is the low byte
+    auto leads = _mm_cmpeq_epi16(_mm_and_si128(bytes, _mm_set1_epi16(0xE0)), _mm_set1_epi16(0xC0));
+    if (_mm_movemask_epi8(leads) == 0xFFFF && out + 8 <= cap) {
+      auto lead = _mm_and_si128(bytes, _mm_set1_epi16(0x1F));
+      auto cont = _mm_and_si128(_mm_srli_epi16(bytes, 8), _mm_set1_epi16(0x3F));
+      store_units(_mm_or_si128(_mm_slli_epi16(lead, 6), cont), dst + out);
+      pos += 16;
+      out += 8;
+      continue;
+    }
+
+    // chars of up to 3 bytes that start in the first 14 bytes (and end in the 16)
+    if ((mask(bytes, 0xF0, 0xF0) & 0x3FFF) != 0 || out + 14 > cap) {
+      break;
+    }
+    alignas(16) std::uint16_t codes[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(codes), decode_lanes<0>(bytes));
+    _mm_store_si128(reinterpret_cast<__m128i*>(codes + 8), decode_lanes<1>(bytes));
+    auto conts = mask(bytes, 0xC0, 0x80);
+
+    // 3-byte chars at 0, 3, 6, 9 and 12
+    if ((conts & 0x7FFF) == 0b110110110110110) {
+      for (int i = 0; i < 5; i++) {
+        dst[out + i] = codes[3 * i];
+      }
+      pos += 15;
+      out += 5;
+      continue;
+    }
+
+    // any mix of them: every lane is written, but a continuation does not move `dst`,
+    // so it is overwritten by the next char
+    for (int i = 0; i < 14; i++) {
+      dst[out] = codes[i];
+      out += 1 - (conts >> i & 1);
+    }
+    // and the continuations of the last char, the byte after them is a lead
+    pos += 14 + std::countr_one(conts >> 14 & 3);
+  }
+  return {pos, out};
+}
+
+// `narrow` for the blocks with 3-byte chars or with surrogates,
+// kept out of line so that `narrow` itself is small enough to be inlined
+[[gnu::noinline]] inline auto narrow_bmp(__m128i units, char* dst, size_t spare) noexcept
+    -> char* {
+  auto zero = _mm_setzero_si128();
+  auto surrogates = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)),
+                                    _mm_set1_epi16(-0x2800));  // 0xD800
+  if (_mm_movemask_epi8(surrogates) || spare < 2) {
+    return nullptr;
+  }
+
+  // 110xxxxx 10xxxxxx or 1110xxxx 10xxxxxx in a 16-bit lane, and the last 10xxxxxx in another
+  auto low = _mm_or_si128(_mm_and_si128(units, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+  auto mid = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0x3F)),
+                          _mm_set1_epi16(0x80));
+  auto two = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0xC0)),
+                          _mm_slli_epi16(low, 8));
+  auto three = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(units, 12), _mm_set1_epi16(0xE0)),
+                            _mm_slli_epi16(mid, 8));
+
+  auto is_ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x80)), zero);
+  auto two_bytes = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)), zero);
+  auto first = _mm_or_si128(_mm_and_si128(two_bytes, two), _mm_andnot_si128(two_bytes, three));
+  first = _mm_or_si128(_mm_and_si128(is_ascii, units), _mm_andnot_si128(is_ascii, first));
+  alignas(16) std::uint32_t lanes[8];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_unpacklo_epi16(first, low));
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes + 4), _mm_unpackhi_epi16(first, low));
+
+  // every lane is written as 3 bytes, but `dst` only moves by its width
+  auto ascii = unsigned(_mm_movemask_epi8(is_ascii));
+  auto up_to_two = unsigned(_mm_movemask_epi8(two_bytes));
+  for (int lane = 0; lane < 8; lane++) {
+    std::memcpy(dst, &lanes[lane], 3);
+    dst += 3 - (ascii >> (2 * lane) & 1) - (up_to_two >> (2 * lane) & 1);
+  }
+  return dst;
+}
+
+// encodes 8 UTF-16 units and returns the end of them, `spare` bytes past them may be overwritten,
+// `nullptr` without writing anything if there is a surrogate or the block needs more room
+inline auto narrow(__m128i units, char* dst, size_t spare) noexcept -> char* {
+  auto zero = _mm_setzero_si128();
+  auto all = [](__m128i mask) { return _mm_movemask_epi8(mask) == 0xFFFF; };
+
+  auto is_ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x80)), zero);
+  if (all(is_ascii)) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(units, units));
+    return dst + 8;
+  }
+
+  auto two_bytes = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)), zero);
+  if (not all(two_bytes)) {
+    return narrow_bmp(units, dst, spare);
+  }
+
+  // 110xxxxx 10xxxxxx: the lead in the low byte of every lane, its continuation in the high one
+  auto lead = _mm_or_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0xC0));
+  auto cont = _mm_or_si128(_mm_and_si128(units, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+  auto pairs = _mm_or_si128(lead, _mm_slli_epi16(cont, 8));
+  if (not _mm_movemask_epi8(is_ascii)) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), pairs);
+    return dst + 16;
+  }
+  if (spare < 1) {
+    return nullptr;
+  }
+
+  // every lane is written as 2 bytes, but an ascii one only moves `dst` by 1
+  alignas(16) std::uint16_t lanes[8];
+  auto bytes = _mm_or_si128(_mm_and_si128(is_ascii, units), _mm_andnot_si128(is_ascii, pairs));
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), bytes);
+
+  auto ascii = unsigned(_mm_movemask_epi8(is_ascii));
+  for (int lane = 0; lane < 8; lane++) {
+    std::memcpy(dst, &lanes[lane], 2);
+    dst += 2 - (ascii >> (2 * lane) & 1);
+  }
+  return dst;
+}
+
+inline auto narrow(const char16_t* src, char* dst, size_t spare) noexcept -> char* {
+  return narrow(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), dst, spare);
+}
+
+// 8 codes packed into UTF-16 `units` if all of them are valid and below U+10000
+inline auto pack_bmp(const std::uint32_t* src, __m128i& units) noexcept -> bool {
+  auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4));
+
+  // `is_valid_code` for 4 lanes, unsigned compare as signed one with flipped sign bits
+  auto invalid = [](__m128i codes) {
+    auto x = _mm_sub_epi32(_mm_xor_si128(codes, _mm_set1_epi32(0xD800)), _mm_set1_epi32(0x800));
+    auto sign = _mm_set1_epi32(INT32_MIN);
+    return _mm_cmpgt_epi32(_mm_xor_si128(x, sign), _mm_set1_epi32((0x10F800 - 1) ^ INT32_MIN));
+  };
+  auto above_bmp = [](__m128i codes) {
+    return _mm_cmpgt_epi32(codes, _mm_set1_epi32(0xFFFF));  // codes are valid, so not negative
+  };
+  auto bad = _mm_or_si128(_mm_or_si128(invalid(low), invalid(high)),
+                          _mm_or_si128(above_bmp(low), above_bmp(high)));
+  if (_mm_movemask_epi8(bad)) {
+    return false;
+  }
+
+  // `packs` saturates signed values, so move 0..0xFFFF into the signed range and back
+  auto bias = _mm_set1_epi32(0x8000);
+  units = _mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias));
+  units = _mm_add_epi16(units, _mm_set1_epi16(-0x8000));
+  return true;
+}
+}  // namespace sse2
+
+namespace simd {
+// `decode_utf32` of the best instruction set, `sse2::decode_runs` without one,
+// returns the bytes read and the chars written (at most `cap`)
+inline auto decode_utf32(const char* src, size_t len, std::uint32_t* dst, size_t cap) noexcept
+    -> leads_t {
+  static const auto kernel = _UTF8_SIMD_DISPATCH(
+      decode_utf32, [](const char* src, size_t len, std::uint32_t* dst, size_t cap) noexcept {
+        auto runs = sse2::decode_runs(src, len, dst, cap);
+        return leads_t(runs.first, runs.second);
+      });
+  return kernel(src, len, dst, cap);
+}
+}  // namespace simd
+#endif
+
+}  // namespace utf8::noexport
@@ -5,12 +5,21 @@
 namespace utf8::noexport {
 struct unsafe_t {};
 constexpr auto unsafe = unsafe_t{};
+
+constexpr auto is_utf8_bound(char8_t ch) noexcept -> bool {
+  // equivalent to: b < 128 || b >= 192
+  return int8_t(ch) >= -0x40;
+}
 }  // namespace utf8::noexport
 
 namespace utf8 {
 struct mut {};
 struct immut {};
 
+/// tag of the overloads that replace invalid bytes by U+FFFD instead of failing
+struct lossy_t {};
+constexpr auto lossy = lossy_t{};
+
 template <typename T>
 concept qualifier = std::same_as<T, mut> || std::same_as<T, immut>;
 }  // namespace utf8
@@ -1,9 +1,51 @@
 #pragma once
 
+#include <cstring>   // std::memcpy
+#include <expected>  // std::expected
 #include <optional>
 
 namespace utf8 {
 
+namespace noexport {
+constexpr std::uint64_t ASCII_MASK = 0x8080'8080'8080'8080;
+
+// `memcpy` is not allowed in constant evaluation, so assemble little-endian word by hand
+constexpr auto load_word(const char* ptr) noexcept -> std::uint64_t {
+  if consteval {
+    std::uint64_t word = 0;
+    for (int i = 0; i < 8; i++) {
+      word |= std::uint64_t(std::uint8_t(ptr[i])) << (8 * i);
+    }
+    return word;
+  } else {
+    std::uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    return word;
+  }
+}
+
+// bytes that start a char (all but `10xxxxxx`): the high bit is clear or the next one is set
+constexpr auto word_leads(std::uint64_t word) noexcept -> size_t {
+  return size_t(std::popcount((~word | word << 1) & ASCII_MASK));
+}
+
+// index of the first non-ascii byte at or after `pos` (or the end), 8 bytes per iter
+constexpr auto skip_ascii(std::string_view str, size_t pos) noexcept -> size_t {
+  for (; pos + 8 <= str.size(); pos += 8) {
+    if (auto high = load_word(str.data() + pos) & ASCII_MASK) {
+      if (std::endian::native == std::endian::little || std::is_constant_evaluated()) {
+        return pos + std::countr_zero(high) / 8;
+      }
+      break;
+    }
+  }
+  while (pos < str.size() && int8_t(str[pos]) >= 0) {
+    pos++;
+  }
+  return pos;
+}
+}  // namespace noexport
+
 constexpr auto char_width(char8_t ch) -> size_t {
   constexpr auto CHAR_WIDTH = std::to_array<std::uint8_t>({
       // 1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
@@ -39,8 +81,9 @@ struct utf8_error : std::exception {
   }
 };
 
-// we don't need extra-fast algorithm because it is usually used only in consteval
-constexpr auto validate(std::string_view str) noexcept -> std::optional<utf8_error> {
+namespace noexport {
+// byte-at-a-time state machine: used in consteval and to find the exact error position
+constexpr auto validate_scalar(std::string_view str) noexcept -> std::optional<utf8_error> {
   using some = std::optional<size_t>;
 
   auto idx = str.begin();
@@ -73,7 +116,7 @@ constexpr auto validate(std::string_view str) noexcept -> std::optional<utf8_err
           if ((first == 0xE0 && next >= 0xA0 && next <= 0xBF) ||
               (first == 0xED && next >= 0x80 && next <= 0x9F) ||
               (first >= 0xE1 && first <= 0xEC && next >= 0x80 && next <= 0xBF) ||
-              (first >= 0xEE && first <= 0xEF && next >= 0xA0 && next <= 0xBF)) {
+              (first >= 0xEE && first <= 0xEF && next >= 0x80 && next <= 0xBF)) {
           } else {
             ERROR(some(1));
           }
@@ -88,7 +131,7 @@ constexpr auto validate(std::string_view str) noexcept -> std::optional<utf8_err
               (first >= 0xF1 && first <= 0xF3 && next >= 0x80 && next <= 0xBF) ||
               (first == 0xF4 && next >= 0x80 && next <= 0x8F)) {
           } else {
-            ERROR(some(2));
+            ERROR(some(1));
           }
           NEXT_IN(next);
           if (int8_t(next) >= -64) {
@@ -104,14 +147,39 @@ constexpr auto validate(std::string_view str) noexcept -> std::optional<utf8_err
       }
       idx++;
     } else {
-      // todo: skip more ascii characters per iter
-      idx++;
+      idx = str.begin() + noexport::skip_ascii(str, idx - str.begin());
     }
   }
   return std::nullopt;
 }
 #undef ERROR
 
+inline auto validate_fast(std::string_view str) noexcept -> std::optional<utf8_error> {
+  auto from = simd::validate_prefix(str.data(), str.size());
+
+  // step back to the start of a char that may cross the checked prefix
+  for (size_t step = 0; step < 4 && from > 0; step++) {
+    if (is_utf8_bound(str[--from])) {
+      break;
+    }
+  }
+
+  if (auto error = validate_scalar(str.substr(from))) {
+    error->valid_to += from;
+    return error;
+  }
+  return std::nullopt;
+}
+}  // namespace noexport
+
+constexpr auto validate(std::string_view str) noexcept -> std::optional<utf8_error> {
+  if consteval {
+    return noexport::validate_scalar(str);
+  } else {
+    return noexport::validate_fast(str);
+  }
+}
+
 consteval void const_validate(std::string_view str) {
   auto idx = str.begin();
   while (idx != str.end()) {
@@ -129,7 +197,7 @@ consteval void const_validate(std::string_view str) {
           if ((first == 0xE0 && next >= 0xA0 && next <= 0xBF) ||
               (first == 0xED && next >= 0x80 && next <= 0x9F) ||
               (first >= 0xE1 && first <= 0xEC && next >= 0x80 && next <= 0xBF) ||
-              (first >= 0xEE && first <= 0xEF && next >= 0xA0 && next <= 0xBF)) {
+              (first >= 0xEE && first <= 0xEF && next >= 0x80 && next <= 0xBF)) {
           } else {
             throw "invalid character in unicode escape";
           }
@@ -157,8 +225,7 @@ consteval void const_validate(std::string_view str) {
       }
       idx++;
     } else {
-      // todo: skip more ascii characters per iter
-      idx++;
+      idx = str.begin() + noexport::skip_ascii(str, idx - str.begin());
     }
   }
 }
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+
+namespace utf8 {
+
+namespace noexport {
+// smaller parts are not worth a thread
+constexpr size_t MIN_PARALLEL_PART = size_t(1) << 20;
+}  // namespace noexport
+
+/// validates `str` with up to `threads` threads (`0` - one per core),
+/// the result is the same earliest error as of `validate(str)`
+inline auto validate(std::string_view str, size_t threads) -> std::optional<utf8_error> {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  threads = std::min(threads, str.size() / noexport::MIN_PARALLEL_PART);
+  if (threads <= 1) {
+    return validate(str);
+  }
+
+  // parts begin at char boundaries (invalid continuation runs stay in the previous part)
+  std::vector<size_t> bounds(threads + 1, str.size());
+  bounds[0] = 0;
+  for (size_t part = 1; part < threads; part++) {
+    auto pos = std::max(bounds[part - 1], str.size() / threads * part);
+    while (pos < str.size() && not noexport::is_utf8_bound(str[pos])) {
+      pos++;
+    }
+    bounds[part] = pos;
+  }
+
+  std::vector<std::optional<utf8_error>> errors(threads);
+  auto run = [&](size_t part) {
+    errors[part] = validate(str.substr(bounds[part], bounds[part + 1] - bounds[part]));
+  };
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(threads - 1);
+    for (size_t part = 1; part < threads; part++) {
+      workers.emplace_back(run, part);
+    }
+    run(0);
+  }
+
+  for (size_t part = 0; part < threads; part++) {
+    if (auto& error = errors[part]) {
+      auto valid_to = bounds[part] + error->valid_to;
+      if (not error->error_len && bounds[part + 1] != str.size()) {
+        // the char is cut by the next part, look at it as a whole
+        error = validate(str.substr(valid_to));
+        valid_to += error->valid_to;
+      }
+      return utf8_error(valid_to, error->error_len);
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace utf8
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <string>
+
+namespace utf8 {
+
+/// a needle compiled once for `find`, `rfind` and `contains`: short needles are found
+/// with a SIMD filter by their first and last bytes (`find` looks for a rare first byte alone),
+/// long ones with Boyer-Moore-Horspool
+class searcher {
+  static constexpr size_t SHORT = 256;
+  static constexpr size_t SPARSE = 1024;
+
+  std::string _needle;
+  // shifts after the byte under the last byte of the needle (the first one for `rfind`)
+  std::array<std::uint32_t, 256> _skip{}, _rskip{};
+
+  [[nodiscard]] constexpr auto horspool(std::string_view str) const noexcept -> size_t {
+    auto n = _needle.size();
+    for (size_t pos = 0; pos + n <= str.size(); pos += _skip[char8_t(str[pos + n - 1])]) {
+      if (str.substr(pos, n) == _needle) {
+        return pos;
+      }
+    }
+    return str.npos;
+  }
+
+  [[nodiscard]] constexpr auto rhorspool(std::string_view str) const noexcept -> size_t {
+    auto n = _needle.size();
+    if (n > str.size()) {
+      return str.npos;
+    }
+    for (auto pos = str.size() - n;; pos -= _rskip[char8_t(str[pos])]) {
+      if (str.substr(pos, n) == _needle) {
+        return pos;
+      }
+      if (pos < _rskip[char8_t(str[pos])]) {
+        break;
+      }
+    }
+    return str.npos;
+  }
+
+  [[nodiscard]] constexpr auto find(std::string_view str) const noexcept -> size_t {
+    auto n = _needle.size();
+    if (n > SHORT) {
+      return horspool(str);
+    }
+    size_t pos = 0;
+    if not consteval {
+      if (n >= 2) {
+        // `memchr` of the first byte while it is rare (it beats any filter of 2 bytes),
+        // the SIMD filter once there is more than one false hit per `SPARSE` bytes
+        for (size_t misses = 1;; misses++) {
+          pos = str.find(_needle[0], pos);
+          if (pos == str.npos || str.substr(pos, n) == _needle) {
+            return pos;
+          }
+          if (++pos < misses * SPARSE) {
+            break;
+          }
+        }
+        pos += noexport::simd::find_substr(str.data() + pos, str.size() - pos, _needle.data(), n);
+      }
+    }
+    return str.find(_needle, pos);
+  }
+
+  [[nodiscard]] constexpr auto rfind(std::string_view str) const noexcept -> size_t {
+    auto n = _needle.size();
+    if (n > SHORT) {
+      return rhorspool(str);
+    }
+    auto end = str.size();
+    if not consteval {
+      if (n >= 2) {
+        end = noexport::simd::rfind_substr(str.data(), str.size(), _needle.data(), n);
+      }
+    }
+    return str.substr(0, end).rfind(_needle);
+  }
+
+  template <typename Q>
+  friend class basic_string_view;
+
+ public:
+  explicit constexpr searcher(string_view needle) : _needle(needle) {
+    auto n = _needle.size();
+    if (n > SHORT) {
+      _skip.fill(n);
+      _rskip.fill(n);
+      for (size_t i = 0; i + 1 < n; i++) {
+        _skip[char8_t(_needle[i])] = n - 1 - i;
+      }
+      for (size_t i = n - 1; i > 0; i--) {
+        _rskip[char8_t(_needle[i])] = i;
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr auto needle() const noexcept -> string_view {
+    return {noexport::unsafe, _needle};
+  }
+};
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find(const searcher& needle) const noexcept -> size_t {
+  return needle.find(_inner);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::rfind(const searcher& needle) const noexcept -> size_t {
+  return needle.rfind(_inner);
+}
+
+}  // namespace utf8
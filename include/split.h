@@ -0,0 +1,374 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+// a char delimiter keeps its own encoding, so iterators outlive the view they come from
+class char_pattern {
+  std::array<char, 4> _bytes{};
+  size_t _len = 0;
+
+ public:
+  constexpr char_pattern() noexcept = default;
+  explicit constexpr char_pattern(char_t ch) noexcept
+      : _len(std::string_view(ch.encode_utf8(std::span(_bytes))).size()) {}
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_t {
+    return _len;
+  }
+
+  [[nodiscard]] constexpr auto find(std::string_view str, size_t pos) const noexcept -> size_t {
+    return find_encoded(str, {_bytes.data(), _len}, pos);
+  }
+};
+
+class str_pattern {
+  std::string_view _needle;
+
+ public:
+  constexpr str_pattern() noexcept = default;
+  explicit constexpr str_pattern(std::string_view needle) noexcept : _needle(needle) {}
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_t {
+    return _needle.size();
+  }
+
+  // an empty delimiter is never found
+  [[nodiscard]] constexpr auto find(std::string_view str, size_t pos) const noexcept -> size_t {
+    return _needle.empty() ? str.npos : str.find(_needle, pos);
+  }
+};
+
+template <typename Pattern>
+class split_iter {
+  std::string_view _str;
+  Pattern _pattern;
+  size_t _pos = std::string_view::npos;  // `npos` past the last piece
+  size_t _end = 0;
+
+  constexpr void find_end() noexcept {
+    _end = std::min(_pattern.find(_str, _pos), _str.size());
+  }
+
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = string_view;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr split_iter() noexcept = default;
+  constexpr split_iter(std::string_view str, Pattern pattern) noexcept
+      : _str(str), _pattern(pattern), _pos(0) {
+    find_end();
+  }
+
+  constexpr auto operator++() noexcept -> split_iter& {
+    if (_end == _str.size()) {
+      _pos = std::string_view::npos;
+    } else {
+      _pos = _end + _pattern.size();
+      find_end();
+    }
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> split_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return {unsafe, _str.substr(_pos, _end - _pos)};
+  }
+
+  constexpr auto operator==(const split_iter& other) const noexcept -> bool {
+    return _pos == other._pos;
+  }
+};
+
+class find_all_iter {
+  std::string_view _str;
+  char_pattern _pattern;
+  size_t _pos = std::string_view::npos;
+
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr find_all_iter() noexcept = default;
+  constexpr find_all_iter(std::string_view str, char_pattern pattern) noexcept
+      : _str(str), _pattern(pattern), _pos(pattern.find(str, 0)) {}
+
+  constexpr auto operator++() noexcept -> find_all_iter& {
+    _pos = _pattern.find(_str, _pos + _pattern.size());
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> find_all_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return _pos;
+  }
+
+  constexpr auto operator==(const find_all_iter& other) const noexcept -> bool {
+    return _pos == other._pos;
+  }
+};
+
+// tab, line feed, vertical tab, form feed, carriage return and space
+constexpr auto is_ascii_space(char8_t byte) noexcept -> bool {
+  return byte == ' ' || (byte >= '\t' && byte <= '\r');
+}
+
+// White_Space char at `pos`, or 0 if there is none
+constexpr auto space_width(std::string_view str, size_t pos) noexcept -> size_t {
+  char8_t byte = str[pos];
+  if (byte < 0x80) {
+    return is_ascii_space(byte);
+  }
+  if (byte != 0xC2 && (byte < 0xE1 || byte > 0xE3)) {
+    return 0;
+  }
+  auto code = decode_char(str.data() + pos);
+  auto space = code == 0x85 || code == 0xA0 || code == 0x1680 ||
+               (code >= 0x2000 && code <= 0x200A) || code == 0x2028 || code == 0x2029 ||
+               code == 0x202F || code == 0x205F || code == 0x3000;
+  return space ? thin_decode(byte) : 0;
+}
+
+// first White_Space char at or after `pos` (or the end), SIMD passes the bytes that can't start one
+constexpr auto find_space(std::string_view str, size_t pos) noexcept -> size_t {
+  while (pos < str.size()) {
+    if not consteval {
+      pos += simd::skip_non_space(str.data() + pos, str.size() - pos);
+      if (pos == str.size()) {
+        break;
+      }
+    }
+    if (space_width(str, pos) != 0) {
+      return pos;
+    }
+    // the SIMD scan may stop in the middle of a char, no White_Space starts with its bytes
+    pos++;
+  }
+  return str.size();
+}
+
+// first char at or after `pos` that is not White_Space (or the end)
+constexpr auto skip_space(std::string_view str, size_t pos) noexcept -> size_t {
+  while (pos < str.size()) {
+    auto width = space_width(str, pos);
+    if (width == 0) {
+      break;
+    }
+    pos += width;
+  }
+  return pos;
+}
+
+class lines_iter {
+  std::string_view _str;
+  size_t _pos = std::string_view::npos;  // `npos` past the last line
+  size_t _end = 0;                       // `\n` after the line or the end
+
+  constexpr void find_end() noexcept {
+    if (_pos == _str.size()) {
+      _pos = std::string_view::npos;  // no empty line after the last line break
+    } else {
+      _end = std::min(_str.find('\n', _pos), _str.size());
+    }
+  }
+
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = string_view;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr lines_iter() noexcept = default;
+  explicit constexpr lines_iter(std::string_view str) noexcept : _str(str), _pos(0) {
+    find_end();
+  }
+
+  constexpr auto operator++() noexcept -> lines_iter& {
+    _pos = std::min(_end + 1, _str.size());
+    find_end();
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> lines_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    auto line = _str.substr(_pos, _end - _pos);
+    if (_end < _str.size() && line.ends_with('\r')) {
+      line.remove_suffix(1);
+    }
+    return {unsafe, line};
+  }
+
+  constexpr auto operator==(const lines_iter& other) const noexcept -> bool {
+    return _pos == other._pos;
+  }
+};
+
+class split_whitespace_iter {
+  std::string_view _str;
+  size_t _pos = 0, _end = 0;
+
+  constexpr void find_word() noexcept {
+    _pos = skip_space(_str, _end);
+    _end = find_space(_str, _pos);
+  }
+
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = string_view;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr split_whitespace_iter() noexcept = default;
+  constexpr split_whitespace_iter(std::string_view str, size_t pos) noexcept
+      : _str(str), _end(pos) {
+    find_word();
+  }
+
+  constexpr auto operator++() noexcept -> split_whitespace_iter& {
+    find_word();
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> split_whitespace_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return {unsafe, _str.substr(_pos, _end - _pos)};
+  }
+
+  constexpr auto operator==(const split_whitespace_iter& other) const noexcept -> bool {
+    return _pos == other._pos;
+  }
+};
+}  // namespace noexport
+
+/// pieces between delimiters, with empty ones between adjacent delimiters and at the ends
+template <typename Pattern>
+class split_view : public std::ranges::view_interface<split_view<Pattern>> {
+  std::string_view _str;
+  Pattern _pattern;
+
+ public:
+  constexpr split_view() noexcept = default;
+  constexpr split_view(string_view str, Pattern pattern) noexcept : _str(str), _pattern(pattern) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::split_iter<Pattern>(_str, _pattern);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return noexport::split_iter<Pattern>();
+  }
+};
+
+/// lines without their `\n` or `\r\n`, a line break at the end does not start an empty line
+class lines_view : public std::ranges::view_interface<lines_view> {
+  std::string_view _str;
+
+ public:
+  constexpr lines_view() noexcept = default;
+  explicit constexpr lines_view(string_view str) noexcept : _str(str) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::lines_iter(_str);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return noexport::lines_iter();
+  }
+};
+
+/// non-empty runs of chars that are not Unicode White_Space
+class split_whitespace_view : public std::ranges::view_interface<split_whitespace_view> {
+  std::string_view _str;
+
+ public:
+  constexpr split_whitespace_view() noexcept = default;
+  explicit constexpr split_whitespace_view(string_view str) noexcept : _str(str) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::split_whitespace_iter(_str, 0);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return noexport::split_whitespace_iter(_str, _str.size());
+  }
+};
+
+/// byte offsets of a char in the string
+class find_all_view : public std::ranges::view_interface<find_all_view> {
+  std::string_view _str;
+  noexport::char_pattern _pattern;
+
+ public:
+  constexpr find_all_view() noexcept = default;
+  constexpr find_all_view(string_view str, char_t ch) noexcept : _str(str), _pattern(ch) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::find_all_iter(_str, _pattern);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return noexport::find_all_iter();
+  }
+};
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::split(char_t delimiter) const noexcept {
+  return split_view(*this, noexport::char_pattern(delimiter));
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::split(string_view delimiter) const noexcept {
+  return split_view(*this, noexport::str_pattern(delimiter));
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::find_all(char_t ch) const noexcept {
+  return find_all_view(*this, ch);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::lines() const noexcept {
+  return lines_view(*this);
+}
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::split_whitespace() const noexcept {
+  return split_whitespace_view(*this);
+}
+
+}  // namespace utf8
+
+namespace std::ranges {
+template <typename Pattern>
+constexpr bool enable_borrowed_range<utf8::split_view<Pattern>> = true;
+template <>
+constexpr bool enable_borrowed_range<utf8::find_all_view> = true;
+template <>
+constexpr bool enable_borrowed_range<utf8::lines_view> = true;
+template <>
+constexpr bool enable_borrowed_range<utf8::split_whitespace_view> = true;
+}  // namespace std::ranges
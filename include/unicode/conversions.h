@@ -32,6 +32,7 @@ class str_t {
   }
 };
 
+// only the few chars that map to more than one have a table to search, sorted by the char
 constexpr auto bsearch_table(char_t ch, std::span<const std::pair<char_t, str_t>> table) noexcept
     -> std::optional<str_t> {
   auto first = [](auto&& pair) {
@@ -45,2203 +46,594 @@ constexpr auto bsearch_table(char_t ch, std::span<const std::pair<char_t, str_t>
   }
 }
 
-constexpr auto LOWERCASE_TABLE = std::to_array<std::pair<char_t, str_t>>({
-    {'A', {'a'}},
-    {'B', {'b'}},
-    {'C', {'c'}},
-    {'D', {'d'}},
-    {'E', {'e'}},
-    {'F', {'f'}},
-    {'G', {'g'}},
-    {'H', {'h'}},
-    {'I', {'i'}},
-    {'J', {'j'}},
-    {'K', {'k'}},
-    {'L', {'l'}},
-    {'M', {'m'}},
-    {'N', {'n'}},
-    {'O', {'o'}},
-    {'P', {'p'}},
-    {'Q', {'q'}},
-    {'R', {'r'}},
-    {'S', {'s'}},
-    {'T', {'t'}},
-    {'U', {'u'}},
-    {'V', {'v'}},
-    {'W', {'w'}},
-    {'X', {'x'}},
-    {'Y', {'y'}},
-    {'Z', {'z'}},
-    {u'\u00c0', {u'\u00e0'}},
-    {u'\u00c1', {u'\u00e1'}},
-    {u'\u00c2', {u'\u00e2'}},
-    {u'\u00c3', {u'\u00e3'}},
-    {u'\u00c4', {u'\u00e4'}},
-    {u'\u00c5', {u'\u00e5'}},
-    {u'\u00c6', {u'\u00e6'}},
-    {u'\u00c7', {u'\u00e7'}},
-    {u'\u00c8', {u'\u00e8'}},
-    {u'\u00c9', {u'\u00e9'}},
-    {u'\u00ca', {u'\u00ea'}},
-    {u'\u00cb', {u'\u00eb'}},
-    {u'\u00cc', {u'\u00ec'}},
-    {u'\u00cd', {u'\u00ed'}},
-    {u'\u00ce', {u'\u00ee'}},
-    {u'\u00cf', {u'\u00ef'}},
-    {u'\u00d0', {u'\u00f0'}},
-    {u'\u00d1', {u'\u00f1'}},
-    {u'\u00d2', {u'\u00f2'}},
-    {u'\u00d3', {u'\u00f3'}},
-    {u'\u00d4', {u'\u00f4'}},
-    {u'\u00d5', {u'\u00f5'}},
-    {u'\u00d6', {u'\u00f6'}},
-    {u'\u00d8', {u'\u00f8'}},
-    {u'\u00d9', {u'\u00f9'}},
-    {u'\u00da', {u'\u00fa'}},
-    {u'\u00db', {u'\u00fb'}},
-    {u'\u00dc', {u'\u00fc'}},
-    {u'\u00dd', {u'\u00fd'}},
-    {u'\u00de', {u'\u00fe'}},
-    {u'\u0100', {u'\u0101'}},
-    {u'\u0102', {u'\u0103'}},
-    {u'\u0104', {u'\u0105'}},
-    {u'\u0106', {u'\u0107'}},
-    {u'\u0108', {u'\u0109'}},
-    {u'\u010a', {u'\u010b'}},
-    {u'\u010c', {u'\u010d'}},
-    {u'\u010e', {u'\u010f'}},
-    {u'\u0110', {u'\u0111'}},
-    {u'\u0112', {u'\u0113'}},
-    {u'\u0114', {u'\u0115'}},
-    {u'\u0116', {u'\u0117'}},
-    {u'\u0118', {u'\u0119'}},
-    {u'\u011a', {u'\u011b'}},
-    {u'\u011c', {u'\u011d'}},
-    {u'\u011e', {u'\u011f'}},
-    {u'\u0120', {u'\u0121'}},
-    {u'\u0122', {u'\u0123'}},
-    {u'\u0124', {u'\u0125'}},
-    {u'\u0126', {u'\u0127'}},
-    {u'\u0128', {u'\u0129'}},
-    {u'\u012a', {u'\u012b'}},
-    {u'\u012c', {u'\u012d'}},
-    {u'\u012e', {u'\u012f'}},
+// generated by tools/unicode_tables.py from the Unicode Character Database 14.0.0,
+// everything down to `convert`, do not edit by hand
+
+// case mappings as an index into the deltas to the mapped code, or `EXPANDS` for the few chars
+// that map to more than one, those are in a side table
+constexpr std::uint8_t EXPANDS = 255;
+
+// Lowercase_Mapping, 4868 bytes
+constexpr std::int32_t LOWER_DELTAS[] = {
+    0, -42319, -42315, -42308, -42307, -42305, -42282, -42280, -42261, -42258, -35384, -35332,
+    -10815, -10783, -10782, -10780, -10749, -10743, -10727, -8383, -8262, -7615, -7517, -3814,
+    -3008, -195, -163, -130, -128, -126, -121, -112, -100, -97, -86, -74,
+    -60, -56, -48, -9, -8, -7, 1, 2, 8, 15, 16, 26,
+    28, 32, 34, 37, 38, 39, 40, 48, 63, 64, 69, 71,
+    79, 80, 116, 202, 203, 205, 206, 207, 209, 210, 211, 213,
+    214, 217, 218, 219, 928, 7264, 10792, 10795, 38864,
+};
+
+constexpr std::uint8_t LOWER_ROWS[] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 7,
+    8, 3, 9, 3, 3, 3, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 11, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 12,
+    3, 3, 13, 3, 3, 3, 14, 3, 3, 3, 3, 3, 15, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 16, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 17, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+constexpr std::uint16_t LOWER_BLOCKS[] = {
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0,
+    5, 5, 5, 6, 7, 5, 5, 8, 9, 10, 11, 12, 13, 14, 5, 15,
+    5, 5, 16, 17, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 19, 20, 1, 21, 0, 22, 23, 5, 24,
+    25, 3, 3, 0, 0, 0, 5, 5, 26, 5, 5, 5, 27, 5, 5, 5,
+    5, 5, 5, 28, 29, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 31, 32, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 34,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 35, 36, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 37, 5, 5, 5, 5, 5, 5,
+    38, 39, 38, 38, 39, 40, 38, 0, 38, 38, 38, 41, 42, 43, 44, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 46, 47, 0, 0, 48, 0, 49, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 51, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 29, 29, 0, 0, 0, 52, 53, 5, 5, 5, 5, 5, 5, 54, 55,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 56, 0, 5, 57, 0, 0, 0, 0, 0, 0,
+    0, 0, 58, 58, 5, 5, 5, 59, 60, 61, 62, 63, 64, 65, 0, 66,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 67, 68, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 69, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 70, 70, 71, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 72, 72, 72, 73, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    74, 74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr std::uint8_t LOWER_VALUES[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 0,
+    42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    255, 0, 42, 0, 42, 0, 42, 0, 0, 42, 0, 42, 0, 42, 0, 42,
+    0, 42, 0, 42, 0, 42, 0, 42, 0, 0, 42, 0, 42, 0, 42, 0,
+    42, 0, 42, 0, 42, 0, 42, 0, 30, 42, 0, 42, 0, 42, 0, 0,
+    0, 69, 42, 0, 42, 0, 66, 42, 0, 65, 65, 42, 0, 0, 60, 63,
+    64, 42, 0, 65, 67, 0, 70, 68, 42, 0, 0, 0, 70, 71, 0, 72,
+    42, 0, 42, 0, 42, 0, 74, 42, 0, 74, 0, 0, 42, 0, 74, 42,
+    0, 73, 73, 42, 0, 42, 0, 75, 42, 0, 0, 0, 42, 0, 0, 0,
+    0, 0, 0, 0, 43, 42, 0, 43, 42, 0, 43, 42, 0, 42, 0, 42,
+    0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 0, 42, 0,
+    0, 43, 42, 0, 42, 0, 33, 37, 42, 0, 42, 0, 42, 0, 42, 0,
+    27, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    42, 0, 42, 0, 0, 0, 0, 0, 0, 0, 79, 42, 0, 26, 78, 0,
+    0, 42, 0, 25, 58, 59, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    42, 0, 42, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 62,
+    0, 0, 0, 0, 0, 0, 52, 0, 51, 51, 51, 0, 57, 0, 56, 56,
+    49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    0, 0, 0, 0, 36, 0, 0, 42, 0, 41, 42, 0, 0, 27, 27, 27,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 42, 0, 42, 0,
+    45, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 0,
+    0, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 0, 77, 0, 0, 0, 0, 0, 77, 0, 0,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    44, 44, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24, 24, 24,
+    42, 0, 42, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 40, 40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 40, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 35, 35, 39, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 39, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 32, 32, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 31, 31, 41, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 29, 29, 39, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 19, 20, 0, 0, 0, 0,
+    0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    42, 0, 17, 23, 18, 0, 0, 42, 0, 42, 0, 42, 0, 15, 16, 13,
+    14, 0, 42, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12,
+    42, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 42, 0, 0,
+    0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 0, 0,
+    42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 0, 0, 0, 0,
+    0, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 42, 0, 11, 42, 0,
+    42, 0, 42, 0, 42, 0, 42, 0, 0, 0, 0, 42, 0, 7, 0, 0,
+    42, 0, 42, 0, 0, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 3, 1, 2, 5, 3, 0,
+    9, 6, 8, 76, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0, 42, 0,
+    42, 0, 42, 0, 38, 4, 10, 42, 0, 42, 0, 0, 0, 0, 0, 0,
+    42, 0, 0, 0, 0, 0, 42, 0, 42, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 0, 53, 53, 53, 53,
+    53, 53, 53, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr auto LOWER = unicode::property_trie{LOWER_ROWS, LOWER_BLOCKS, LOWER_VALUES};
+
+constexpr auto LOWER_EXPANSIONS = std::to_array<std::pair<char_t, str_t>>({
     {u'\u0130', {'i', u'\u0307'}},
-    {u'\u0132', {u'\u0133'}},
-    {u'\u0134', {u'\u0135'}},
-    {u'\u0136', {u'\u0137'}},
-    {u'\u0139', {u'\u013a'}},
-    {u'\u013b', {u'\u013c'}},
-    {u'\u013d', {u'\u013e'}},
-    {u'\u013f', {u'\u0140'}},
-    {u'\u0141', {u'\u0142'}},
-    {u'\u0143', {u'\u0144'}},
-    {u'\u0145', {u'\u0146'}},
-    {u'\u0147', {u'\u0148'}},
-    {u'\u014a', {u'\u014b'}},
-    {u'\u014c', {u'\u014d'}},
-    {u'\u014e', {u'\u014f'}},
-    {u'\u0150', {u'\u0151'}},
-    {u'\u0152', {u'\u0153'}},
-    {u'\u0154', {u'\u0155'}},
-    {u'\u0156', {u'\u0157'}},
-    {u'\u0158', {u'\u0159'}},
-    {u'\u015a', {u'\u015b'}},
-    {u'\u015c', {u'\u015d'}},
-    {u'\u015e', {u'\u015f'}},
-    {u'\u0160', {u'\u0161'}},
-    {u'\u0162', {u'\u0163'}},
-    {u'\u0164', {u'\u0165'}},
-    {u'\u0166', {u'\u0167'}},
-    {u'\u0168', {u'\u0169'}},
-    {u'\u016a', {u'\u016b'}},
-    {u'\u016c', {u'\u016d'}},
-    {u'\u016e', {u'\u016f'}},
-    {u'\u0170', {u'\u0171'}},
-    {u'\u0172', {u'\u0173'}},
-    {u'\u0174', {u'\u0175'}},
-    {u'\u0176', {u'\u0177'}},
-    {u'\u0178', {u'\u00ff'}},
-    {u'\u0179', {u'\u017a'}},
-    {u'\u017b', {u'\u017c'}},
-    {u'\u017d', {u'\u017e'}},
-    {u'\u0181', {u'\u0253'}},
-    {u'\u0182', {u'\u0183'}},
-    {u'\u0184', {u'\u0185'}},
-    {u'\u0186', {u'\u0254'}},
-    {u'\u0187', {u'\u0188'}},
-    {u'\u0189', {u'\u0256'}},
-    {u'\u018a', {u'\u0257'}},
-    {u'\u018b', {u'\u018c'}},
-    {u'\u018e', {u'\u01dd'}},
-    {u'\u018f', {u'\u0259'}},
-    {u'\u0190', {u'\u025b'}},
-    {u'\u0191', {u'\u0192'}},
-    {u'\u0193', {u'\u0260'}},
-    {u'\u0194', {u'\u0263'}},
-    {u'\u0196', {u'\u0269'}},
-    {u'\u0197', {u'\u0268'}},
-    {u'\u0198', {u'\u0199'}},
-    {u'\u019c', {u'\u026f'}},
-    {u'\u019d', {u'\u0272'}},
-    {u'\u019f', {u'\u0275'}},
-    {u'\u01a0', {u'\u01a1'}},
-    {u'\u01a2', {u'\u01a3'}},
-    {u'\u01a4', {u'\u01a5'}},
-    {u'\u01a6', {u'\u0280'}},
-    {u'\u01a7', {u'\u01a8'}},
-    {u'\u01a9', {u'\u0283'}},
-    {u'\u01ac', {u'\u01ad'}},
-    {u'\u01ae', {u'\u0288'}},
-    {u'\u01af', {u'\u01b0'}},
-    {u'\u01b1', {u'\u028a'}},
-    {u'\u01b2', {u'\u028b'}},
-    {u'\u01b3', {u'\u01b4'}},
-    {u'\u01b5', {u'\u01b6'}},
-    {u'\u01b7', {u'\u0292'}},
-    {u'\u01b8', {u'\u01b9'}},
-    {u'\u01bc', {u'\u01bd'}},
-    {u'\u01c4', {u'\u01c6'}},
-    {u'\u01c5', {u'\u01c6'}},
-    {u'\u01c7', {u'\u01c9'}},
-    {u'\u01c8', {u'\u01c9'}},
-    {u'\u01ca', {u'\u01cc'}},
-    {u'\u01cb', {u'\u01cc'}},
-    {u'\u01cd', {u'\u01ce'}},
-    {u'\u01cf', {u'\u01d0'}},
-    {u'\u01d1', {u'\u01d2'}},
-    {u'\u01d3', {u'\u01d4'}},
-    {u'\u01d5', {u'\u01d6'}},
-    {u'\u01d7', {u'\u01d8'}},
-    {u'\u01d9', {u'\u01da'}},
-    {u'\u01db', {u'\u01dc'}},
-    {u'\u01de', {u'\u01df'}},
-    {u'\u01e0', {u'\u01e1'}},
-    {u'\u01e2', {u'\u01e3'}},
-    {u'\u01e4', {u'\u01e5'}},
-    {u'\u01e6', {u'\u01e7'}},
-    {u'\u01e8', {u'\u01e9'}},
-    {u'\u01ea', {u'\u01eb'}},
-    {u'\u01ec', {u'\u01ed'}},
-    {u'\u01ee', {u'\u01ef'}},
-    {u'\u01f1', {u'\u01f3'}},
-    {u'\u01f2', {u'\u01f3'}},
-    {u'\u01f4', {u'\u01f5'}},
-    {u'\u01f6', {u'\u0195'}},
-    {u'\u01f7', {u'\u01bf'}},
-    {u'\u01f8', {u'\u01f9'}},
-    {u'\u01fa', {u'\u01fb'}},
-    {u'\u01fc', {u'\u01fd'}},
-    {u'\u01fe', {u'\u01ff'}},
-    {u'\u0200', {u'\u0201'}},
-    {u'\u0202', {u'\u0203'}},
-    {u'\u0204', {u'\u0205'}},
-    {u'\u0206', {u'\u0207'}},
-    {u'\u0208', {u'\u0209'}},
-    {u'\u020a', {u'\u020b'}},
-    {u'\u020c', {u'\u020d'}},
-    {u'\u020e', {u'\u020f'}},
-    {u'\u0210', {u'\u0211'}},
-    {u'\u0212', {u'\u0213'}},
-    {u'\u0214', {u'\u0215'}},
-    {u'\u0216', {u'\u0217'}},
-    {u'\u0218', {u'\u0219'}},
-    {u'\u021a', {u'\u021b'}},
-    {u'\u021c', {u'\u021d'}},
-    {u'\u021e', {u'\u021f'}},
-    {u'\u0220', {u'\u019e'}},
-    {u'\u0222', {u'\u0223'}},
-    {u'\u0224', {u'\u0225'}},
-    {u'\u0226', {u'\u0227'}},
-    {u'\u0228', {u'\u0229'}},
-    {u'\u022a', {u'\u022b'}},
-    {u'\u022c', {u'\u022d'}},
-    {u'\u022e', {u'\u022f'}},
-    {u'\u0230', {u'\u0231'}},
-    {u'\u0232', {u'\u0233'}},
-    {u'\u023a', {u'\u2c65'}},
-    {u'\u023b', {u'\u023c'}},
-    {u'\u023d', {u'\u019a'}},
-    {u'\u023e', {u'\u2c66'}},
-    {u'\u0241', {u'\u0242'}},
-    {u'\u0243', {u'\u0180'}},
-    {u'\u0244', {u'\u0289'}},
-    {u'\u0245', {u'\u028c'}},
-    {u'\u0246', {u'\u0247'}},
-    {u'\u0248', {u'\u0249'}},
-    {u'\u024a', {u'\u024b'}},
-    {u'\u024c', {u'\u024d'}},
-    {u'\u024e', {u'\u024f'}},
-    {u'\u0370', {u'\u0371'}},
-    {u'\u0372', {u'\u0373'}},
-    {u'\u0376', {u'\u0377'}},
-    {u'\u037f', {u'\u03f3'}},
-    {u'\u0386', {u'\u03ac'}},
-    {u'\u0388', {u'\u03ad'}},
-    {u'\u0389', {u'\u03ae'}},
-    {u'\u038a', {u'\u03af'}},
-    {u'\u038c', {u'\u03cc'}},
-    {u'\u038e', {u'\u03cd'}},
-    {u'\u038f', {u'\u03ce'}},
-    {u'\u0391', {u'\u03b1'}},
-    {u'\u0392', {u'\u03b2'}},
-    {u'\u0393', {u'\u03b3'}},
-    {u'\u0394', {u'\u03b4'}},
-    {u'\u0395', {u'\u03b5'}},
-    {u'\u0396', {u'\u03b6'}},
-    {u'\u0397', {u'\u03b7'}},
-    {u'\u0398', {u'\u03b8'}},
-    {u'\u0399', {u'\u03b9'}},
-    {u'\u039a', {u'\u03ba'}},
-    {u'\u039b', {u'\u03bb'}},
-    {u'\u039c', {u'\u03bc'}},
-    {u'\u039d', {u'\u03bd'}},
-    {u'\u039e', {u'\u03be'}},
-    {u'\u039f', {u'\u03bf'}},
-    {u'\u03a0', {u'\u03c0'}},
-    {u'\u03a1', {u'\u03c1'}},
-    {u'\u03a3', {u'\u03c3'}},
-    {u'\u03a4', {u'\u03c4'}},
-    {u'\u03a5', {u'\u03c5'}},
-    {u'\u03a6', {u'\u03c6'}},
-    {u'\u03a7', {u'\u03c7'}},
-    {u'\u03a8', {u'\u03c8'}},
-    {u'\u03a9', {u'\u03c9'}},
-    {u'\u03aa', {u'\u03ca'}},
-    {u'\u03ab', {u'\u03cb'}},
-    {u'\u03cf', {u'\u03d7'}},
-    {u'\u03d8', {u'\u03d9'}},
-    {u'\u03da', {u'\u03db'}},
-    {u'\u03dc', {u'\u03dd'}},
-    {u'\u03de', {u'\u03df'}},
-    {u'\u03e0', {u'\u03e1'}},
-    {u'\u03e2', {u'\u03e3'}},
-    {u'\u03e4', {u'\u03e5'}},
-    {u'\u03e6', {u'\u03e7'}},
-    {u'\u03e8', {u'\u03e9'}},
-    {u'\u03ea', {u'\u03eb'}},
-    {u'\u03ec', {u'\u03ed'}},
-    {u'\u03ee', {u'\u03ef'}},
-    {u'\u03f4', {u'\u03b8'}},
-    {u'\u03f7', {u'\u03f8'}},
-    {u'\u03f9', {u'\u03f2'}},
-    {u'\u03fa', {u'\u03fb'}},
-    {u'\u03fd', {u'\u037b'}},
-    {u'\u03fe', {u'\u037c'}},
-    {u'\u03ff', {u'\u037d'}},
-    {u'\u0400', {u'\u0450'}},
-    {u'\u0401', {u'\u0451'}},
-    {u'\u0402', {u'\u0452'}},
-    {u'\u0403', {u'\u0453'}},
-    {u'\u0404', {u'\u0454'}},
-    {u'\u0405', {u'\u0455'}},
-    {u'\u0406', {u'\u0456'}},
-    {u'\u0407', {u'\u0457'}},
-    {u'\u0408', {u'\u0458'}},
-    {u'\u0409', {u'\u0459'}},
-    {u'\u040a', {u'\u045a'}},
-    {u'\u040b', {u'\u045b'}},
-    {u'\u040c', {u'\u045c'}},
-    {u'\u040d', {u'\u045d'}},
-    {u'\u040e', {u'\u045e'}},
-    {u'\u040f', {u'\u045f'}},
-    {u'\u0410', {u'\u0430'}},
-    {u'\u0411', {u'\u0431'}},
-    {u'\u0412', {u'\u0432'}},
-    {u'\u0413', {u'\u0433'}},
-    {u'\u0414', {u'\u0434'}},
-    {u'\u0415', {u'\u0435'}},
-    {u'\u0416', {u'\u0436'}},
-    {u'\u0417', {u'\u0437'}},
-    {u'\u0418', {u'\u0438'}},
-    {u'\u0419', {u'\u0439'}},
-    {u'\u041a', {u'\u043a'}},
-    {u'\u041b', {u'\u043b'}},
-    {u'\u041c', {u'\u043c'}},
-    {u'\u041d', {u'\u043d'}},
-    {u'\u041e', {u'\u043e'}},
-    {u'\u041f', {u'\u043f'}},
-    {u'\u0420', {u'\u0440'}},
-    {u'\u0421', {u'\u0441'}},
-    {u'\u0422', {u'\u0442'}},
-    {u'\u0423', {u'\u0443'}},
-    {u'\u0424', {u'\u0444'}},
-    {u'\u0425', {u'\u0445'}},
-    {u'\u0426', {u'\u0446'}},
-    {u'\u0427', {u'\u0447'}},
-    {u'\u0428', {u'\u0448'}},
-    {u'\u0429', {u'\u0449'}},
-    {u'\u042a', {u'\u044a'}},
-    {u'\u042b', {u'\u044b'}},
-    {u'\u042c', {u'\u044c'}},
-    {u'\u042d', {u'\u044d'}},
-    {u'\u042e', {u'\u044e'}},
-    {u'\u042f', {u'\u044f'}},
-    {u'\u0460', {u'\u0461'}},
-    {u'\u0462', {u'\u0463'}},
-    {u'\u0464', {u'\u0465'}},
-    {u'\u0466', {u'\u0467'}},
-    {u'\u0468', {u'\u0469'}},
-    {u'\u046a', {u'\u046b'}},
-    {u'\u046c', {u'\u046d'}},
-    {u'\u046e', {u'\u046f'}},
-    {u'\u0470', {u'\u0471'}},
-    {u'\u0472', {u'\u0473'}},
-    {u'\u0474', {u'\u0475'}},
-    {u'\u0476', {u'\u0477'}},
-    {u'\u0478', {u'\u0479'}},
-    {u'\u047a', {u'\u047b'}},
-    {u'\u047c', {u'\u047d'}},
-    {u'\u047e', {u'\u047f'}},
-    {u'\u0480', {u'\u0481'}},
-    {u'\u048a', {u'\u048b'}},
-    {u'\u048c', {u'\u048d'}},
-    {u'\u048e', {u'\u048f'}},
-    {u'\u0490', {u'\u0491'}},
-    {u'\u0492', {u'\u0493'}},
-    {u'\u0494', {u'\u0495'}},
-    {u'\u0496', {u'\u0497'}},
-    {u'\u0498', {u'\u0499'}},
-    {u'\u049a', {u'\u049b'}},
-    {u'\u049c', {u'\u049d'}},
-    {u'\u049e', {u'\u049f'}},
-    {u'\u04a0', {u'\u04a1'}},
-    {u'\u04a2', {u'\u04a3'}},
-    {u'\u04a4', {u'\u04a5'}},
-    {u'\u04a6', {u'\u04a7'}},
-    {u'\u04a8', {u'\u04a9'}},
-    {u'\u04aa', {u'\u04ab'}},
-    {u'\u04ac', {u'\u04ad'}},
-    {u'\u04ae', {u'\u04af'}},
-    {u'\u04b0', {u'\u04b1'}},
-    {u'\u04b2', {u'\u04b3'}},
-    {u'\u04b4', {u'\u04b5'}},
-    {u'\u04b6', {u'\u04b7'}},
-    {u'\u04b8', {u'\u04b9'}},
-    {u'\u04ba', {u'\u04bb'}},
-    {u'\u04bc', {u'\u04bd'}},
-    {u'\u04be', {u'\u04bf'}},
-    {u'\u04c0', {u'\u04cf'}},
-    {u'\u04c1', {u'\u04c2'}},
-    {u'\u04c3', {u'\u04c4'}},
-    {u'\u04c5', {u'\u04c6'}},
-    {u'\u04c7', {u'\u04c8'}},
-    {u'\u04c9', {u'\u04ca'}},
-    {u'\u04cb', {u'\u04cc'}},
-    {u'\u04cd', {u'\u04ce'}},
-    {u'\u04d0', {u'\u04d1'}},
-    {u'\u04d2', {u'\u04d3'}},
-    {u'\u04d4', {u'\u04d5'}},
-    {u'\u04d6', {u'\u04d7'}},
-    {u'\u04d8', {u'\u04d9'}},
-    {u'\u04da', {u'\u04db'}},
-    {u'\u04dc', {u'\u04dd'}},
-    {u'\u04de', {u'\u04df'}},
-    {u'\u04e0', {u'\u04e1'}},
-    {u'\u04e2', {u'\u04e3'}},
-    {u'\u04e4', {u'\u04e5'}},
-    {u'\u04e6', {u'\u04e7'}},
-    {u'\u04e8', {u'\u04e9'}},
-    {u'\u04ea', {u'\u04eb'}},
-    {u'\u04ec', {u'\u04ed'}},
-    {u'\u04ee', {u'\u04ef'}},
-    {u'\u04f0', {u'\u04f1'}},
-    {u'\u04f2', {u'\u04f3'}},
-    {u'\u04f4', {u'\u04f5'}},
-    {u'\u04f6', {u'\u04f7'}},
-    {u'\u04f8', {u'\u04f9'}},
-    {u'\u04fa', {u'\u04fb'}},
-    {u'\u04fc', {u'\u04fd'}},
-    {u'\u04fe', {u'\u04ff'}},
-    {u'\u0500', {u'\u0501'}},
-    {u'\u0502', {u'\u0503'}},
-    {u'\u0504', {u'\u0505'}},
-    {u'\u0506', {u'\u0507'}},
-    {u'\u0508', {u'\u0509'}},
-    {u'\u050a', {u'\u050b'}},
-    {u'\u050c', {u'\u050d'}},
-    {u'\u050e', {u'\u050f'}},
-    {u'\u0510', {u'\u0511'}},
-    {u'\u0512', {u'\u0513'}},
-    {u'\u0514', {u'\u0515'}},
-    {u'\u0516', {u'\u0517'}},
-    {u'\u0518', {u'\u0519'}},
-    {u'\u051a', {u'\u051b'}},
-    {u'\u051c', {u'\u051d'}},
-    {u'\u051e', {u'\u051f'}},
-    {u'\u0520', {u'\u0521'}},
-    {u'\u0522', {u'\u0523'}},
-    {u'\u0524', {u'\u0525'}},
-    {u'\u0526', {u'\u0527'}},
-    {u'\u0528', {u'\u0529'}},
-    {u'\u052a', {u'\u052b'}},
-    {u'\u052c', {u'\u052d'}},
-    {u'\u052e', {u'\u052f'}},
-    {u'\u0531', {u'\u0561'}},
-    {u'\u0532', {u'\u0562'}},
-    {u'\u0533', {u'\u0563'}},
-    {u'\u0534', {u'\u0564'}},
-    {u'\u0535', {u'\u0565'}},
-    {u'\u0536', {u'\u0566'}},
-    {u'\u0537', {u'\u0567'}},
-    {u'\u0538', {u'\u0568'}},
-    {u'\u0539', {u'\u0569'}},
-    {u'\u053a', {u'\u056a'}},
-    {u'\u053b', {u'\u056b'}},
-    {u'\u053c', {u'\u056c'}},
-    {u'\u053d', {u'\u056d'}},
-    {u'\u053e', {u'\u056e'}},
-    {u'\u053f', {u'\u056f'}},
-    {u'\u0540', {u'\u0570'}},
-    {u'\u0541', {u'\u0571'}},
-    {u'\u0542', {u'\u0572'}},
-    {u'\u0543', {u'\u0573'}},
-    {u'\u0544', {u'\u0574'}},
-    {u'\u0545', {u'\u0575'}},
-    {u'\u0546', {u'\u0576'}},
-    {u'\u0547', {u'\u0577'}},
-    {u'\u0548', {u'\u0578'}},
-    {u'\u0549', {u'\u0579'}},
-    {u'\u054a', {u'\u057a'}},
-    {u'\u054b', {u'\u057b'}},
-    {u'\u054c', {u'\u057c'}},
-    {u'\u054d', {u'\u057d'}},
-    {u'\u054e', {u'\u057e'}},
-    {u'\u054f', {u'\u057f'}},
-    {u'\u0550', {u'\u0580'}},
-    {u'\u0551', {u'\u0581'}},
-    {u'\u0552', {u'\u0582'}},
-    {u'\u0553', {u'\u0583'}},
-    {u'\u0554', {u'\u0584'}},
-    {u'\u0555', {u'\u0585'}},
-    {u'\u0556', {u'\u0586'}},
-    {u'\u10a0', {u'\u2d00'}},
-    {u'\u10a1', {u'\u2d01'}},
-    {u'\u10a2', {u'\u2d02'}},
-    {u'\u10a3', {u'\u2d03'}},
-    {u'\u10a4', {u'\u2d04'}},
-    {u'\u10a5', {u'\u2d05'}},
-    {u'\u10a6', {u'\u2d06'}},
-    {u'\u10a7', {u'\u2d07'}},
-    {u'\u10a8', {u'\u2d08'}},
-    {u'\u10a9', {u'\u2d09'}},
-    {u'\u10aa', {u'\u2d0a'}},
-    {u'\u10ab', {u'\u2d0b'}},
-    {u'\u10ac', {u'\u2d0c'}},
-    {u'\u10ad', {u'\u2d0d'}},
-    {u'\u10ae', {u'\u2d0e'}},
-    {u'\u10af', {u'\u2d0f'}},
-    {u'\u10b0', {u'\u2d10'}},
-    {u'\u10b1', {u'\u2d11'}},
-    {u'\u10b2', {u'\u2d12'}},
-    {u'\u10b3', {u'\u2d13'}},
-    {u'\u10b4', {u'\u2d14'}},
-    {u'\u10b5', {u'\u2d15'}},
-    {u'\u10b6', {u'\u2d16'}},
-    {u'\u10b7', {u'\u2d17'}},
-    {u'\u10b8', {u'\u2d18'}},
-    {u'\u10b9', {u'\u2d19'}},
-    {u'\u10ba', {u'\u2d1a'}},
-    {u'\u10bb', {u'\u2d1b'}},
-    {u'\u10bc', {u'\u2d1c'}},
-    {u'\u10bd', {u'\u2d1d'}},
-    {u'\u10be', {u'\u2d1e'}},
-    {u'\u10bf', {u'\u2d1f'}},
-    {u'\u10c0', {u'\u2d20'}},
-    {u'\u10c1', {u'\u2d21'}},
-    {u'\u10c2', {u'\u2d22'}},
-    {u'\u10c3', {u'\u2d23'}},
-    {u'\u10c4', {u'\u2d24'}},
-    {u'\u10c5', {u'\u2d25'}},
-    {u'\u10c7', {u'\u2d27'}},
-    {u'\u10cd', {u'\u2d2d'}},
-    {u'\u13a0', {u'\uab70'}},
-    {u'\u13a1', {u'\uab71'}},
-    {u'\u13a2', {u'\uab72'}},
-    {u'\u13a3', {u'\uab73'}},
-    {u'\u13a4', {u'\uab74'}},
-    {u'\u13a5', {u'\uab75'}},
-    {u'\u13a6', {u'\uab76'}},
-    {u'\u13a7', {u'\uab77'}},
-    {u'\u13a8', {u'\uab78'}},
-    {u'\u13a9', {u'\uab79'}},
-    {u'\u13aa', {u'\uab7a'}},
-    {u'\u13ab', {u'\uab7b'}},
-    {u'\u13ac', {u'\uab7c'}},
-    {u'\u13ad', {u'\uab7d'}},
-    {u'\u13ae', {u'\uab7e'}},
-    {u'\u13af', {u'\uab7f'}},
-    {u'\u13b0', {u'\uab80'}},
-    {u'\u13b1', {u'\uab81'}},
-    {u'\u13b2', {u'\uab82'}},
-    {u'\u13b3', {u'\uab83'}},
-    {u'\u13b4', {u'\uab84'}},
-    {u'\u13b5', {u'\uab85'}},
-    {u'\u13b6', {u'\uab86'}},
-    {u'\u13b7', {u'\uab87'}},
-    {u'\u13b8', {u'\uab88'}},
-    {u'\u13b9', {u'\uab89'}},
-    {u'\u13ba', {u'\uab8a'}},
-    {u'\u13bb', {u'\uab8b'}},
-    {u'\u13bc', {u'\uab8c'}},
-    {u'\u13bd', {u'\uab8d'}},
-    {u'\u13be', {u'\uab8e'}},
-    {u'\u13bf', {u'\uab8f'}},
-    {u'\u13c0', {u'\uab90'}},
-    {u'\u13c1', {u'\uab91'}},
-    {u'\u13c2', {u'\uab92'}},
-    {u'\u13c3', {u'\uab93'}},
-    {u'\u13c4', {u'\uab94'}},
-    {u'\u13c5', {u'\uab95'}},
-    {u'\u13c6', {u'\uab96'}},
-    {u'\u13c7', {u'\uab97'}},
-    {u'\u13c8', {u'\uab98'}},
-    {u'\u13c9', {u'\uab99'}},
-    {u'\u13ca', {u'\uab9a'}},
-    {u'\u13cb', {u'\uab9b'}},
-    {u'\u13cc', {u'\uab9c'}},
-    {u'\u13cd', {u'\uab9d'}},
-    {u'\u13ce', {u'\uab9e'}},
-    {u'\u13cf', {u'\uab9f'}},
-    {u'\u13d0', {u'\uaba0'}},
-    {u'\u13d1', {u'\uaba1'}},
-    {u'\u13d2', {u'\uaba2'}},
-    {u'\u13d3', {u'\uaba3'}},
-    {u'\u13d4', {u'\uaba4'}},
-    {u'\u13d5', {u'\uaba5'}},
-    {u'\u13d6', {u'\uaba6'}},
-    {u'\u13d7', {u'\uaba7'}},
-    {u'\u13d8', {u'\uaba8'}},
-    {u'\u13d9', {u'\uaba9'}},
-    {u'\u13da', {u'\uabaa'}},
-    {u'\u13db', {u'\uabab'}},
-    {u'\u13dc', {u'\uabac'}},
-    {u'\u13dd', {u'\uabad'}},
-    {u'\u13de', {u'\uabae'}},
-    {u'\u13df', {u'\uabaf'}},
-    {u'\u13e0', {u'\uabb0'}},
-    {u'\u13e1', {u'\uabb1'}},
-    {u'\u13e2', {u'\uabb2'}},
-    {u'\u13e3', {u'\uabb3'}},
-    {u'\u13e4', {u'\uabb4'}},
-    {u'\u13e5', {u'\uabb5'}},
-    {u'\u13e6', {u'\uabb6'}},
-    {u'\u13e7', {u'\uabb7'}},
-    {u'\u13e8', {u'\uabb8'}},
-    {u'\u13e9', {u'\uabb9'}},
-    {u'\u13ea', {u'\uabba'}},
-    {u'\u13eb', {u'\uabbb'}},
-    {u'\u13ec', {u'\uabbc'}},
-    {u'\u13ed', {u'\uabbd'}},
-    {u'\u13ee', {u'\uabbe'}},
-    {u'\u13ef', {u'\uabbf'}},
-    {u'\u13f0', {u'\u13f8'}},
-    {u'\u13f1', {u'\u13f9'}},
-    {u'\u13f2', {u'\u13fa'}},
-    {u'\u13f3', {u'\u13fb'}},
-    {u'\u13f4', {u'\u13fc'}},
-    {u'\u13f5', {u'\u13fd'}},
-    {u'\u1c90', {u'\u10d0'}},
-    {u'\u1c91', {u'\u10d1'}},
-    {u'\u1c92', {u'\u10d2'}},
-    {u'\u1c93', {u'\u10d3'}},
-    {u'\u1c94', {u'\u10d4'}},
-    {u'\u1c95', {u'\u10d5'}},
-    {u'\u1c96', {u'\u10d6'}},
-    {u'\u1c97', {u'\u10d7'}},
-    {u'\u1c98', {u'\u10d8'}},
-    {u'\u1c99', {u'\u10d9'}},
-    {u'\u1c9a', {u'\u10da'}},
-    {u'\u1c9b', {u'\u10db'}},
-    {u'\u1c9c', {u'\u10dc'}},
-    {u'\u1c9d', {u'\u10dd'}},
-    {u'\u1c9e', {u'\u10de'}},
-    {u'\u1c9f', {u'\u10df'}},
-    {u'\u1ca0', {u'\u10e0'}},
-    {u'\u1ca1', {u'\u10e1'}},
-    {u'\u1ca2', {u'\u10e2'}},
-    {u'\u1ca3', {u'\u10e3'}},
-    {u'\u1ca4', {u'\u10e4'}},
-    {u'\u1ca5', {u'\u10e5'}},
-    {u'\u1ca6', {u'\u10e6'}},
-    {u'\u1ca7', {u'\u10e7'}},
-    {u'\u1ca8', {u'\u10e8'}},
-    {u'\u1ca9', {u'\u10e9'}},
-    {u'\u1caa', {u'\u10ea'}},
-    {u'\u1cab', {u'\u10eb'}},
-    {u'\u1cac', {u'\u10ec'}},
-    {u'\u1cad', {u'\u10ed'}},
-    {u'\u1cae', {u'\u10ee'}},
-    {u'\u1caf', {u'\u10ef'}},
-    {u'\u1cb0', {u'\u10f0'}},
-    {u'\u1cb1', {u'\u10f1'}},
-    {u'\u1cb2', {u'\u10f2'}},
-    {u'\u1cb3', {u'\u10f3'}},
-    {u'\u1cb4', {u'\u10f4'}},
-    {u'\u1cb5', {u'\u10f5'}},
-    {u'\u1cb6', {u'\u10f6'}},
-    {u'\u1cb7', {u'\u10f7'}},
-    {u'\u1cb8', {u'\u10f8'}},
-    {u'\u1cb9', {u'\u10f9'}},
-    {u'\u1cba', {u'\u10fa'}},
-    {u'\u1cbd', {u'\u10fd'}},
-    {u'\u1cbe', {u'\u10fe'}},
-    {u'\u1cbf', {u'\u10ff'}},
-    {u'\u1e00', {u'\u1e01'}},
-    {u'\u1e02', {u'\u1e03'}},
-    {u'\u1e04', {u'\u1e05'}},
-    {u'\u1e06', {u'\u1e07'}},
-    {u'\u1e08', {u'\u1e09'}},
-    {u'\u1e0a', {u'\u1e0b'}},
-    {u'\u1e0c', {u'\u1e0d'}},
-    {u'\u1e0e', {u'\u1e0f'}},
-    {u'\u1e10', {u'\u1e11'}},
-    {u'\u1e12', {u'\u1e13'}},
-    {u'\u1e14', {u'\u1e15'}},
-    {u'\u1e16', {u'\u1e17'}},
-    {u'\u1e18', {u'\u1e19'}},
-    {u'\u1e1a', {u'\u1e1b'}},
-    {u'\u1e1c', {u'\u1e1d'}},
-    {u'\u1e1e', {u'\u1e1f'}},
-    {u'\u1e20', {u'\u1e21'}},
-    {u'\u1e22', {u'\u1e23'}},
-    {u'\u1e24', {u'\u1e25'}},
-    {u'\u1e26', {u'\u1e27'}},
-    {u'\u1e28', {u'\u1e29'}},
-    {u'\u1e2a', {u'\u1e2b'}},
-    {u'\u1e2c', {u'\u1e2d'}},
-    {u'\u1e2e', {u'\u1e2f'}},
-    {u'\u1e30', {u'\u1e31'}},
-    {u'\u1e32', {u'\u1e33'}},
-    {u'\u1e34', {u'\u1e35'}},
-    {u'\u1e36', {u'\u1e37'}},
-    {u'\u1e38', {u'\u1e39'}},
-    {u'\u1e3a', {u'\u1e3b'}},
-    {u'\u1e3c', {u'\u1e3d'}},
-    {u'\u1e3e', {u'\u1e3f'}},
-    {u'\u1e40', {u'\u1e41'}},
-    {u'\u1e42', {u'\u1e43'}},
-    {u'\u1e44', {u'\u1e45'}},
-    {u'\u1e46', {u'\u1e47'}},
-    {u'\u1e48', {u'\u1e49'}},
-    {u'\u1e4a', {u'\u1e4b'}},
-    {u'\u1e4c', {u'\u1e4d'}},
-    {u'\u1e4e', {u'\u1e4f'}},
-    {u'\u1e50', {u'\u1e51'}},
-    {u'\u1e52', {u'\u1e53'}},
-    {u'\u1e54', {u'\u1e55'}},
-    {u'\u1e56', {u'\u1e57'}},
-    {u'\u1e58', {u'\u1e59'}},
-    {u'\u1e5a', {u'\u1e5b'}},
-    {u'\u1e5c', {u'\u1e5d'}},
-    {u'\u1e5e', {u'\u1e5f'}},
-    {u'\u1e60', {u'\u1e61'}},
-    {u'\u1e62', {u'\u1e63'}},
-    {u'\u1e64', {u'\u1e65'}},
-    {u'\u1e66', {u'\u1e67'}},
-    {u'\u1e68', {u'\u1e69'}},
-    {u'\u1e6a', {u'\u1e6b'}},
-    {u'\u1e6c', {u'\u1e6d'}},
-    {u'\u1e6e', {u'\u1e6f'}},
-    {u'\u1e70', {u'\u1e71'}},
-    {u'\u1e72', {u'\u1e73'}},
-    {u'\u1e74', {u'\u1e75'}},
-    {u'\u1e76', {u'\u1e77'}},
-    {u'\u1e78', {u'\u1e79'}},
-    {u'\u1e7a', {u'\u1e7b'}},
-    {u'\u1e7c', {u'\u1e7d'}},
-    {u'\u1e7e', {u'\u1e7f'}},
-    {u'\u1e80', {u'\u1e81'}},
-    {u'\u1e82', {u'\u1e83'}},
-    {u'\u1e84', {u'\u1e85'}},
-    {u'\u1e86', {u'\u1e87'}},
-    {u'\u1e88', {u'\u1e89'}},
-    {u'\u1e8a', {u'\u1e8b'}},
-    {u'\u1e8c', {u'\u1e8d'}},
-    {u'\u1e8e', {u'\u1e8f'}},
-    {u'\u1e90', {u'\u1e91'}},
-    {u'\u1e92', {u'\u1e93'}},
-    {u'\u1e94', {u'\u1e95'}},
-    {u'\u1e9e', {u'\u00df'}},
-    {u'\u1ea0', {u'\u1ea1'}},
-    {u'\u1ea2', {u'\u1ea3'}},
-    {u'\u1ea4', {u'\u1ea5'}},
-    {u'\u1ea6', {u'\u1ea7'}},
-    {u'\u1ea8', {u'\u1ea9'}},
-    {u'\u1eaa', {u'\u1eab'}},
-    {u'\u1eac', {u'\u1ead'}},
-    {u'\u1eae', {u'\u1eaf'}},
-    {u'\u1eb0', {u'\u1eb1'}},
-    {u'\u1eb2', {u'\u1eb3'}},
-    {u'\u1eb4', {u'\u1eb5'}},
-    {u'\u1eb6', {u'\u1eb7'}},
-    {u'\u1eb8', {u'\u1eb9'}},
-    {u'\u1eba', {u'\u1ebb'}},
-    {u'\u1ebc', {u'\u1ebd'}},
-    {u'\u1ebe', {u'\u1ebf'}},
-    {u'\u1ec0', {u'\u1ec1'}},
-    {u'\u1ec2', {u'\u1ec3'}},
-    {u'\u1ec4', {u'\u1ec5'}},
-    {u'\u1ec6', {u'\u1ec7'}},
-    {u'\u1ec8', {u'\u1ec9'}},
-    {u'\u1eca', {u'\u1ecb'}},
-    {u'\u1ecc', {u'\u1ecd'}},
-    {u'\u1ece', {u'\u1ecf'}},
-    {u'\u1ed0', {u'\u1ed1'}},
-    {u'\u1ed2', {u'\u1ed3'}},
-    {u'\u1ed4', {u'\u1ed5'}},
-    {u'\u1ed6', {u'\u1ed7'}},
-    {u'\u1ed8', {u'\u1ed9'}},
-    {u'\u1eda', {u'\u1edb'}},
-    {u'\u1edc', {u'\u1edd'}},
-    {u'\u1ede', {u'\u1edf'}},
-    {u'\u1ee0', {u'\u1ee1'}},
-    {u'\u1ee2', {u'\u1ee3'}},
-    {u'\u1ee4', {u'\u1ee5'}},
-    {u'\u1ee6', {u'\u1ee7'}},
-    {u'\u1ee8', {u'\u1ee9'}},
-    {u'\u1eea', {u'\u1eeb'}},
-    {u'\u1eec', {u'\u1eed'}},
-    {u'\u1eee', {u'\u1eef'}},
-    {u'\u1ef0', {u'\u1ef1'}},
-    {u'\u1ef2', {u'\u1ef3'}},
-    {u'\u1ef4', {u'\u1ef5'}},
-    {u'\u1ef6', {u'\u1ef7'}},
-    {u'\u1ef8', {u'\u1ef9'}},
-    {u'\u1efa', {u'\u1efb'}},
-    {u'\u1efc', {u'\u1efd'}},
-    {u'\u1efe', {u'\u1eff'}},
-    {u'\u1f08', {u'\u1f00'}},
-    {u'\u1f09', {u'\u1f01'}},
-    {u'\u1f0a', {u'\u1f02'}},
-    {u'\u1f0b', {u'\u1f03'}},
-    {u'\u1f0c', {u'\u1f04'}},
-    {u'\u1f0d', {u'\u1f05'}},
-    {u'\u1f0e', {u'\u1f06'}},
-    {u'\u1f0f', {u'\u1f07'}},
-    {u'\u1f18', {u'\u1f10'}},
-    {u'\u1f19', {u'\u1f11'}},
-    {u'\u1f1a', {u'\u1f12'}},
-    {u'\u1f1b', {u'\u1f13'}},
-    {u'\u1f1c', {u'\u1f14'}},
-    {u'\u1f1d', {u'\u1f15'}},
-    {u'\u1f28', {u'\u1f20'}},
-    {u'\u1f29', {u'\u1f21'}},
-    {u'\u1f2a', {u'\u1f22'}},
-    {u'\u1f2b', {u'\u1f23'}},
-    {u'\u1f2c', {u'\u1f24'}},
-    {u'\u1f2d', {u'\u1f25'}},
-    {u'\u1f2e', {u'\u1f26'}},
-    {u'\u1f2f', {u'\u1f27'}},
-    {u'\u1f38', {u'\u1f30'}},
-    {u'\u1f39', {u'\u1f31'}},
-    {u'\u1f3a', {u'\u1f32'}},
-    {u'\u1f3b', {u'\u1f33'}},
-    {u'\u1f3c', {u'\u1f34'}},
-    {u'\u1f3d', {u'\u1f35'}},
-    {u'\u1f3e', {u'\u1f36'}},
-    {u'\u1f3f', {u'\u1f37'}},
-    {u'\u1f48', {u'\u1f40'}},
-    {u'\u1f49', {u'\u1f41'}},
-    {u'\u1f4a', {u'\u1f42'}},
-    {u'\u1f4b', {u'\u1f43'}},
-    {u'\u1f4c', {u'\u1f44'}},
-    {u'\u1f4d', {u'\u1f45'}},
-    {u'\u1f59', {u'\u1f51'}},
-    {u'\u1f5b', {u'\u1f53'}},
-    {u'\u1f5d', {u'\u1f55'}},
-    {u'\u1f5f', {u'\u1f57'}},
-    {u'\u1f68', {u'\u1f60'}},
-    {u'\u1f69', {u'\u1f61'}},
-    {u'\u1f6a', {u'\u1f62'}},
-    {u'\u1f6b', {u'\u1f63'}},
-    {u'\u1f6c', {u'\u1f64'}},
-    {u'\u1f6d', {u'\u1f65'}},
-    {u'\u1f6e', {u'\u1f66'}},
-    {u'\u1f6f', {u'\u1f67'}},
-    {u'\u1f88', {u'\u1f80'}},
-    {u'\u1f89', {u'\u1f81'}},
-    {u'\u1f8a', {u'\u1f82'}},
-    {u'\u1f8b', {u'\u1f83'}},
-    {u'\u1f8c', {u'\u1f84'}},
-    {u'\u1f8d', {u'\u1f85'}},
-    {u'\u1f8e', {u'\u1f86'}},
-    {u'\u1f8f', {u'\u1f87'}},
-    {u'\u1f98', {u'\u1f90'}},
-    {u'\u1f99', {u'\u1f91'}},
-    {u'\u1f9a', {u'\u1f92'}},
-    {u'\u1f9b', {u'\u1f93'}},
-    {u'\u1f9c', {u'\u1f94'}},
-    {u'\u1f9d', {u'\u1f95'}},
-    {u'\u1f9e', {u'\u1f96'}},
-    {u'\u1f9f', {u'\u1f97'}},
-    {u'\u1fa8', {u'\u1fa0'}},
-    {u'\u1fa9', {u'\u1fa1'}},
-    {u'\u1faa', {u'\u1fa2'}},
-    {u'\u1fab', {u'\u1fa3'}},
-    {u'\u1fac', {u'\u1fa4'}},
-    {u'\u1fad', {u'\u1fa5'}},
-    {u'\u1fae', {u'\u1fa6'}},
-    {u'\u1faf', {u'\u1fa7'}},
-    {u'\u1fb8', {u'\u1fb0'}},
-    {u'\u1fb9', {u'\u1fb1'}},
-    {u'\u1fba', {u'\u1f70'}},
-    {u'\u1fbb', {u'\u1f71'}},
-    {u'\u1fbc', {u'\u1fb3'}},
-    {u'\u1fc8', {u'\u1f72'}},
-    {u'\u1fc9', {u'\u1f73'}},
-    {u'\u1fca', {u'\u1f74'}},
-    {u'\u1fcb', {u'\u1f75'}},
-    {u'\u1fcc', {u'\u1fc3'}},
-    {u'\u1fd8', {u'\u1fd0'}},
-    {u'\u1fd9', {u'\u1fd1'}},
-    {u'\u1fda', {u'\u1f76'}},
-    {u'\u1fdb', {u'\u1f77'}},
-    {u'\u1fe8', {u'\u1fe0'}},
-    {u'\u1fe9', {u'\u1fe1'}},
-    {u'\u1fea', {u'\u1f7a'}},
-    {u'\u1feb', {u'\u1f7b'}},
-    {u'\u1fec', {u'\u1fe5'}},
-    {u'\u1ff8', {u'\u1f78'}},
-    {u'\u1ff9', {u'\u1f79'}},
-    {u'\u1ffa', {u'\u1f7c'}},
-    {u'\u1ffb', {u'\u1f7d'}},
-    {u'\u1ffc', {u'\u1ff3'}},
-    {u'\u2126', {u'\u03c9'}},
-    {u'\u212a', {'k'}},
-    {u'\u212b', {u'\u00e5'}},
-    {u'\u2132', {u'\u214e'}},
-    {u'\u2160', {u'\u2170'}},
-    {u'\u2161', {u'\u2171'}},
-    {u'\u2162', {u'\u2172'}},
-    {u'\u2163', {u'\u2173'}},
-    {u'\u2164', {u'\u2174'}},
-    {u'\u2165', {u'\u2175'}},
-    {u'\u2166', {u'\u2176'}},
-    {u'\u2167', {u'\u2177'}},
-    {u'\u2168', {u'\u2178'}},
-    {u'\u2169', {u'\u2179'}},
-    {u'\u216a', {u'\u217a'}},
-    {u'\u216b', {u'\u217b'}},
-    {u'\u216c', {u'\u217c'}},
-    {u'\u216d', {u'\u217d'}},
-    {u'\u216e', {u'\u217e'}},
-    {u'\u216f', {u'\u217f'}},
-    {u'\u2183', {u'\u2184'}},
-    {u'\u24b6', {u'\u24d0'}},
-    {u'\u24b7', {u'\u24d1'}},
-    {u'\u24b8', {u'\u24d2'}},
-    {u'\u24b9', {u'\u24d3'}},
-    {u'\u24ba', {u'\u24d4'}},
-    {u'\u24bb', {u'\u24d5'}},
-    {u'\u24bc', {u'\u24d6'}},
-    {u'\u24bd', {u'\u24d7'}},
-    {u'\u24be', {u'\u24d8'}},
-    {u'\u24bf', {u'\u24d9'}},
-    {u'\u24c0', {u'\u24da'}},
-    {u'\u24c1', {u'\u24db'}},
-    {u'\u24c2', {u'\u24dc'}},
-    {u'\u24c3', {u'\u24dd'}},
-    {u'\u24c4', {u'\u24de'}},
-    {u'\u24c5', {u'\u24df'}},
-    {u'\u24c6', {u'\u24e0'}},
-    {u'\u24c7', {u'\u24e1'}},
-    {u'\u24c8', {u'\u24e2'}},
-    {u'\u24c9', {u'\u24e3'}},
-    {u'\u24ca', {u'\u24e4'}},
-    {u'\u24cb', {u'\u24e5'}},
-    {u'\u24cc', {u'\u24e6'}},
-    {u'\u24cd', {u'\u24e7'}},
-    {u'\u24ce', {u'\u24e8'}},
-    {u'\u24cf', {u'\u24e9'}},
-    {u'\u2c00', {u'\u2c30'}},
-    {u'\u2c01', {u'\u2c31'}},
-    {u'\u2c02', {u'\u2c32'}},
-    {u'\u2c03', {u'\u2c33'}},
-    {u'\u2c04', {u'\u2c34'}},
-    {u'\u2c05', {u'\u2c35'}},
-    {u'\u2c06', {u'\u2c36'}},
-    {u'\u2c07', {u'\u2c37'}},
-    {u'\u2c08', {u'\u2c38'}},
-    {u'\u2c09', {u'\u2c39'}},
-    {u'\u2c0a', {u'\u2c3a'}},
-    {u'\u2c0b', {u'\u2c3b'}},
-    {u'\u2c0c', {u'\u2c3c'}},
-    {u'\u2c0d', {u'\u2c3d'}},
-    {u'\u2c0e', {u'\u2c3e'}},
-    {u'\u2c0f', {u'\u2c3f'}},
-    {u'\u2c10', {u'\u2c40'}},
-    {u'\u2c11', {u'\u2c41'}},
-    {u'\u2c12', {u'\u2c42'}},
-    {u'\u2c13', {u'\u2c43'}},
-    {u'\u2c14', {u'\u2c44'}},
-    {u'\u2c15', {u'\u2c45'}},
-    {u'\u2c16', {u'\u2c46'}},
-    {u'\u2c17', {u'\u2c47'}},
-    {u'\u2c18', {u'\u2c48'}},
-    {u'\u2c19', {u'\u2c49'}},
-    {u'\u2c1a', {u'\u2c4a'}},
-    {u'\u2c1b', {u'\u2c4b'}},
-    {u'\u2c1c', {u'\u2c4c'}},
-    {u'\u2c1d', {u'\u2c4d'}},
-    {u'\u2c1e', {u'\u2c4e'}},
-    {u'\u2c1f', {u'\u2c4f'}},
-    {u'\u2c20', {u'\u2c50'}},
-    {u'\u2c21', {u'\u2c51'}},
-    {u'\u2c22', {u'\u2c52'}},
-    {u'\u2c23', {u'\u2c53'}},
-    {u'\u2c24', {u'\u2c54'}},
-    {u'\u2c25', {u'\u2c55'}},
-    {u'\u2c26', {u'\u2c56'}},
-    {u'\u2c27', {u'\u2c57'}},
-    {u'\u2c28', {u'\u2c58'}},
-    {u'\u2c29', {u'\u2c59'}},
-    {u'\u2c2a', {u'\u2c5a'}},
-    {u'\u2c2b', {u'\u2c5b'}},
-    {u'\u2c2c', {u'\u2c5c'}},
-    {u'\u2c2d', {u'\u2c5d'}},
-    {u'\u2c2e', {u'\u2c5e'}},
-    {u'\u2c2f', {u'\u2c5f'}},
-    {u'\u2c60', {u'\u2c61'}},
-    {u'\u2c62', {u'\u026b'}},
-    {u'\u2c63', {u'\u1d7d'}},
-    {u'\u2c64', {u'\u027d'}},
-    {u'\u2c67', {u'\u2c68'}},
-    {u'\u2c69', {u'\u2c6a'}},
-    {u'\u2c6b', {u'\u2c6c'}},
-    {u'\u2c6d', {u'\u0251'}},
-    {u'\u2c6e', {u'\u0271'}},
-    {u'\u2c6f', {u'\u0250'}},
-    {u'\u2c70', {u'\u0252'}},
-    {u'\u2c72', {u'\u2c73'}},
-    {u'\u2c75', {u'\u2c76'}},
-    {u'\u2c7e', {u'\u023f'}},
-    {u'\u2c7f', {u'\u0240'}},
-    {u'\u2c80', {u'\u2c81'}},
-    {u'\u2c82', {u'\u2c83'}},
-    {u'\u2c84', {u'\u2c85'}},
-    {u'\u2c86', {u'\u2c87'}},
-    {u'\u2c88', {u'\u2c89'}},
-    {u'\u2c8a', {u'\u2c8b'}},
-    {u'\u2c8c', {u'\u2c8d'}},
-    {u'\u2c8e', {u'\u2c8f'}},
-    {u'\u2c90', {u'\u2c91'}},
-    {u'\u2c92', {u'\u2c93'}},
-    {u'\u2c94', {u'\u2c95'}},
-    {u'\u2c96', {u'\u2c97'}},
-    {u'\u2c98', {u'\u2c99'}},
-    {u'\u2c9a', {u'\u2c9b'}},
-    {u'\u2c9c', {u'\u2c9d'}},
-    {u'\u2c9e', {u'\u2c9f'}},
-    {u'\u2ca0', {u'\u2ca1'}},
-    {u'\u2ca2', {u'\u2ca3'}},
-    {u'\u2ca4', {u'\u2ca5'}},
-    {u'\u2ca6', {u'\u2ca7'}},
-    {u'\u2ca8', {u'\u2ca9'}},
-    {u'\u2caa', {u'\u2cab'}},
-    {u'\u2cac', {u'\u2cad'}},
-    {u'\u2cae', {u'\u2caf'}},
-    {u'\u2cb0', {u'\u2cb1'}},
-    {u'\u2cb2', {u'\u2cb3'}},
-    {u'\u2cb4', {u'\u2cb5'}},
-    {u'\u2cb6', {u'\u2cb7'}},
-    {u'\u2cb8', {u'\u2cb9'}},
-    {u'\u2cba', {u'\u2cbb'}},
-    {u'\u2cbc', {u'\u2cbd'}},
-    {u'\u2cbe', {u'\u2cbf'}},
-    {u'\u2cc0', {u'\u2cc1'}},
-    {u'\u2cc2', {u'\u2cc3'}},
-    {u'\u2cc4', {u'\u2cc5'}},
-    {u'\u2cc6', {u'\u2cc7'}},
-    {u'\u2cc8', {u'\u2cc9'}},
-    {u'\u2cca', {u'\u2ccb'}},
-    {u'\u2ccc', {u'\u2ccd'}},
-    {u'\u2cce', {u'\u2ccf'}},
-    {u'\u2cd0', {u'\u2cd1'}},
-    {u'\u2cd2', {u'\u2cd3'}},
-    {u'\u2cd4', {u'\u2cd5'}},
-    {u'\u2cd6', {u'\u2cd7'}},
-    {u'\u2cd8', {u'\u2cd9'}},
-    {u'\u2cda', {u'\u2cdb'}},
-    {u'\u2cdc', {u'\u2cdd'}},
-    {u'\u2cde', {u'\u2cdf'}},
-    {u'\u2ce0', {u'\u2ce1'}},
-    {u'\u2ce2', {u'\u2ce3'}},
-    {u'\u2ceb', {u'\u2cec'}},
-    {u'\u2ced', {u'\u2cee'}},
-    {u'\u2cf2', {u'\u2cf3'}},
-    {u'\ua640', {u'\ua641'}},
-    {u'\ua642', {u'\ua643'}},
-    {u'\ua644', {u'\ua645'}},
-    {u'\ua646', {u'\ua647'}},
-    {u'\ua648', {u'\ua649'}},
-    {u'\ua64a', {u'\ua64b'}},
-    {u'\ua64c', {u'\ua64d'}},
-    {u'\ua64e', {u'\ua64f'}},
-    {u'\ua650', {u'\ua651'}},
-    {u'\ua652', {u'\ua653'}},
-    {u'\ua654', {u'\ua655'}},
-    {u'\ua656', {u'\ua657'}},
-    {u'\ua658', {u'\ua659'}},
-    {u'\ua65a', {u'\ua65b'}},
-    {u'\ua65c', {u'\ua65d'}},
-    {u'\ua65e', {u'\ua65f'}},
-    {u'\ua660', {u'\ua661'}},
-    {u'\ua662', {u'\ua663'}},
-    {u'\ua664', {u'\ua665'}},
-    {u'\ua666', {u'\ua667'}},
-    {u'\ua668', {u'\ua669'}},
-    {u'\ua66a', {u'\ua66b'}},
-    {u'\ua66c', {u'\ua66d'}},
-    {u'\ua680', {u'\ua681'}},
-    {u'\ua682', {u'\ua683'}},
-    {u'\ua684', {u'\ua685'}},
-    {u'\ua686', {u'\ua687'}},
-    {u'\ua688', {u'\ua689'}},
-    {u'\ua68a', {u'\ua68b'}},
-    {u'\ua68c', {u'\ua68d'}},
-    {u'\ua68e', {u'\ua68f'}},
-    {u'\ua690', {u'\ua691'}},
-    {u'\ua692', {u'\ua693'}},
-    {u'\ua694', {u'\ua695'}},
-    {u'\ua696', {u'\ua697'}},
-    {u'\ua698', {u'\ua699'}},
-    {u'\ua69a', {u'\ua69b'}},
-    {u'\ua722', {u'\ua723'}},
-    {u'\ua724', {u'\ua725'}},
-    {u'\ua726', {u'\ua727'}},
-    {u'\ua728', {u'\ua729'}},
-    {u'\ua72a', {u'\ua72b'}},
-    {u'\ua72c', {u'\ua72d'}},
-    {u'\ua72e', {u'\ua72f'}},
-    {u'\ua732', {u'\ua733'}},
-    {u'\ua734', {u'\ua735'}},
-    {u'\ua736', {u'\ua737'}},
-    {u'\ua738', {u'\ua739'}},
-    {u'\ua73a', {u'\ua73b'}},
-    {u'\ua73c', {u'\ua73d'}},
-    {u'\ua73e', {u'\ua73f'}},
-    {u'\ua740', {u'\ua741'}},
-    {u'\ua742', {u'\ua743'}},
-    {u'\ua744', {u'\ua745'}},
-    {u'\ua746', {u'\ua747'}},
-    {u'\ua748', {u'\ua749'}},
-    {u'\ua74a', {u'\ua74b'}},
-    {u'\ua74c', {u'\ua74d'}},
-    {u'\ua74e', {u'\ua74f'}},
-    {u'\ua750', {u'\ua751'}},
-    {u'\ua752', {u'\ua753'}},
-    {u'\ua754', {u'\ua755'}},
-    {u'\ua756', {u'\ua757'}},
-    {u'\ua758', {u'\ua759'}},
-    {u'\ua75a', {u'\ua75b'}},
-    {u'\ua75c', {u'\ua75d'}},
-    {u'\ua75e', {u'\ua75f'}},
-    {u'\ua760', {u'\ua761'}},
-    {u'\ua762', {u'\ua763'}},
-    {u'\ua764', {u'\ua765'}},
-    {u'\ua766', {u'\ua767'}},
-    {u'\ua768', {u'\ua769'}},
-    {u'\ua76a', {u'\ua76b'}},
-    {u'\ua76c', {u'\ua76d'}},
-    {u'\ua76e', {u'\ua76f'}},
-    {u'\ua779', {u'\ua77a'}},
-    {u'\ua77b', {u'\ua77c'}},
-    {u'\ua77d', {u'\u1d79'}},
-    {u'\ua77e', {u'\ua77f'}},
-    {u'\ua780', {u'\ua781'}},
-    {u'\ua782', {u'\ua783'}},
-    {u'\ua784', {u'\ua785'}},
-    {u'\ua786', {u'\ua787'}},
-    {u'\ua78b', {u'\ua78c'}},
-    {u'\ua78d', {u'\u0265'}},
-    {u'\ua790', {u'\ua791'}},
-    {u'\ua792', {u'\ua793'}},
-    {u'\ua796', {u'\ua797'}},
-    {u'\ua798', {u'\ua799'}},
-    {u'\ua79a', {u'\ua79b'}},
-    {u'\ua79c', {u'\ua79d'}},
-    {u'\ua79e', {u'\ua79f'}},
-    {u'\ua7a0', {u'\ua7a1'}},
-    {u'\ua7a2', {u'\ua7a3'}},
-    {u'\ua7a4', {u'\ua7a5'}},
-    {u'\ua7a6', {u'\ua7a7'}},
-    {u'\ua7a8', {u'\ua7a9'}},
-    {u'\ua7aa', {u'\u0266'}},
-    {u'\ua7ab', {u'\u025c'}},
-    {u'\ua7ac', {u'\u0261'}},
-    {u'\ua7ad', {u'\u026c'}},
-    {u'\ua7ae', {u'\u026a'}},
-    {u'\ua7b0', {u'\u029e'}},
-    {u'\ua7b1', {u'\u0287'}},
-    {u'\ua7b2', {u'\u029d'}},
-    {u'\ua7b3', {u'\uab53'}},
-    {u'\ua7b4', {u'\ua7b5'}},
-    {u'\ua7b6', {u'\ua7b7'}},
-    {u'\ua7b8', {u'\ua7b9'}},
-    {u'\ua7ba', {u'\ua7bb'}},
-    {u'\ua7bc', {u'\ua7bd'}},
-    {u'\ua7be', {u'\ua7bf'}},
-    {u'\ua7c0', {u'\ua7c1'}},
-    {u'\ua7c2', {u'\ua7c3'}},
-    {u'\ua7c4', {u'\ua794'}},
-    {u'\ua7c5', {u'\u0282'}},
-    {u'\ua7c6', {u'\u1d8e'}},
-    {u'\ua7c7', {u'\ua7c8'}},
-    {u'\ua7c9', {u'\ua7ca'}},
-    {u'\ua7d0', {u'\ua7d1'}},
-    {u'\ua7d6', {u'\ua7d7'}},
-    {u'\ua7d8', {u'\ua7d9'}},
-    {u'\ua7f5', {u'\ua7f6'}},
-    {u'\uff21', {u'\uff41'}},
-    {u'\uff22', {u'\uff42'}},
-    {u'\uff23', {u'\uff43'}},
-    {u'\uff24', {u'\uff44'}},
-    {u'\uff25', {u'\uff45'}},
-    {u'\uff26', {u'\uff46'}},
-    {u'\uff27', {u'\uff47'}},
-    {u'\uff28', {u'\uff48'}},
-    {u'\uff29', {u'\uff49'}},
-    {u'\uff2a', {u'\uff4a'}},
-    {u'\uff2b', {u'\uff4b'}},
-    {u'\uff2c', {u'\uff4c'}},
-    {u'\uff2d', {u'\uff4d'}},
-    {u'\uff2e', {u'\uff4e'}},
-    {u'\uff2f', {u'\uff4f'}},
-    {u'\uff30', {u'\uff50'}},
-    {u'\uff31', {u'\uff51'}},
-    {u'\uff32', {u'\uff52'}},
-    {u'\uff33', {u'\uff53'}},
-    {u'\uff34', {u'\uff54'}},
-    {u'\uff35', {u'\uff55'}},
-    {u'\uff36', {u'\uff56'}},
-    {u'\uff37', {u'\uff57'}},
-    {u'\uff38', {u'\uff58'}},
-    {u'\uff39', {u'\uff59'}},
-    {u'\uff3a', {u'\uff5a'}},
-    {U'\U00010400', {U'\U00010428'}},
-    {U'\U00010401', {U'\U00010429'}},
-    {U'\U00010402', {U'\U0001042a'}},
-    {U'\U00010403', {U'\U0001042b'}},
-    {U'\U00010404', {U'\U0001042c'}},
-    {U'\U00010405', {U'\U0001042d'}},
-    {U'\U00010406', {U'\U0001042e'}},
-    {U'\U00010407', {U'\U0001042f'}},
-    {U'\U00010408', {U'\U00010430'}},
-    {U'\U00010409', {U'\U00010431'}},
-    {U'\U0001040a', {U'\U00010432'}},
-    {U'\U0001040b', {U'\U00010433'}},
-    {U'\U0001040c', {U'\U00010434'}},
-    {U'\U0001040d', {U'\U00010435'}},
-    {U'\U0001040e', {U'\U00010436'}},
-    {U'\U0001040f', {U'\U00010437'}},
-    {U'\U00010410', {U'\U00010438'}},
-    {U'\U00010411', {U'\U00010439'}},
-    {U'\U00010412', {U'\U0001043a'}},
-    {U'\U00010413', {U'\U0001043b'}},
-    {U'\U00010414', {U'\U0001043c'}},
-    {U'\U00010415', {U'\U0001043d'}},
-    {U'\U00010416', {U'\U0001043e'}},
-    {U'\U00010417', {U'\U0001043f'}},
-    {U'\U00010418', {U'\U00010440'}},
-    {U'\U00010419', {U'\U00010441'}},
-    {U'\U0001041a', {U'\U00010442'}},
-    {U'\U0001041b', {U'\U00010443'}},
-    {U'\U0001041c', {U'\U00010444'}},
-    {U'\U0001041d', {U'\U00010445'}},
-    {U'\U0001041e', {U'\U00010446'}},
-    {U'\U0001041f', {U'\U00010447'}},
-    {U'\U00010420', {U'\U00010448'}},
-    {U'\U00010421', {U'\U00010449'}},
-    {U'\U00010422', {U'\U0001044a'}},
-    {U'\U00010423', {U'\U0001044b'}},
-    {U'\U00010424', {U'\U0001044c'}},
-    {U'\U00010425', {U'\U0001044d'}},
-    {U'\U00010426', {U'\U0001044e'}},
-    {U'\U00010427', {U'\U0001044f'}},
-    {U'\U000104b0', {U'\U000104d8'}},
-    {U'\U000104b1', {U'\U000104d9'}},
-    {U'\U000104b2', {U'\U000104da'}},
-    {U'\U000104b3', {U'\U000104db'}},
-    {U'\U000104b4', {U'\U000104dc'}},
-    {U'\U000104b5', {U'\U000104dd'}},
-    {U'\U000104b6', {U'\U000104de'}},
-    {U'\U000104b7', {U'\U000104df'}},
-    {U'\U000104b8', {U'\U000104e0'}},
-    {U'\U000104b9', {U'\U000104e1'}},
-    {U'\U000104ba', {U'\U000104e2'}},
-    {U'\U000104bb', {U'\U000104e3'}},
-    {U'\U000104bc', {U'\U000104e4'}},
-    {U'\U000104bd', {U'\U000104e5'}},
-    {U'\U000104be', {U'\U000104e6'}},
-    {U'\U000104bf', {U'\U000104e7'}},
-    {U'\U000104c0', {U'\U000104e8'}},
-    {U'\U000104c1', {U'\U000104e9'}},
-    {U'\U000104c2', {U'\U000104ea'}},
-    {U'\U000104c3', {U'\U000104eb'}},
-    {U'\U000104c4', {U'\U000104ec'}},
-    {U'\U000104c5', {U'\U000104ed'}},
-    {U'\U000104c6', {U'\U000104ee'}},
-    {U'\U000104c7', {U'\U000104ef'}},
-    {U'\U000104c8', {U'\U000104f0'}},
-    {U'\U000104c9', {U'\U000104f1'}},
-    {U'\U000104ca', {U'\U000104f2'}},
-    {U'\U000104cb', {U'\U000104f3'}},
-    {U'\U000104cc', {U'\U000104f4'}},
-    {U'\U000104cd', {U'\U000104f5'}},
-    {U'\U000104ce', {U'\U000104f6'}},
-    {U'\U000104cf', {U'\U000104f7'}},
-    {U'\U000104d0', {U'\U000104f8'}},
-    {U'\U000104d1', {U'\U000104f9'}},
-    {U'\U000104d2', {U'\U000104fa'}},
-    {U'\U000104d3', {U'\U000104fb'}},
-    {U'\U00010570', {U'\U00010597'}},
-    {U'\U00010571', {U'\U00010598'}},
-    {U'\U00010572', {U'\U00010599'}},
-    {U'\U00010573', {U'\U0001059a'}},
-    {U'\U00010574', {U'\U0001059b'}},
-    {U'\U00010575', {U'\U0001059c'}},
-    {U'\U00010576', {U'\U0001059d'}},
-    {U'\U00010577', {U'\U0001059e'}},
-    {U'\U00010578', {U'\U0001059f'}},
-    {U'\U00010579', {U'\U000105a0'}},
-    {U'\U0001057a', {U'\U000105a1'}},
-    {U'\U0001057c', {U'\U000105a3'}},
-    {U'\U0001057d', {U'\U000105a4'}},
-    {U'\U0001057e', {U'\U000105a5'}},
-    {U'\U0001057f', {U'\U000105a6'}},
-    {U'\U00010580', {U'\U000105a7'}},
-    {U'\U00010581', {U'\U000105a8'}},
-    {U'\U00010582', {U'\U000105a9'}},
-    {U'\U00010583', {U'\U000105aa'}},
-    {U'\U00010584', {U'\U000105ab'}},
-    {U'\U00010585', {U'\U000105ac'}},
-    {U'\U00010586', {U'\U000105ad'}},
-    {U'\U00010587', {U'\U000105ae'}},
-    {U'\U00010588', {U'\U000105af'}},
-    {U'\U00010589', {U'\U000105b0'}},
-    {U'\U0001058a', {U'\U000105b1'}},
-    {U'\U0001058c', {U'\U000105b3'}},
-    {U'\U0001058d', {U'\U000105b4'}},
-    {U'\U0001058e', {U'\U000105b5'}},
-    {U'\U0001058f', {U'\U000105b6'}},
-    {U'\U00010590', {U'\U000105b7'}},
-    {U'\U00010591', {U'\U000105b8'}},
-    {U'\U00010592', {U'\U000105b9'}},
-    {U'\U00010594', {U'\U000105bb'}},
-    {U'\U00010595', {U'\U000105bc'}},
-    {U'\U00010c80', {U'\U00010cc0'}},
-    {U'\U00010c81', {U'\U00010cc1'}},
-    {U'\U00010c82', {U'\U00010cc2'}},
-    {U'\U00010c83', {U'\U00010cc3'}},
-    {U'\U00010c84', {U'\U00010cc4'}},
-    {U'\U00010c85', {U'\U00010cc5'}},
-    {U'\U00010c86', {U'\U00010cc6'}},
-    {U'\U00010c87', {U'\U00010cc7'}},
-    {U'\U00010c88', {U'\U00010cc8'}},
-    {U'\U00010c89', {U'\U00010cc9'}},
-    {U'\U00010c8a', {U'\U00010cca'}},
-    {U'\U00010c8b', {U'\U00010ccb'}},
-    {U'\U00010c8c', {U'\U00010ccc'}},
-    {U'\U00010c8d', {U'\U00010ccd'}},
-    {U'\U00010c8e', {U'\U00010cce'}},
-    {U'\U00010c8f', {U'\U00010ccf'}},
-    {U'\U00010c90', {U'\U00010cd0'}},
-    {U'\U00010c91', {U'\U00010cd1'}},
-    {U'\U00010c92', {U'\U00010cd2'}},
-    {U'\U00010c93', {U'\U00010cd3'}},
-    {U'\U00010c94', {U'\U00010cd4'}},
-    {U'\U00010c95', {U'\U00010cd5'}},
-    {U'\U00010c96', {U'\U00010cd6'}},
-    {U'\U00010c97', {U'\U00010cd7'}},
-    {U'\U00010c98', {U'\U00010cd8'}},
-    {U'\U00010c99', {U'\U00010cd9'}},
-    {U'\U00010c9a', {U'\U00010cda'}},
-    {U'\U00010c9b', {U'\U00010cdb'}},
-    {U'\U00010c9c', {U'\U00010cdc'}},
-    {U'\U00010c9d', {U'\U00010cdd'}},
-    {U'\U00010c9e', {U'\U00010cde'}},
-    {U'\U00010c9f', {U'\U00010cdf'}},
-    {U'\U00010ca0', {U'\U00010ce0'}},
-    {U'\U00010ca1', {U'\U00010ce1'}},
-    {U'\U00010ca2', {U'\U00010ce2'}},
-    {U'\U00010ca3', {U'\U00010ce3'}},
-    {U'\U00010ca4', {U'\U00010ce4'}},
-    {U'\U00010ca5', {U'\U00010ce5'}},
-    {U'\U00010ca6', {U'\U00010ce6'}},
-    {U'\U00010ca7', {U'\U00010ce7'}},
-    {U'\U00010ca8', {U'\U00010ce8'}},
-    {U'\U00010ca9', {U'\U00010ce9'}},
-    {U'\U00010caa', {U'\U00010cea'}},
-    {U'\U00010cab', {U'\U00010ceb'}},
-    {U'\U00010cac', {U'\U00010cec'}},
-    {U'\U00010cad', {U'\U00010ced'}},
-    {U'\U00010cae', {U'\U00010cee'}},
-    {U'\U00010caf', {U'\U00010cef'}},
-    {U'\U00010cb0', {U'\U00010cf0'}},
-    {U'\U00010cb1', {U'\U00010cf1'}},
-    {U'\U00010cb2', {U'\U00010cf2'}},
-    {U'\U000118a0', {U'\U000118c0'}},
-    {U'\U000118a1', {U'\U000118c1'}},
-    {U'\U000118a2', {U'\U000118c2'}},
-    {U'\U000118a3', {U'\U000118c3'}},
-    {U'\U000118a4', {U'\U000118c4'}},
-    {U'\U000118a5', {U'\U000118c5'}},
-    {U'\U000118a6', {U'\U000118c6'}},
-    {U'\U000118a7', {U'\U000118c7'}},
-    {U'\U000118a8', {U'\U000118c8'}},
-    {U'\U000118a9', {U'\U000118c9'}},
-    {U'\U000118aa', {U'\U000118ca'}},
-    {U'\U000118ab', {U'\U000118cb'}},
-    {U'\U000118ac', {U'\U000118cc'}},
-    {U'\U000118ad', {U'\U000118cd'}},
-    {U'\U000118ae', {U'\U000118ce'}},
-    {U'\U000118af', {U'\U000118cf'}},
-    {U'\U000118b0', {U'\U000118d0'}},
-    {U'\U000118b1', {U'\U000118d1'}},
-    {U'\U000118b2', {U'\U000118d2'}},
-    {U'\U000118b3', {U'\U000118d3'}},
-    {U'\U000118b4', {U'\U000118d4'}},
-    {U'\U000118b5', {U'\U000118d5'}},
-    {U'\U000118b6', {U'\U000118d6'}},
-    {U'\U000118b7', {U'\U000118d7'}},
-    {U'\U000118b8', {U'\U000118d8'}},
-    {U'\U000118b9', {U'\U000118d9'}},
-    {U'\U000118ba', {U'\U000118da'}},
-    {U'\U000118bb', {U'\U000118db'}},
-    {U'\U000118bc', {U'\U000118dc'}},
-    {U'\U000118bd', {U'\U000118dd'}},
-    {U'\U000118be', {U'\U000118de'}},
-    {U'\U000118bf', {U'\U000118df'}},
-    {U'\U00016e40', {U'\U00016e60'}},
-    {U'\U00016e41', {U'\U00016e61'}},
-    {U'\U00016e42', {U'\U00016e62'}},
-    {U'\U00016e43', {U'\U00016e63'}},
-    {U'\U00016e44', {U'\U00016e64'}},
-    {U'\U00016e45', {U'\U00016e65'}},
-    {U'\U00016e46', {U'\U00016e66'}},
-    {U'\U00016e47', {U'\U00016e67'}},
-    {U'\U00016e48', {U'\U00016e68'}},
-    {U'\U00016e49', {U'\U00016e69'}},
-    {U'\U00016e4a', {U'\U00016e6a'}},
-    {U'\U00016e4b', {U'\U00016e6b'}},
-    {U'\U00016e4c', {U'\U00016e6c'}},
-    {U'\U00016e4d', {U'\U00016e6d'}},
-    {U'\U00016e4e', {U'\U00016e6e'}},
-    {U'\U00016e4f', {U'\U00016e6f'}},
-    {U'\U00016e50', {U'\U00016e70'}},
-    {U'\U00016e51', {U'\U00016e71'}},
-    {U'\U00016e52', {U'\U00016e72'}},
-    {U'\U00016e53', {U'\U00016e73'}},
-    {U'\U00016e54', {U'\U00016e74'}},
-    {U'\U00016e55', {U'\U00016e75'}},
-    {U'\U00016e56', {U'\U00016e76'}},
-    {U'\U00016e57', {U'\U00016e77'}},
-    {U'\U00016e58', {U'\U00016e78'}},
-    {U'\U00016e59', {U'\U00016e79'}},
-    {U'\U00016e5a', {U'\U00016e7a'}},
-    {U'\U00016e5b', {U'\U00016e7b'}},
-    {U'\U00016e5c', {U'\U00016e7c'}},
-    {U'\U00016e5d', {U'\U00016e7d'}},
-    {U'\U00016e5e', {U'\U00016e7e'}},
-    {U'\U00016e5f', {U'\U00016e7f'}},
-    {U'\U0001e900', {U'\U0001e922'}},
-    {U'\U0001e901', {U'\U0001e923'}},
-    {U'\U0001e902', {U'\U0001e924'}},
-    {U'\U0001e903', {U'\U0001e925'}},
-    {U'\U0001e904', {U'\U0001e926'}},
-    {U'\U0001e905', {U'\U0001e927'}},
-    {U'\U0001e906', {U'\U0001e928'}},
-    {U'\U0001e907', {U'\U0001e929'}},
-    {U'\U0001e908', {U'\U0001e92a'}},
-    {U'\U0001e909', {U'\U0001e92b'}},
-    {U'\U0001e90a', {U'\U0001e92c'}},
-    {U'\U0001e90b', {U'\U0001e92d'}},
-    {U'\U0001e90c', {U'\U0001e92e'}},
-    {U'\U0001e90d', {U'\U0001e92f'}},
-    {U'\U0001e90e', {U'\U0001e930'}},
-    {U'\U0001e90f', {U'\U0001e931'}},
-    {U'\U0001e910', {U'\U0001e932'}},
-    {U'\U0001e911', {U'\U0001e933'}},
-    {U'\U0001e912', {U'\U0001e934'}},
-    {U'\U0001e913', {U'\U0001e935'}},
-    {U'\U0001e914', {U'\U0001e936'}},
-    {U'\U0001e915', {U'\U0001e937'}},
-    {U'\U0001e916', {U'\U0001e938'}},
-    {U'\U0001e917', {U'\U0001e939'}},
-    {U'\U0001e918', {U'\U0001e93a'}},
-    {U'\U0001e919', {U'\U0001e93b'}},
-    {U'\U0001e91a', {U'\U0001e93c'}},
-    {U'\U0001e91b', {U'\U0001e93d'}},
-    {U'\U0001e91c', {U'\U0001e93e'}},
-    {U'\U0001e91d', {U'\U0001e93f'}},
-    {U'\U0001e91e', {U'\U0001e940'}},
-    {U'\U0001e91f', {U'\U0001e941'}},
-    {U'\U0001e920', {U'\U0001e942'}},
-    {U'\U0001e921', {U'\U0001e943'}},
 });
 
-constexpr auto UPPERCASE_TABLE = std::to_array<std::pair<char_t, str_t>>({
-    {'a', {'A'}},
-    {'b', {'B'}},
-    {'c', {'C'}},
-    {'d', {'D'}},
-    {'e', {'E'}},
-    {'f', {'F'}},
-    {'g', {'G'}},
-    {'h', {'H'}},
-    {'i', {'I'}},
-    {'j', {'J'}},
-    {'k', {'K'}},
-    {'l', {'L'}},
-    {'m', {'M'}},
-    {'n', {'N'}},
-    {'o', {'O'}},
-    {'p', {'P'}},
-    {'q', {'Q'}},
-    {'r', {'R'}},
-    {'s', {'S'}},
-    {'t', {'T'}},
-    {'u', {'U'}},
-    {'v', {'V'}},
-    {'w', {'W'}},
-    {'x', {'X'}},
-    {'y', {'Y'}},
-    {'z', {'Z'}},
-    {u'\u00b5', {u'\u039c'}},
+// Uppercase_Mapping, 5312 bytes
+constexpr std::int32_t UPPER_DELTAS[] = {
+    0, -38864, -10795, -10792, -7264, -7205, -6254, -6253, -6244, -6243, -6242, -6236,
+    -6181, -928, -300, -232, -219, -218, -217, -214, -213, -211, -210, -209,
+    -207, -206, -205, -203, -202, -116, -96, -86, -80, -79, -71, -69,
+    -64, -63, -62, -59, -57, -54, -48, -47, -40, -39, -38, -37,
+    -34, -32, -31, -28, -26, -16, -15, -8, -2, -1, 7, 8,
+    48, 56, 74, 84, 86, 97, 100, 112, 121, 126, 128, 130,
+    163, 195, 743, 3008, 3814, 10727, 10743, 10749, 10780, 10782, 10783, 10815,
+    35266, 35332, 35384, 42258, 42261, 42280, 42282, 42305, 42307, 42308, 42315, 42319,
+};
+
+constexpr std::uint8_t UPPER_ROWS[] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 7,
+    8, 3, 9, 3, 3, 3, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 11, 3, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 13, 3, 14,
+    3, 3, 15, 3, 3, 3, 16, 3, 3, 3, 3, 3, 17, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 18, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 19, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+constexpr std::uint16_t UPPER_BLOCKS[] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 3, 0, 4, 5, 6,
+    7, 7, 7, 8, 9, 7, 7, 10, 11, 12, 13, 14, 15, 16, 7, 17,
+    7, 7, 18, 19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 26, 0, 0, 27, 0, 28, 29, 30, 31, 32, 7, 33,
+    0, 0, 0, 5, 5, 34, 7, 7, 35, 7, 7, 7, 36, 7, 7, 7,
+    7, 7, 7, 0, 0, 0, 37, 38, 39, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 46, 7, 7, 7, 7, 7, 7,
+    47, 48, 47, 47, 48, 49, 47, 50, 51, 51, 51, 52, 53, 54, 55, 53,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 56, 0, 0, 57, 58, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 60, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 38, 38, 38, 61, 62, 7, 7, 7, 7, 7, 7, 63, 64,
+    65, 65, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 7, 67, 0, 7, 68, 0, 0, 0, 0, 0, 0,
+    0, 0, 18, 18, 7, 7, 7, 69, 70, 71, 72, 73, 74, 75, 0, 76,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 77, 0, 78, 78, 78, 78, 78, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 81, 82, 82, 0, 0, 0, 0, 0, 0, 0, 0, 81, 82, 83,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 86, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 87, 87, 88,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 89, 90, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr std::uint8_t UPPER_VALUES[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 68,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 15, 0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 57, 0, 57, 0,
+    57, 0, 57, 0, 57, 0, 57, 0, 57, 255, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 57, 0, 57, 14,
+    73, 0, 0, 57, 0, 57, 0, 0, 57, 0, 0, 0, 57, 0, 0, 0,
+    0, 0, 57, 0, 0, 65, 0, 0, 0, 57, 72, 0, 0, 0, 71, 0,
+    0, 57, 0, 57, 0, 57, 0, 0, 57, 0, 0, 0, 0, 57, 0, 0,
+    57, 0, 0, 0, 57, 0, 57, 0, 0, 57, 0, 0, 0, 57, 0, 61,
+    0, 0, 0, 0, 0, 57, 56, 0, 57, 56, 0, 57, 56, 0, 57, 0,
+    57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 33, 0, 57,
+    255, 0, 57, 56, 0, 57, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 83,
+    83, 0, 57, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    82, 80, 81, 22, 25, 0, 26, 26, 0, 28, 0, 27, 95, 0, 0, 0,
+    26, 94, 0, 24, 0, 89, 93, 0, 23, 21, 93, 78, 91, 0, 0, 21,
+    0, 79, 20, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0,
+    17, 0, 92, 17, 0, 0, 0, 90, 17, 35, 18, 18, 34, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 87, 0,
+    0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 57, 0, 57, 0, 0, 0, 57, 0, 0, 0, 71, 71, 71, 0, 0,
+    255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 47, 47, 47,
+    255, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 36, 37, 37, 0,
+    38, 40, 0, 0, 0, 43, 41, 55, 0, 57, 0, 57, 0, 57, 0, 57,
+    31, 32, 58, 29, 0, 30, 0, 0, 57, 0, 0, 57, 0, 0, 0, 0,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 57,
+    0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 54,
+    0, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 75, 75, 75,
+    0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 55, 0, 0,
+    6, 7, 8, 10, 10, 9, 11, 12, 84, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 76, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0,
+    0, 57, 0, 57, 0, 57, 255, 255, 255, 255, 255, 39, 0, 0, 0, 0,
+    59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 59, 59, 59, 59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255, 59, 255, 59, 255, 59, 255, 59, 0, 0, 0, 0, 0, 0, 0, 0,
+    62, 62, 64, 64, 64, 64, 66, 66, 70, 70, 67, 67, 69, 69, 0, 0,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    59, 59, 255, 255, 255, 0, 255, 255, 0, 0, 0, 0, 255, 0, 5, 0,
+    0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 0, 0, 255, 0, 0, 0,
+    59, 59, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 59, 255, 255, 255, 58, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 0, 0, 0, 0, 0, 0,
+    0, 57, 0, 0, 0, 2, 3, 0, 57, 0, 57, 0, 57, 0, 0, 0,
+    0, 0, 0, 57, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 57, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0,
+    0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 4, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 0, 57,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0, 57, 0, 0, 0,
+    0, 57, 0, 57, 60, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 57, 0, 57, 0, 0, 0, 0, 57, 0, 57, 0, 0, 0, 0, 0,
+    0, 57, 0, 0, 0, 0, 0, 57, 0, 57, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 0, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 0, 45, 45, 45, 45, 45, 45, 45, 0, 45, 45, 0, 0, 0,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr auto UPPER = unicode::property_trie{UPPER_ROWS, UPPER_BLOCKS, UPPER_VALUES};
+
+constexpr auto UPPER_EXPANSIONS = std::to_array<std::pair<char_t, str_t>>({
     {u'\u00df', {'S', 'S'}},
-    {u'\u00e0', {u'\u00c0'}},
-    {u'\u00e1', {u'\u00c1'}},
-    {u'\u00e2', {u'\u00c2'}},
-    {u'\u00e3', {u'\u00c3'}},
-    {u'\u00e4', {u'\u00c4'}},
-    {u'\u00e5', {u'\u00c5'}},
-    {u'\u00e6', {u'\u00c6'}},
-    {u'\u00e7', {u'\u00c7'}},
-    {u'\u00e8', {u'\u00c8'}},
-    {u'\u00e9', {u'\u00c9'}},
-    {u'\u00ea', {u'\u00ca'}},
-    {u'\u00eb', {u'\u00cb'}},
-    {u'\u00ec', {u'\u00cc'}},
-    {u'\u00ed', {u'\u00cd'}},
-    {u'\u00ee', {u'\u00ce'}},
-    {u'\u00ef', {u'\u00cf'}},
-    {u'\u00f0', {u'\u00d0'}},
-    {u'\u00f1', {u'\u00d1'}},
-    {u'\u00f2', {u'\u00d2'}},
-    {u'\u00f3', {u'\u00d3'}},
-    {u'\u00f4', {u'\u00d4'}},
-    {u'\u00f5', {u'\u00d5'}},
-    {u'\u00f6', {u'\u00d6'}},
-    {u'\u00f8', {u'\u00d8'}},
-    {u'\u00f9', {u'\u00d9'}},
-    {u'\u00fa', {u'\u00da'}},
-    {u'\u00fb', {u'\u00db'}},
-    {u'\u00fc', {u'\u00dc'}},
-    {u'\u00fd', {u'\u00dd'}},
-    {u'\u00fe', {u'\u00de'}},
-    {u'\u00ff', {u'\u0178'}},
-    {u'\u0101', {u'\u0100'}},
-    {u'\u0103', {u'\u0102'}},
-    {u'\u0105', {u'\u0104'}},
-    {u'\u0107', {u'\u0106'}},
-    {u'\u0109', {u'\u0108'}},
-    {u'\u010b', {u'\u010a'}},
-    {u'\u010d', {u'\u010c'}},
-    {u'\u010f', {u'\u010e'}},
-    {u'\u0111', {u'\u0110'}},
-    {u'\u0113', {u'\u0112'}},
-    {u'\u0115', {u'\u0114'}},
-    {u'\u0117', {u'\u0116'}},
-    {u'\u0119', {u'\u0118'}},
-    {u'\u011b', {u'\u011a'}},
-    {u'\u011d', {u'\u011c'}},
-    {u'\u011f', {u'\u011e'}},
-    {u'\u0121', {u'\u0120'}},
-    {u'\u0123', {u'\u0122'}},
-    {u'\u0125', {u'\u0124'}},
-    {u'\u0127', {u'\u0126'}},
-    {u'\u0129', {u'\u0128'}},
-    {u'\u012b', {u'\u012a'}},
-    {u'\u012d', {u'\u012c'}},
-    {u'\u012f', {u'\u012e'}},
-    {u'\u0131', {'I'}},
-    {u'\u0133', {u'\u0132'}},
-    {u'\u0135', {u'\u0134'}},
-    {u'\u0137', {u'\u0136'}},
-    {u'\u013a', {u'\u0139'}},
-    {u'\u013c', {u'\u013b'}},
-    {u'\u013e', {u'\u013d'}},
-    {u'\u0140', {u'\u013f'}},
-    {u'\u0142', {u'\u0141'}},
-    {u'\u0144', {u'\u0143'}},
-    {u'\u0146', {u'\u0145'}},
-    {u'\u0148', {u'\u0147'}},
     {u'\u0149', {u'\u02bc', 'N'}},
-    {u'\u014b', {u'\u014a'}},
-    {u'\u014d', {u'\u014c'}},
-    {u'\u014f', {u'\u014e'}},
-    {u'\u0151', {u'\u0150'}},
-    {u'\u0153', {u'\u0152'}},
-    {u'\u0155', {u'\u0154'}},
-    {u'\u0157', {u'\u0156'}},
-    {u'\u0159', {u'\u0158'}},
-    {u'\u015b', {u'\u015a'}},
-    {u'\u015d', {u'\u015c'}},
-    {u'\u015f', {u'\u015e'}},
-    {u'\u0161', {u'\u0160'}},
-    {u'\u0163', {u'\u0162'}},
-    {u'\u0165', {u'\u0164'}},
-    {u'\u0167', {u'\u0166'}},
-    {u'\u0169', {u'\u0168'}},
-    {u'\u016b', {u'\u016a'}},
-    {u'\u016d', {u'\u016c'}},
-    {u'\u016f', {u'\u016e'}},
-    {u'\u0171', {u'\u0170'}},
-    {u'\u0173', {u'\u0172'}},
-    {u'\u0175', {u'\u0174'}},
-    {u'\u0177', {u'\u0176'}},
-    {u'\u017a', {u'\u0179'}},
-    {u'\u017c', {u'\u017b'}},
-    {u'\u017e', {u'\u017d'}},
-    {u'\u017f', {'S'}},
-    {u'\u0180', {u'\u0243'}},
-    {u'\u0183', {u'\u0182'}},
-    {u'\u0185', {u'\u0184'}},
-    {u'\u0188', {u'\u0187'}},
-    {u'\u018c', {u'\u018b'}},
-    {u'\u0192', {u'\u0191'}},
-    {u'\u0195', {u'\u01f6'}},
-    {u'\u0199', {u'\u0198'}},
-    {u'\u019a', {u'\u023d'}},
-    {u'\u019e', {u'\u0220'}},
-    {u'\u01a1', {u'\u01a0'}},
-    {u'\u01a3', {u'\u01a2'}},
-    {u'\u01a5', {u'\u01a4'}},
-    {u'\u01a8', {u'\u01a7'}},
-    {u'\u01ad', {u'\u01ac'}},
-    {u'\u01b0', {u'\u01af'}},
-    {u'\u01b4', {u'\u01b3'}},
-    {u'\u01b6', {u'\u01b5'}},
-    {u'\u01b9', {u'\u01b8'}},
-    {u'\u01bd', {u'\u01bc'}},
-    {u'\u01bf', {u'\u01f7'}},
-    {u'\u01c5', {u'\u01c4'}},
-    {u'\u01c6', {u'\u01c4'}},
-    {u'\u01c8', {u'\u01c7'}},
-    {u'\u01c9', {u'\u01c7'}},
-    {u'\u01cb', {u'\u01ca'}},
-    {u'\u01cc', {u'\u01ca'}},
-    {u'\u01ce', {u'\u01cd'}},
-    {u'\u01d0', {u'\u01cf'}},
-    {u'\u01d2', {u'\u01d1'}},
-    {u'\u01d4', {u'\u01d3'}},
-    {u'\u01d6', {u'\u01d5'}},
-    {u'\u01d8', {u'\u01d7'}},
-    {u'\u01da', {u'\u01d9'}},
-    {u'\u01dc', {u'\u01db'}},
-    {u'\u01dd', {u'\u018e'}},
-    {u'\u01df', {u'\u01de'}},
-    {u'\u01e1', {u'\u01e0'}},
-    {u'\u01e3', {u'\u01e2'}},
-    {u'\u01e5', {u'\u01e4'}},
-    {u'\u01e7', {u'\u01e6'}},
-    {u'\u01e9', {u'\u01e8'}},
-    {u'\u01eb', {u'\u01ea'}},
-    {u'\u01ed', {u'\u01ec'}},
-    {u'\u01ef', {u'\u01ee'}},
     {u'\u01f0', {'J', u'\u030c'}},
-    {u'\u01f2', {u'\u01f1'}},
-    {u'\u01f3', {u'\u01f1'}},
-    {u'\u01f5', {u'\u01f4'}},
-    {u'\u01f9', {u'\u01f8'}},
-    {u'\u01fb', {u'\u01fa'}},
-    {u'\u01fd', {u'\u01fc'}},
-    {u'\u01ff', {u'\u01fe'}},
-    {u'\u0201', {u'\u0200'}},
-    {u'\u0203', {u'\u0202'}},
-    {u'\u0205', {u'\u0204'}},
-    {u'\u0207', {u'\u0206'}},
-    {u'\u0209', {u'\u0208'}},
-    {u'\u020b', {u'\u020a'}},
-    {u'\u020d', {u'\u020c'}},
-    {u'\u020f', {u'\u020e'}},
-    {u'\u0211', {u'\u0210'}},
-    {u'\u0213', {u'\u0212'}},
-    {u'\u0215', {u'\u0214'}},
-    {u'\u0217', {u'\u0216'}},
-    {u'\u0219', {u'\u0218'}},
-    {u'\u021b', {u'\u021a'}},
-    {u'\u021d', {u'\u021c'}},
-    {u'\u021f', {u'\u021e'}},
-    {u'\u0223', {u'\u0222'}},
-    {u'\u0225', {u'\u0224'}},
-    {u'\u0227', {u'\u0226'}},
-    {u'\u0229', {u'\u0228'}},
-    {u'\u022b', {u'\u022a'}},
-    {u'\u022d', {u'\u022c'}},
-    {u'\u022f', {u'\u022e'}},
-    {u'\u0231', {u'\u0230'}},
-    {u'\u0233', {u'\u0232'}},
-    {u'\u023c', {u'\u023b'}},
-    {u'\u023f', {u'\u2c7e'}},
-    {u'\u0240', {u'\u2c7f'}},
-    {u'\u0242', {u'\u0241'}},
-    {u'\u0247', {u'\u0246'}},
-    {u'\u0249', {u'\u0248'}},
-    {u'\u024b', {u'\u024a'}},
-    {u'\u024d', {u'\u024c'}},
-    {u'\u024f', {u'\u024e'}},
-    {u'\u0250', {u'\u2c6f'}},
-    {u'\u0251', {u'\u2c6d'}},
-    {u'\u0252', {u'\u2c70'}},
-    {u'\u0253', {u'\u0181'}},
-    {u'\u0254', {u'\u0186'}},
-    {u'\u0256', {u'\u0189'}},
-    {u'\u0257', {u'\u018a'}},
-    {u'\u0259', {u'\u018f'}},
-    {u'\u025b', {u'\u0190'}},
-    {u'\u025c', {u'\ua7ab'}},
-    {u'\u0260', {u'\u0193'}},
-    {u'\u0261', {u'\ua7ac'}},
-    {u'\u0263', {u'\u0194'}},
-    {u'\u0265', {u'\ua78d'}},
-    {u'\u0266', {u'\ua7aa'}},
-    {u'\u0268', {u'\u0197'}},
-    {u'\u0269', {u'\u0196'}},
-    {u'\u026a', {u'\ua7ae'}},
-    {u'\u026b', {u'\u2c62'}},
-    {u'\u026c', {u'\ua7ad'}},
-    {u'\u026f', {u'\u019c'}},
-    {u'\u0271', {u'\u2c6e'}},
-    {u'\u0272', {u'\u019d'}},
-    {u'\u0275', {u'\u019f'}},
-    {u'\u027d', {u'\u2c64'}},
-    {u'\u0280', {u'\u01a6'}},
-    {u'\u0282', {u'\ua7c5'}},
-    {u'\u0283', {u'\u01a9'}},
-    {u'\u0287', {u'\ua7b1'}},
-    {u'\u0288', {u'\u01ae'}},
-    {u'\u0289', {u'\u0244'}},
-    {u'\u028a', {u'\u01b1'}},
-    {u'\u028b', {u'\u01b2'}},
-    {u'\u028c', {u'\u0245'}},
-    {u'\u0292', {u'\u01b7'}},
-    {u'\u029d', {u'\ua7b2'}},
-    {u'\u029e', {u'\ua7b0'}},
-    {u'\u0345', {u'\u0399'}},
-    {u'\u0371', {u'\u0370'}},
-    {u'\u0373', {u'\u0372'}},
-    {u'\u0377', {u'\u0376'}},
-    {u'\u037b', {u'\u03fd'}},
-    {u'\u037c', {u'\u03fe'}},
-    {u'\u037d', {u'\u03ff'}},
     {u'\u0390', {u'\u0399', u'\u0308', u'\u0301'}},
-    {u'\u03ac', {u'\u0386'}},
-    {u'\u03ad', {u'\u0388'}},
-    {u'\u03ae', {u'\u0389'}},
-    {u'\u03af', {u'\u038a'}},
     {u'\u03b0', {u'\u03a5', u'\u0308', u'\u0301'}},
-    {u'\u03b1', {u'\u0391'}},
-    {u'\u03b2', {u'\u0392'}},
-    {u'\u03b3', {u'\u0393'}},
-    {u'\u03b4', {u'\u0394'}},
-    {u'\u03b5', {u'\u0395'}},
-    {u'\u03b6', {u'\u0396'}},
-    {u'\u03b7', {u'\u0397'}},
-    {u'\u03b8', {u'\u0398'}},
-    {u'\u03b9', {u'\u0399'}},
-    {u'\u03ba', {u'\u039a'}},
-    {u'\u03bb', {u'\u039b'}},
-    {u'\u03bc', {u'\u039c'}},
-    {u'\u03bd', {u'\u039d'}},
-    {u'\u03be', {u'\u039e'}},
-    {u'\u03bf', {u'\u039f'}},
-    {u'\u03c0', {u'\u03a0'}},
-    {u'\u03c1', {u'\u03a1'}},
-    {u'\u03c2', {u'\u03a3'}},
-    {u'\u03c3', {u'\u03a3'}},
-    {u'\u03c4', {u'\u03a4'}},
-    {u'\u03c5', {u'\u03a5'}},
-    {u'\u03c6', {u'\u03a6'}},
-    {u'\u03c7', {u'\u03a7'}},
-    {u'\u03c8', {u'\u03a8'}},
-    {u'\u03c9', {u'\u03a9'}},
-    {u'\u03ca', {u'\u03aa'}},
-    {u'\u03cb', {u'\u03ab'}},
-    {u'\u03cc', {u'\u038c'}},
-    {u'\u03cd', {u'\u038e'}},
-    {u'\u03ce', {u'\u038f'}},
-    {u'\u03d0', {u'\u0392'}},
-    {u'\u03d1', {u'\u0398'}},
-    {u'\u03d5', {u'\u03a6'}},
-    {u'\u03d6', {u'\u03a0'}},
-    {u'\u03d7', {u'\u03cf'}},
-    {u'\u03d9', {u'\u03d8'}},
-    {u'\u03db', {u'\u03da'}},
-    {u'\u03dd', {u'\u03dc'}},
-    {u'\u03df', {u'\u03de'}},
-    {u'\u03e1', {u'\u03e0'}},
-    {u'\u03e3', {u'\u03e2'}},
-    {u'\u03e5', {u'\u03e4'}},
-    {u'\u03e7', {u'\u03e6'}},
-    {u'\u03e9', {u'\u03e8'}},
-    {u'\u03eb', {u'\u03ea'}},
-    {u'\u03ed', {u'\u03ec'}},
-    {u'\u03ef', {u'\u03ee'}},
-    {u'\u03f0', {u'\u039a'}},
-    {u'\u03f1', {u'\u03a1'}},
-    {u'\u03f2', {u'\u03f9'}},
-    {u'\u03f3', {u'\u037f'}},
-    {u'\u03f5', {u'\u0395'}},
-    {u'\u03f8', {u'\u03f7'}},
-    {u'\u03fb', {u'\u03fa'}},
-    {u'\u0430', {u'\u0410'}},
-    {u'\u0431', {u'\u0411'}},
-    {u'\u0432', {u'\u0412'}},
-    {u'\u0433', {u'\u0413'}},
-    {u'\u0434', {u'\u0414'}},
-    {u'\u0435', {u'\u0415'}},
-    {u'\u0436', {u'\u0416'}},
-    {u'\u0437', {u'\u0417'}},
-    {u'\u0438', {u'\u0418'}},
-    {u'\u0439', {u'\u0419'}},
-    {u'\u043a', {u'\u041a'}},
-    {u'\u043b', {u'\u041b'}},
-    {u'\u043c', {u'\u041c'}},
-    {u'\u043d', {u'\u041d'}},
-    {u'\u043e', {u'\u041e'}},
-    {u'\u043f', {u'\u041f'}},
-    {u'\u0440', {u'\u0420'}},
-    {u'\u0441', {u'\u0421'}},
-    {u'\u0442', {u'\u0422'}},
-    {u'\u0443', {u'\u0423'}},
-    {u'\u0444', {u'\u0424'}},
-    {u'\u0445', {u'\u0425'}},
-    {u'\u0446', {u'\u0426'}},
-    {u'\u0447', {u'\u0427'}},
-    {u'\u0448', {u'\u0428'}},
-    {u'\u0449', {u'\u0429'}},
-    {u'\u044a', {u'\u042a'}},
-    {u'\u044b', {u'\u042b'}},
-    {u'\u044c', {u'\u042c'}},
-    {u'\u044d', {u'\u042d'}},
-    {u'\u044e', {u'\u042e'}},
-    {u'\u044f', {u'\u042f'}},
-    {u'\u0450', {u'\u0400'}},
-    {u'\u0451', {u'\u0401'}},
-    {u'\u0452', {u'\u0402'}},
-    {u'\u0453', {u'\u0403'}},
-    {u'\u0454', {u'\u0404'}},
-    {u'\u0455', {u'\u0405'}},
-    {u'\u0456', {u'\u0406'}},
-    {u'\u0457', {u'\u0407'}},
-    {u'\u0458', {u'\u0408'}},
-    {u'\u0459', {u'\u0409'}},
-    {u'\u045a', {u'\u040a'}},
-    {u'\u045b', {u'\u040b'}},
-    {u'\u045c', {u'\u040c'}},
-    {u'\u045d', {u'\u040d'}},
-    {u'\u045e', {u'\u040e'}},
-    {u'\u045f', {u'\u040f'}},
-    {u'\u0461', {u'\u0460'}},
-    {u'\u0463', {u'\u0462'}},
-    {u'\u0465', {u'\u0464'}},
-    {u'\u0467', {u'\u0466'}},
-    {u'\u0469', {u'\u0468'}},
-    {u'\u046b', {u'\u046a'}},
-    {u'\u046d', {u'\u046c'}},
-    {u'\u046f', {u'\u046e'}},
-    {u'\u0471', {u'\u0470'}},
-    {u'\u0473', {u'\u0472'}},
-    {u'\u0475', {u'\u0474'}},
-    {u'\u0477', {u'\u0476'}},
-    {u'\u0479', {u'\u0478'}},
-    {u'\u047b', {u'\u047a'}},
-    {u'\u047d', {u'\u047c'}},
-    {u'\u047f', {u'\u047e'}},
-    {u'\u0481', {u'\u0480'}},
-    {u'\u048b', {u'\u048a'}},
-    {u'\u048d', {u'\u048c'}},
-    {u'\u048f', {u'\u048e'}},
-    {u'\u0491', {u'\u0490'}},
-    {u'\u0493', {u'\u0492'}},
-    {u'\u0495', {u'\u0494'}},
-    {u'\u0497', {u'\u0496'}},
-    {u'\u0499', {u'\u0498'}},
-    {u'\u049b', {u'\u049a'}},
-    {u'\u049d', {u'\u049c'}},
-    {u'\u049f', {u'\u049e'}},
-    {u'\u04a1', {u'\u04a0'}},
-    {u'\u04a3', {u'\u04a2'}},
-    {u'\u04a5', {u'\u04a4'}},
-    {u'\u04a7', {u'\u04a6'}},
-    {u'\u04a9', {u'\u04a8'}},
-    {u'\u04ab', {u'\u04aa'}},
-    {u'\u04ad', {u'\u04ac'}},
-    {u'\u04af', {u'\u04ae'}},
-    {u'\u04b1', {u'\u04b0'}},
-    {u'\u04b3', {u'\u04b2'}},
-    {u'\u04b5', {u'\u04b4'}},
-    {u'\u04b7', {u'\u04b6'}},
-    {u'\u04b9', {u'\u04b8'}},
-    {u'\u04bb', {u'\u04ba'}},
-    {u'\u04bd', {u'\u04bc'}},
-    {u'\u04bf', {u'\u04be'}},
-    {u'\u04c2', {u'\u04c1'}},
-    {u'\u04c4', {u'\u04c3'}},
-    {u'\u04c6', {u'\u04c5'}},
-    {u'\u04c8', {u'\u04c7'}},
-    {u'\u04ca', {u'\u04c9'}},
-    {u'\u04cc', {u'\u04cb'}},
-    {u'\u04ce', {u'\u04cd'}},
-    {u'\u04cf', {u'\u04c0'}},
-    {u'\u04d1', {u'\u04d0'}},
-    {u'\u04d3', {u'\u04d2'}},
-    {u'\u04d5', {u'\u04d4'}},
-    {u'\u04d7', {u'\u04d6'}},
-    {u'\u04d9', {u'\u04d8'}},
-    {u'\u04db', {u'\u04da'}},
-    {u'\u04dd', {u'\u04dc'}},
-    {u'\u04df', {u'\u04de'}},
-    {u'\u04e1', {u'\u04e0'}},
-    {u'\u04e3', {u'\u04e2'}},
-    {u'\u04e5', {u'\u04e4'}},
-    {u'\u04e7', {u'\u04e6'}},
-    {u'\u04e9', {u'\u04e8'}},
-    {u'\u04eb', {u'\u04ea'}},
-    {u'\u04ed', {u'\u04ec'}},
-    {u'\u04ef', {u'\u04ee'}},
-    {u'\u04f1', {u'\u04f0'}},
-    {u'\u04f3', {u'\u04f2'}},
-    {u'\u04f5', {u'\u04f4'}},
-    {u'\u04f7', {u'\u04f6'}},
-    {u'\u04f9', {u'\u04f8'}},
-    {u'\u04fb', {u'\u04fa'}},
-    {u'\u04fd', {u'\u04fc'}},
-    {u'\u04ff', {u'\u04fe'}},
-    {u'\u0501', {u'\u0500'}},
-    {u'\u0503', {u'\u0502'}},
-    {u'\u0505', {u'\u0504'}},
-    {u'\u0507', {u'\u0506'}},
-    {u'\u0509', {u'\u0508'}},
-    {u'\u050b', {u'\u050a'}},
-    {u'\u050d', {u'\u050c'}},
-    {u'\u050f', {u'\u050e'}},
-    {u'\u0511', {u'\u0510'}},
-    {u'\u0513', {u'\u0512'}},
-    {u'\u0515', {u'\u0514'}},
-    {u'\u0517', {u'\u0516'}},
-    {u'\u0519', {u'\u0518'}},
-    {u'\u051b', {u'\u051a'}},
-    {u'\u051d', {u'\u051c'}},
-    {u'\u051f', {u'\u051e'}},
-    {u'\u0521', {u'\u0520'}},
-    {u'\u0523', {u'\u0522'}},
-    {u'\u0525', {u'\u0524'}},
-    {u'\u0527', {u'\u0526'}},
-    {u'\u0529', {u'\u0528'}},
-    {u'\u052b', {u'\u052a'}},
-    {u'\u052d', {u'\u052c'}},
-    {u'\u052f', {u'\u052e'}},
-    {u'\u0561', {u'\u0531'}},
-    {u'\u0562', {u'\u0532'}},
-    {u'\u0563', {u'\u0533'}},
-    {u'\u0564', {u'\u0534'}},
-    {u'\u0565', {u'\u0535'}},
-    {u'\u0566', {u'\u0536'}},
-    {u'\u0567', {u'\u0537'}},
-    {u'\u0568', {u'\u0538'}},
-    {u'\u0569', {u'\u0539'}},
-    {u'\u056a', {u'\u053a'}},
-    {u'\u056b', {u'\u053b'}},
-    {u'\u056c', {u'\u053c'}},
-    {u'\u056d', {u'\u053d'}},
-    {u'\u056e', {u'\u053e'}},
-    {u'\u056f', {u'\u053f'}},
-    {u'\u0570', {u'\u0540'}},
-    {u'\u0571', {u'\u0541'}},
-    {u'\u0572', {u'\u0542'}},
-    {u'\u0573', {u'\u0543'}},
-    {u'\u0574', {u'\u0544'}},
-    {u'\u0575', {u'\u0545'}},
-    {u'\u0576', {u'\u0546'}},
-    {u'\u0577', {u'\u0547'}},
-    {u'\u0578', {u'\u0548'}},
-    {u'\u0579', {u'\u0549'}},
-    {u'\u057a', {u'\u054a'}},
-    {u'\u057b', {u'\u054b'}},
-    {u'\u057c', {u'\u054c'}},
-    {u'\u057d', {u'\u054d'}},
-    {u'\u057e', {u'\u054e'}},
-    {u'\u057f', {u'\u054f'}},
-    {u'\u0580', {u'\u0550'}},
-    {u'\u0581', {u'\u0551'}},
-    {u'\u0582', {u'\u0552'}},
-    {u'\u0583', {u'\u0553'}},
-    {u'\u0584', {u'\u0554'}},
-    {u'\u0585', {u'\u0555'}},
-    {u'\u0586', {u'\u0556'}},
     {u'\u0587', {u'\u0535', u'\u0552'}},
-    {u'\u10d0', {u'\u1c90'}},
-    {u'\u10d1', {u'\u1c91'}},
-    {u'\u10d2', {u'\u1c92'}},
-    {u'\u10d3', {u'\u1c93'}},
-    {u'\u10d4', {u'\u1c94'}},
-    {u'\u10d5', {u'\u1c95'}},
-    {u'\u10d6', {u'\u1c96'}},
-    {u'\u10d7', {u'\u1c97'}},
-    {u'\u10d8', {u'\u1c98'}},
-    {u'\u10d9', {u'\u1c99'}},
-    {u'\u10da', {u'\u1c9a'}},
-    {u'\u10db', {u'\u1c9b'}},
-    {u'\u10dc', {u'\u1c9c'}},
-    {u'\u10dd', {u'\u1c9d'}},
-    {u'\u10de', {u'\u1c9e'}},
-    {u'\u10df', {u'\u1c9f'}},
-    {u'\u10e0', {u'\u1ca0'}},
-    {u'\u10e1', {u'\u1ca1'}},
-    {u'\u10e2', {u'\u1ca2'}},
-    {u'\u10e3', {u'\u1ca3'}},
-    {u'\u10e4', {u'\u1ca4'}},
-    {u'\u10e5', {u'\u1ca5'}},
-    {u'\u10e6', {u'\u1ca6'}},
-    {u'\u10e7', {u'\u1ca7'}},
-    {u'\u10e8', {u'\u1ca8'}},
-    {u'\u10e9', {u'\u1ca9'}},
-    {u'\u10ea', {u'\u1caa'}},
-    {u'\u10eb', {u'\u1cab'}},
-    {u'\u10ec', {u'\u1cac'}},
-    {u'\u10ed', {u'\u1cad'}},
-    {u'\u10ee', {u'\u1cae'}},
-    {u'\u10ef', {u'\u1caf'}},
-    {u'\u10f0', {u'\u1cb0'}},
-    {u'\u10f1', {u'\u1cb1'}},
-    {u'\u10f2', {u'\u1cb2'}},
-    {u'\u10f3', {u'\u1cb3'}},
-    {u'\u10f4', {u'\u1cb4'}},
-    {u'\u10f5', {u'\u1cb5'}},
-    {u'\u10f6', {u'\u1cb6'}},
-    {u'\u10f7', {u'\u1cb7'}},
-    {u'\u10f8', {u'\u1cb8'}},
-    {u'\u10f9', {u'\u1cb9'}},
-    {u'\u10fa', {u'\u1cba'}},
-    {u'\u10fd', {u'\u1cbd'}},
-    {u'\u10fe', {u'\u1cbe'}},
-    {u'\u10ff', {u'\u1cbf'}},
-    {u'\u13f8', {u'\u13f0'}},
-    {u'\u13f9', {u'\u13f1'}},
-    {u'\u13fa', {u'\u13f2'}},
-    {u'\u13fb', {u'\u13f3'}},
-    {u'\u13fc', {u'\u13f4'}},
-    {u'\u13fd', {u'\u13f5'}},
-    {u'\u1c80', {u'\u0412'}},
-    {u'\u1c81', {u'\u0414'}},
-    {u'\u1c82', {u'\u041e'}},
-    {u'\u1c83', {u'\u0421'}},
-    {u'\u1c84', {u'\u0422'}},
-    {u'\u1c85', {u'\u0422'}},
-    {u'\u1c86', {u'\u042a'}},
-    {u'\u1c87', {u'\u0462'}},
-    {u'\u1c88', {u'\ua64a'}},
-    {u'\u1d79', {u'\ua77d'}},
-    {u'\u1d7d', {u'\u2c63'}},
-    {u'\u1d8e', {u'\ua7c6'}},
-    {u'\u1e01', {u'\u1e00'}},
-    {u'\u1e03', {u'\u1e02'}},
-    {u'\u1e05', {u'\u1e04'}},
-    {u'\u1e07', {u'\u1e06'}},
-    {u'\u1e09', {u'\u1e08'}},
-    {u'\u1e0b', {u'\u1e0a'}},
-    {u'\u1e0d', {u'\u1e0c'}},
-    {u'\u1e0f', {u'\u1e0e'}},
-    {u'\u1e11', {u'\u1e10'}},
-    {u'\u1e13', {u'\u1e12'}},
-    {u'\u1e15', {u'\u1e14'}},
-    {u'\u1e17', {u'\u1e16'}},
-    {u'\u1e19', {u'\u1e18'}},
-    {u'\u1e1b', {u'\u1e1a'}},
-    {u'\u1e1d', {u'\u1e1c'}},
-    {u'\u1e1f', {u'\u1e1e'}},
-    {u'\u1e21', {u'\u1e20'}},
-    {u'\u1e23', {u'\u1e22'}},
-    {u'\u1e25', {u'\u1e24'}},
-    {u'\u1e27', {u'\u1e26'}},
-    {u'\u1e29', {u'\u1e28'}},
-    {u'\u1e2b', {u'\u1e2a'}},
-    {u'\u1e2d', {u'\u1e2c'}},
-    {u'\u1e2f', {u'\u1e2e'}},
-    {u'\u1e31', {u'\u1e30'}},
-    {u'\u1e33', {u'\u1e32'}},
-    {u'\u1e35', {u'\u1e34'}},
-    {u'\u1e37', {u'\u1e36'}},
-    {u'\u1e39', {u'\u1e38'}},
-    {u'\u1e3b', {u'\u1e3a'}},
-    {u'\u1e3d', {u'\u1e3c'}},
-    {u'\u1e3f', {u'\u1e3e'}},
-    {u'\u1e41', {u'\u1e40'}},
-    {u'\u1e43', {u'\u1e42'}},
-    {u'\u1e45', {u'\u1e44'}},
-    {u'\u1e47', {u'\u1e46'}},
-    {u'\u1e49', {u'\u1e48'}},
-    {u'\u1e4b', {u'\u1e4a'}},
-    {u'\u1e4d', {u'\u1e4c'}},
-    {u'\u1e4f', {u'\u1e4e'}},
-    {u'\u1e51', {u'\u1e50'}},
-    {u'\u1e53', {u'\u1e52'}},
-    {u'\u1e55', {u'\u1e54'}},
-    {u'\u1e57', {u'\u1e56'}},
-    {u'\u1e59', {u'\u1e58'}},
-    {u'\u1e5b', {u'\u1e5a'}},
-    {u'\u1e5d', {u'\u1e5c'}},
-    {u'\u1e5f', {u'\u1e5e'}},
-    {u'\u1e61', {u'\u1e60'}},
-    {u'\u1e63', {u'\u1e62'}},
-    {u'\u1e65', {u'\u1e64'}},
-    {u'\u1e67', {u'\u1e66'}},
-    {u'\u1e69', {u'\u1e68'}},
-    {u'\u1e6b', {u'\u1e6a'}},
-    {u'\u1e6d', {u'\u1e6c'}},
-    {u'\u1e6f', {u'\u1e6e'}},
-    {u'\u1e71', {u'\u1e70'}},
-    {u'\u1e73', {u'\u1e72'}},
-    {u'\u1e75', {u'\u1e74'}},
-    {u'\u1e77', {u'\u1e76'}},
-    {u'\u1e79', {u'\u1e78'}},
-    {u'\u1e7b', {u'\u1e7a'}},
-    {u'\u1e7d', {u'\u1e7c'}},
-    {u'\u1e7f', {u'\u1e7e'}},
-    {u'\u1e81', {u'\u1e80'}},
-    {u'\u1e83', {u'\u1e82'}},
-    {u'\u1e85', {u'\u1e84'}},
-    {u'\u1e87', {u'\u1e86'}},
-    {u'\u1e89', {u'\u1e88'}},
-    {u'\u1e8b', {u'\u1e8a'}},
-    {u'\u1e8d', {u'\u1e8c'}},
-    {u'\u1e8f', {u'\u1e8e'}},
-    {u'\u1e91', {u'\u1e90'}},
-    {u'\u1e93', {u'\u1e92'}},
-    {u'\u1e95', {u'\u1e94'}},
     {u'\u1e96', {'H', u'\u0331'}},
     {u'\u1e97', {'T', u'\u0308'}},
     {u'\u1e98', {'W', u'\u030a'}},
     {u'\u1e99', {'Y', u'\u030a'}},
     {u'\u1e9a', {'A', u'\u02be'}},
-    {u'\u1e9b', {u'\u1e60'}},
-    {u'\u1ea1', {u'\u1ea0'}},
-    {u'\u1ea3', {u'\u1ea2'}},
-    {u'\u1ea5', {u'\u1ea4'}},
-    {u'\u1ea7', {u'\u1ea6'}},
-    {u'\u1ea9', {u'\u1ea8'}},
-    {u'\u1eab', {u'\u1eaa'}},
-    {u'\u1ead', {u'\u1eac'}},
-    {u'\u1eaf', {u'\u1eae'}},
-    {u'\u1eb1', {u'\u1eb0'}},
-    {u'\u1eb3', {u'\u1eb2'}},
-    {u'\u1eb5', {u'\u1eb4'}},
-    {u'\u1eb7', {u'\u1eb6'}},
-    {u'\u1eb9', {u'\u1eb8'}},
-    {u'\u1ebb', {u'\u1eba'}},
-    {u'\u1ebd', {u'\u1ebc'}},
-    {u'\u1ebf', {u'\u1ebe'}},
-    {u'\u1ec1', {u'\u1ec0'}},
-    {u'\u1ec3', {u'\u1ec2'}},
-    {u'\u1ec5', {u'\u1ec4'}},
-    {u'\u1ec7', {u'\u1ec6'}},
-    {u'\u1ec9', {u'\u1ec8'}},
-    {u'\u1ecb', {u'\u1eca'}},
-    {u'\u1ecd', {u'\u1ecc'}},
-    {u'\u1ecf', {u'\u1ece'}},
-    {u'\u1ed1', {u'\u1ed0'}},
-    {u'\u1ed3', {u'\u1ed2'}},
-    {u'\u1ed5', {u'\u1ed4'}},
-    {u'\u1ed7', {u'\u1ed6'}},
-    {u'\u1ed9', {u'\u1ed8'}},
-    {u'\u1edb', {u'\u1eda'}},
-    {u'\u1edd', {u'\u1edc'}},
-    {u'\u1edf', {u'\u1ede'}},
-    {u'\u1ee1', {u'\u1ee0'}},
-    {u'\u1ee3', {u'\u1ee2'}},
-    {u'\u1ee5', {u'\u1ee4'}},
-    {u'\u1ee7', {u'\u1ee6'}},
-    {u'\u1ee9', {u'\u1ee8'}},
-    {u'\u1eeb', {u'\u1eea'}},
-    {u'\u1eed', {u'\u1eec'}},
-    {u'\u1eef', {u'\u1eee'}},
-    {u'\u1ef1', {u'\u1ef0'}},
-    {u'\u1ef3', {u'\u1ef2'}},
-    {u'\u1ef5', {u'\u1ef4'}},
-    {u'\u1ef7', {u'\u1ef6'}},
-    {u'\u1ef9', {u'\u1ef8'}},
-    {u'\u1efb', {u'\u1efa'}},
-    {u'\u1efd', {u'\u1efc'}},
-    {u'\u1eff', {u'\u1efe'}},
-    {u'\u1f00', {u'\u1f08'}},
-    {u'\u1f01', {u'\u1f09'}},
-    {u'\u1f02', {u'\u1f0a'}},
-    {u'\u1f03', {u'\u1f0b'}},
-    {u'\u1f04', {u'\u1f0c'}},
-    {u'\u1f05', {u'\u1f0d'}},
-    {u'\u1f06', {u'\u1f0e'}},
-    {u'\u1f07', {u'\u1f0f'}},
-    {u'\u1f10', {u'\u1f18'}},
-    {u'\u1f11', {u'\u1f19'}},
-    {u'\u1f12', {u'\u1f1a'}},
-    {u'\u1f13', {u'\u1f1b'}},
-    {u'\u1f14', {u'\u1f1c'}},
-    {u'\u1f15', {u'\u1f1d'}},
-    {u'\u1f20', {u'\u1f28'}},
-    {u'\u1f21', {u'\u1f29'}},
-    {u'\u1f22', {u'\u1f2a'}},
-    {u'\u1f23', {u'\u1f2b'}},
-    {u'\u1f24', {u'\u1f2c'}},
-    {u'\u1f25', {u'\u1f2d'}},
-    {u'\u1f26', {u'\u1f2e'}},
-    {u'\u1f27', {u'\u1f2f'}},
-    {u'\u1f30', {u'\u1f38'}},
-    {u'\u1f31', {u'\u1f39'}},
-    {u'\u1f32', {u'\u1f3a'}},
-    {u'\u1f33', {u'\u1f3b'}},
-    {u'\u1f34', {u'\u1f3c'}},
-    {u'\u1f35', {u'\u1f3d'}},
-    {u'\u1f36', {u'\u1f3e'}},
-    {u'\u1f37', {u'\u1f3f'}},
-    {u'\u1f40', {u'\u1f48'}},
-    {u'\u1f41', {u'\u1f49'}},
-    {u'\u1f42', {u'\u1f4a'}},
-    {u'\u1f43', {u'\u1f4b'}},
-    {u'\u1f44', {u'\u1f4c'}},
-    {u'\u1f45', {u'\u1f4d'}},
     {u'\u1f50', {u'\u03a5', u'\u0313'}},
-    {u'\u1f51', {u'\u1f59'}},
     {u'\u1f52', {u'\u03a5', u'\u0313', u'\u0300'}},
-    {u'\u1f53', {u'\u1f5b'}},
     {u'\u1f54', {u'\u03a5', u'\u0313', u'\u0301'}},
-    {u'\u1f55', {u'\u1f5d'}},
     {u'\u1f56', {u'\u03a5', u'\u0313', u'\u0342'}},
-    {u'\u1f57', {u'\u1f5f'}},
-    {u'\u1f60', {u'\u1f68'}},
-    {u'\u1f61', {u'\u1f69'}},
-    {u'\u1f62', {u'\u1f6a'}},
-    {u'\u1f63', {u'\u1f6b'}},
-    {u'\u1f64', {u'\u1f6c'}},
-    {u'\u1f65', {u'\u1f6d'}},
-    {u'\u1f66', {u'\u1f6e'}},
-    {u'\u1f67', {u'\u1f6f'}},
-    {u'\u1f70', {u'\u1fba'}},
-    {u'\u1f71', {u'\u1fbb'}},
-    {u'\u1f72', {u'\u1fc8'}},
-    {u'\u1f73', {u'\u1fc9'}},
-    {u'\u1f74', {u'\u1fca'}},
-    {u'\u1f75', {u'\u1fcb'}},
-    {u'\u1f76', {u'\u1fda'}},
-    {u'\u1f77', {u'\u1fdb'}},
-    {u'\u1f78', {u'\u1ff8'}},
-    {u'\u1f79', {u'\u1ff9'}},
-    {u'\u1f7a', {u'\u1fea'}},
-    {u'\u1f7b', {u'\u1feb'}},
-    {u'\u1f7c', {u'\u1ffa'}},
-    {u'\u1f7d', {u'\u1ffb'}},
     {u'\u1f80', {u'\u1f08', u'\u0399'}},
     {u'\u1f81', {u'\u1f09', u'\u0399'}},
     {u'\u1f82', {u'\u1f0a', u'\u0399'}},
@@ -2290,33 +682,25 @@ constexpr auto UPPERCASE_TABLE = std::to_array<std::pair<char_t, str_t>>({
     {u'\u1fad', {u'\u1f6d', u'\u0399'}},
     {u'\u1fae', {u'\u1f6e', u'\u0399'}},
     {u'\u1faf', {u'\u1f6f', u'\u0399'}},
-    {u'\u1fb0', {u'\u1fb8'}},
-    {u'\u1fb1', {u'\u1fb9'}},
     {u'\u1fb2', {u'\u1fba', u'\u0399'}},
     {u'\u1fb3', {u'\u0391', u'\u0399'}},
     {u'\u1fb4', {u'\u0386', u'\u0399'}},
     {u'\u1fb6', {u'\u0391', u'\u0342'}},
     {u'\u1fb7', {u'\u0391', u'\u0342', u'\u0399'}},
     {u'\u1fbc', {u'\u0391', u'\u0399'}},
-    {u'\u1fbe', {u'\u0399'}},
     {u'\u1fc2', {u'\u1fca', u'\u0399'}},
     {u'\u1fc3', {u'\u0397', u'\u0399'}},
     {u'\u1fc4', {u'\u0389', u'\u0399'}},
     {u'\u1fc6', {u'\u0397', u'\u0342'}},
     {u'\u1fc7', {u'\u0397', u'\u0342', u'\u0399'}},
     {u'\u1fcc', {u'\u0397', u'\u0399'}},
-    {u'\u1fd0', {u'\u1fd8'}},
-    {u'\u1fd1', {u'\u1fd9'}},
     {u'\u1fd2', {u'\u0399', u'\u0308', u'\u0300'}},
     {u'\u1fd3', {u'\u0399', u'\u0308', u'\u0301'}},
     {u'\u1fd6', {u'\u0399', u'\u0342'}},
     {u'\u1fd7', {u'\u0399', u'\u0308', u'\u0342'}},
-    {u'\u1fe0', {u'\u1fe8'}},
-    {u'\u1fe1', {u'\u1fe9'}},
     {u'\u1fe2', {u'\u03a5', u'\u0308', u'\u0300'}},
     {u'\u1fe3', {u'\u03a5', u'\u0308', u'\u0301'}},
     {u'\u1fe4', {u'\u03a1', u'\u0313'}},
-    {u'\u1fe5', {u'\u1fec'}},
     {u'\u1fe6', {u'\u03a5', u'\u0342'}},
     {u'\u1fe7', {u'\u03a5', u'\u0308', u'\u0342'}},
     {u'\u1ff2', {u'\u1ffa', u'\u0399'}},
@@ -2325,390 +709,6 @@ constexpr auto UPPERCASE_TABLE = std::to_array<std::pair<char_t, str_t>>({
     {u'\u1ff6', {u'\u03a9', u'\u0342'}},
     {u'\u1ff7', {u'\u03a9', u'\u0342', u'\u0399'}},
     {u'\u1ffc', {u'\u03a9', u'\u0399'}},
-    {u'\u214e', {u'\u2132'}},
-    {u'\u2170', {u'\u2160'}},
-    {u'\u2171', {u'\u2161'}},
-    {u'\u2172', {u'\u2162'}},
-    {u'\u2173', {u'\u2163'}},
-    {u'\u2174', {u'\u2164'}},
-    {u'\u2175', {u'\u2165'}},
-    {u'\u2176', {u'\u2166'}},
-    {u'\u2177', {u'\u2167'}},
-    {u'\u2178', {u'\u2168'}},
-    {u'\u2179', {u'\u2169'}},
-    {u'\u217a', {u'\u216a'}},
-    {u'\u217b', {u'\u216b'}},
-    {u'\u217c', {u'\u216c'}},
-    {u'\u217d', {u'\u216d'}},
-    {u'\u217e', {u'\u216e'}},
-    {u'\u217f', {u'\u216f'}},
-    {u'\u2184', {u'\u2183'}},
-    {u'\u24d0', {u'\u24b6'}},
-    {u'\u24d1', {u'\u24b7'}},
-    {u'\u24d2', {u'\u24b8'}},
-    {u'\u24d3', {u'\u24b9'}},
-    {u'\u24d4', {u'\u24ba'}},
-    {u'\u24d5', {u'\u24bb'}},
-    {u'\u24d6', {u'\u24bc'}},
-    {u'\u24d7', {u'\u24bd'}},
-    {u'\u24d8', {u'\u24be'}},
-    {u'\u24d9', {u'\u24bf'}},
-    {u'\u24da', {u'\u24c0'}},
-    {u'\u24db', {u'\u24c1'}},
-    {u'\u24dc', {u'\u24c2'}},
-    {u'\u24dd', {u'\u24c3'}},
-    {u'\u24de', {u'\u24c4'}},
-    {u'\u24df', {u'\u24c5'}},
-    {u'\u24e0', {u'\u24c6'}},
-    {u'\u24e1', {u'\u24c7'}},
-    {u'\u24e2', {u'\u24c8'}},
-    {u'\u24e3', {u'\u24c9'}},
-    {u'\u24e4', {u'\u24ca'}},
-    {u'\u24e5', {u'\u24cb'}},
-    {u'\u24e6', {u'\u24cc'}},
-    {u'\u24e7', {u'\u24cd'}},
-    {u'\u24e8', {u'\u24ce'}},
-    {u'\u24e9', {u'\u24cf'}},
-    {u'\u2c30', {u'\u2c00'}},
-    {u'\u2c31', {u'\u2c01'}},
-    {u'\u2c32', {u'\u2c02'}},
-    {u'\u2c33', {u'\u2c03'}},
-    {u'\u2c34', {u'\u2c04'}},
-    {u'\u2c35', {u'\u2c05'}},
-    {u'\u2c36', {u'\u2c06'}},
-    {u'\u2c37', {u'\u2c07'}},
-    {u'\u2c38', {u'\u2c08'}},
-    {u'\u2c39', {u'\u2c09'}},
-    {u'\u2c3a', {u'\u2c0a'}},
-    {u'\u2c3b', {u'\u2c0b'}},
-    {u'\u2c3c', {u'\u2c0c'}},
-    {u'\u2c3d', {u'\u2c0d'}},
-    {u'\u2c3e', {u'\u2c0e'}},
-    {u'\u2c3f', {u'\u2c0f'}},
-    {u'\u2c40', {u'\u2c10'}},
-    {u'\u2c41', {u'\u2c11'}},
-    {u'\u2c42', {u'\u2c12'}},
-    {u'\u2c43', {u'\u2c13'}},
-    {u'\u2c44', {u'\u2c14'}},
-    {u'\u2c45', {u'\u2c15'}},
-    {u'\u2c46', {u'\u2c16'}},
-    {u'\u2c47', {u'\u2c17'}},
-    {u'\u2c48', {u'\u2c18'}},
-    {u'\u2c49', {u'\u2c19'}},
-    {u'\u2c4a', {u'\u2c1a'}},
-    {u'\u2c4b', {u'\u2c1b'}},
-    {u'\u2c4c', {u'\u2c1c'}},
-    {u'\u2c4d', {u'\u2c1d'}},
-    {u'\u2c4e', {u'\u2c1e'}},
-    {u'\u2c4f', {u'\u2c1f'}},
-    {u'\u2c50', {u'\u2c20'}},
-    {u'\u2c51', {u'\u2c21'}},
-    {u'\u2c52', {u'\u2c22'}},
-    {u'\u2c53', {u'\u2c23'}},
-    {u'\u2c54', {u'\u2c24'}},
-    {u'\u2c55', {u'\u2c25'}},
-    {u'\u2c56', {u'\u2c26'}},
-    {u'\u2c57', {u'\u2c27'}},
-    {u'\u2c58', {u'\u2c28'}},
-    {u'\u2c59', {u'\u2c29'}},
-    {u'\u2c5a', {u'\u2c2a'}},
-    {u'\u2c5b', {u'\u2c2b'}},
-    {u'\u2c5c', {u'\u2c2c'}},
-    {u'\u2c5d', {u'\u2c2d'}},
-    {u'\u2c5e', {u'\u2c2e'}},
-    {u'\u2c5f', {u'\u2c2f'}},
-    {u'\u2c61', {u'\u2c60'}},
-    {u'\u2c65', {u'\u023a'}},
-    {u'\u2c66', {u'\u023e'}},
-    {u'\u2c68', {u'\u2c67'}},
-    {u'\u2c6a', {u'\u2c69'}},
-    {u'\u2c6c', {u'\u2c6b'}},
-    {u'\u2c73', {u'\u2c72'}},
-    {u'\u2c76', {u'\u2c75'}},
-    {u'\u2c81', {u'\u2c80'}},
-    {u'\u2c83', {u'\u2c82'}},
-    {u'\u2c85', {u'\u2c84'}},
-    {u'\u2c87', {u'\u2c86'}},
-    {u'\u2c89', {u'\u2c88'}},
-    {u'\u2c8b', {u'\u2c8a'}},
-    {u'\u2c8d', {u'\u2c8c'}},
-    {u'\u2c8f', {u'\u2c8e'}},
-    {u'\u2c91', {u'\u2c90'}},
-    {u'\u2c93', {u'\u2c92'}},
-    {u'\u2c95', {u'\u2c94'}},
-    {u'\u2c97', {u'\u2c96'}},
-    {u'\u2c99', {u'\u2c98'}},
-    {u'\u2c9b', {u'\u2c9a'}},
-    {u'\u2c9d', {u'\u2c9c'}},
-    {u'\u2c9f', {u'\u2c9e'}},
-    {u'\u2ca1', {u'\u2ca0'}},
-    {u'\u2ca3', {u'\u2ca2'}},
-    {u'\u2ca5', {u'\u2ca4'}},
-    {u'\u2ca7', {u'\u2ca6'}},
-    {u'\u2ca9', {u'\u2ca8'}},
-    {u'\u2cab', {u'\u2caa'}},
-    {u'\u2cad', {u'\u2cac'}},
-    {u'\u2caf', {u'\u2cae'}},
-    {u'\u2cb1', {u'\u2cb0'}},
-    {u'\u2cb3', {u'\u2cb2'}},
-    {u'\u2cb5', {u'\u2cb4'}},
-    {u'\u2cb7', {u'\u2cb6'}},
-    {u'\u2cb9', {u'\u2cb8'}},
-    {u'\u2cbb', {u'\u2cba'}},
-    {u'\u2cbd', {u'\u2cbc'}},
-    {u'\u2cbf', {u'\u2cbe'}},
-    {u'\u2cc1', {u'\u2cc0'}},
-    {u'\u2cc3', {u'\u2cc2'}},
-    {u'\u2cc5', {u'\u2cc4'}},
-    {u'\u2cc7', {u'\u2cc6'}},
-    {u'\u2cc9', {u'\u2cc8'}},
-    {u'\u2ccb', {u'\u2cca'}},
-    {u'\u2ccd', {u'\u2ccc'}},
-    {u'\u2ccf', {u'\u2cce'}},
-    {u'\u2cd1', {u'\u2cd0'}},
-    {u'\u2cd3', {u'\u2cd2'}},
-    {u'\u2cd5', {u'\u2cd4'}},
-    {u'\u2cd7', {u'\u2cd6'}},
-    {u'\u2cd9', {u'\u2cd8'}},
-    {u'\u2cdb', {u'\u2cda'}},
-    {u'\u2cdd', {u'\u2cdc'}},
-    {u'\u2cdf', {u'\u2cde'}},
-    {u'\u2ce1', {u'\u2ce0'}},
-    {u'\u2ce3', {u'\u2ce2'}},
-    {u'\u2cec', {u'\u2ceb'}},
-    {u'\u2cee', {u'\u2ced'}},
-    {u'\u2cf3', {u'\u2cf2'}},
-    {u'\u2d00', {u'\u10a0'}},
-    {u'\u2d01', {u'\u10a1'}},
-    {u'\u2d02', {u'\u10a2'}},
-    {u'\u2d03', {u'\u10a3'}},
-    {u'\u2d04', {u'\u10a4'}},
-    {u'\u2d05', {u'\u10a5'}},
-    {u'\u2d06', {u'\u10a6'}},
-    {u'\u2d07', {u'\u10a7'}},
-    {u'\u2d08', {u'\u10a8'}},
-    {u'\u2d09', {u'\u10a9'}},
-    {u'\u2d0a', {u'\u10aa'}},
-    {u'\u2d0b', {u'\u10ab'}},
-    {u'\u2d0c', {u'\u10ac'}},
-    {u'\u2d0d', {u'\u10ad'}},
-    {u'\u2d0e', {u'\u10ae'}},
-    {u'\u2d0f', {u'\u10af'}},
-    {u'\u2d10', {u'\u10b0'}},
-    {u'\u2d11', {u'\u10b1'}},
-    {u'\u2d12', {u'\u10b2'}},
-    {u'\u2d13', {u'\u10b3'}},
-    {u'\u2d14', {u'\u10b4'}},
-    {u'\u2d15', {u'\u10b5'}},
-    {u'\u2d16', {u'\u10b6'}},
-    {u'\u2d17', {u'\u10b7'}},
-    {u'\u2d18', {u'\u10b8'}},
-    {u'\u2d19', {u'\u10b9'}},
-    {u'\u2d1a', {u'\u10ba'}},
-    {u'\u2d1b', {u'\u10bb'}},
-    {u'\u2d1c', {u'\u10bc'}},
-    {u'\u2d1d', {u'\u10bd'}},
-    {u'\u2d1e', {u'\u10be'}},
-    {u'\u2d1f', {u'\u10bf'}},
-    {u'\u2d20', {u'\u10c0'}},
-    {u'\u2d21', {u'\u10c1'}},
-    {u'\u2d22', {u'\u10c2'}},
-    {u'\u2d23', {u'\u10c3'}},
-    {u'\u2d24', {u'\u10c4'}},
-    {u'\u2d25', {u'\u10c5'}},
-    {u'\u2d27', {u'\u10c7'}},
-    {u'\u2d2d', {u'\u10cd'}},
-    {u'\ua641', {u'\ua640'}},
-    {u'\ua643', {u'\ua642'}},
-    {u'\ua645', {u'\ua644'}},
-    {u'\ua647', {u'\ua646'}},
-    {u'\ua649', {u'\ua648'}},
-    {u'\ua64b', {u'\ua64a'}},
-    {u'\ua64d', {u'\ua64c'}},
-    {u'\ua64f', {u'\ua64e'}},
-    {u'\ua651', {u'\ua650'}},
-    {u'\ua653', {u'\ua652'}},
-    {u'\ua655', {u'\ua654'}},
-    {u'\ua657', {u'\ua656'}},
-    {u'\ua659', {u'\ua658'}},
-    {u'\ua65b', {u'\ua65a'}},
-    {u'\ua65d', {u'\ua65c'}},
-    {u'\ua65f', {u'\ua65e'}},
-    {u'\ua661', {u'\ua660'}},
-    {u'\ua663', {u'\ua662'}},
-    {u'\ua665', {u'\ua664'}},
-    {u'\ua667', {u'\ua666'}},
-    {u'\ua669', {u'\ua668'}},
-    {u'\ua66b', {u'\ua66a'}},
-    {u'\ua66d', {u'\ua66c'}},
-    {u'\ua681', {u'\ua680'}},
-    {u'\ua683', {u'\ua682'}},
-    {u'\ua685', {u'\ua684'}},
-    {u'\ua687', {u'\ua686'}},
-    {u'\ua689', {u'\ua688'}},
-    {u'\ua68b', {u'\ua68a'}},
-    {u'\ua68d', {u'\ua68c'}},
-    {u'\ua68f', {u'\ua68e'}},
-    {u'\ua691', {u'\ua690'}},
-    {u'\ua693', {u'\ua692'}},
-    {u'\ua695', {u'\ua694'}},
-    {u'\ua697', {u'\ua696'}},
-    {u'\ua699', {u'\ua698'}},
-    {u'\ua69b', {u'\ua69a'}},
-    {u'\ua723', {u'\ua722'}},
-    {u'\ua725', {u'\ua724'}},
-    {u'\ua727', {u'\ua726'}},
-    {u'\ua729', {u'\ua728'}},
-    {u'\ua72b', {u'\ua72a'}},
-    {u'\ua72d', {u'\ua72c'}},
-    {u'\ua72f', {u'\ua72e'}},
-    {u'\ua733', {u'\ua732'}},
-    {u'\ua735', {u'\ua734'}},
-    {u'\ua737', {u'\ua736'}},
-    {u'\ua739', {u'\ua738'}},
-    {u'\ua73b', {u'\ua73a'}},
-    {u'\ua73d', {u'\ua73c'}},
-    {u'\ua73f', {u'\ua73e'}},
-    {u'\ua741', {u'\ua740'}},
-    {u'\ua743', {u'\ua742'}},
-    {u'\ua745', {u'\ua744'}},
-    {u'\ua747', {u'\ua746'}},
-    {u'\ua749', {u'\ua748'}},
-    {u'\ua74b', {u'\ua74a'}},
-    {u'\ua74d', {u'\ua74c'}},
-    {u'\ua74f', {u'\ua74e'}},
-    {u'\ua751', {u'\ua750'}},
-    {u'\ua753', {u'\ua752'}},
-    {u'\ua755', {u'\ua754'}},
-    {u'\ua757', {u'\ua756'}},
-    {u'\ua759', {u'\ua758'}},
-    {u'\ua75b', {u'\ua75a'}},
-    {u'\ua75d', {u'\ua75c'}},
-    {u'\ua75f', {u'\ua75e'}},
-    {u'\ua761', {u'\ua760'}},
-    {u'\ua763', {u'\ua762'}},
-    {u'\ua765', {u'\ua764'}},
-    {u'\ua767', {u'\ua766'}},
-    {u'\ua769', {u'\ua768'}},
-    {u'\ua76b', {u'\ua76a'}},
-    {u'\ua76d', {u'\ua76c'}},
-    {u'\ua76f', {u'\ua76e'}},
-    {u'\ua77a', {u'\ua779'}},
-    {u'\ua77c', {u'\ua77b'}},
-    {u'\ua77f', {u'\ua77e'}},
-    {u'\ua781', {u'\ua780'}},
-    {u'\ua783', {u'\ua782'}},
-    {u'\ua785', {u'\ua784'}},
-    {u'\ua787', {u'\ua786'}},
-    {u'\ua78c', {u'\ua78b'}},
-    {u'\ua791', {u'\ua790'}},
-    {u'\ua793', {u'\ua792'}},
-    {u'\ua794', {u'\ua7c4'}},
-    {u'\ua797', {u'\ua796'}},
-    {u'\ua799', {u'\ua798'}},
-    {u'\ua79b', {u'\ua79a'}},
-    {u'\ua79d', {u'\ua79c'}},
-    {u'\ua79f', {u'\ua79e'}},
-    {u'\ua7a1', {u'\ua7a0'}},
-    {u'\ua7a3', {u'\ua7a2'}},
-    {u'\ua7a5', {u'\ua7a4'}},
-    {u'\ua7a7', {u'\ua7a6'}},
-    {u'\ua7a9', {u'\ua7a8'}},
-    {u'\ua7b5', {u'\ua7b4'}},
-    {u'\ua7b7', {u'\ua7b6'}},
-    {u'\ua7b9', {u'\ua7b8'}},
-    {u'\ua7bb', {u'\ua7ba'}},
-    {u'\ua7bd', {u'\ua7bc'}},
-    {u'\ua7bf', {u'\ua7be'}},
-    {u'\ua7c1', {u'\ua7c0'}},
-    {u'\ua7c3', {u'\ua7c2'}},
-    {u'\ua7c8', {u'\ua7c7'}},
-    {u'\ua7ca', {u'\ua7c9'}},
-    {u'\ua7d1', {u'\ua7d0'}},
-    {u'\ua7d7', {u'\ua7d6'}},
-    {u'\ua7d9', {u'\ua7d8'}},
-    {u'\ua7f6', {u'\ua7f5'}},
-    {u'\uab53', {u'\ua7b3'}},
-    {u'\uab70', {u'\u13a0'}},
-    {u'\uab71', {u'\u13a1'}},
-    {u'\uab72', {u'\u13a2'}},
-    {u'\uab73', {u'\u13a3'}},
-    {u'\uab74', {u'\u13a4'}},
-    {u'\uab75', {u'\u13a5'}},
-    {u'\uab76', {u'\u13a6'}},
-    {u'\uab77', {u'\u13a7'}},
-    {u'\uab78', {u'\u13a8'}},
-    {u'\uab79', {u'\u13a9'}},
-    {u'\uab7a', {u'\u13aa'}},
-    {u'\uab7b', {u'\u13ab'}},
-    {u'\uab7c', {u'\u13ac'}},
-    {u'\uab7d', {u'\u13ad'}},
-    {u'\uab7e', {u'\u13ae'}},
-    {u'\uab7f', {u'\u13af'}},
-    {u'\uab80', {u'\u13b0'}},
-    {u'\uab81', {u'\u13b1'}},
-    {u'\uab82', {u'\u13b2'}},
-    {u'\uab83', {u'\u13b3'}},
-    {u'\uab84', {u'\u13b4'}},
-    {u'\uab85', {u'\u13b5'}},
-    {u'\uab86', {u'\u13b6'}},
-    {u'\uab87', {u'\u13b7'}},
-    {u'\uab88', {u'\u13b8'}},
-    {u'\uab89', {u'\u13b9'}},
-    {u'\uab8a', {u'\u13ba'}},
-    {u'\uab8b', {u'\u13bb'}},
-    {u'\uab8c', {u'\u13bc'}},
-    {u'\uab8d', {u'\u13bd'}},
-    {u'\uab8e', {u'\u13be'}},
-    {u'\uab8f', {u'\u13bf'}},
-    {u'\uab90', {u'\u13c0'}},
-    {u'\uab91', {u'\u13c1'}},
-    {u'\uab92', {u'\u13c2'}},
-    {u'\uab93', {u'\u13c3'}},
-    {u'\uab94', {u'\u13c4'}},
-    {u'\uab95', {u'\u13c5'}},
-    {u'\uab96', {u'\u13c6'}},
-    {u'\uab97', {u'\u13c7'}},
-    {u'\uab98', {u'\u13c8'}},
-    {u'\uab99', {u'\u13c9'}},
-    {u'\uab9a', {u'\u13ca'}},
-    {u'\uab9b', {u'\u13cb'}},
-    {u'\uab9c', {u'\u13cc'}},
-    {u'\uab9d', {u'\u13cd'}},
-    {u'\uab9e', {u'\u13ce'}},
-    {u'\uab9f', {u'\u13cf'}},
-    {u'\uaba0', {u'\u13d0'}},
-    {u'\uaba1', {u'\u13d1'}},
-    {u'\uaba2', {u'\u13d2'}},
-    {u'\uaba3', {u'\u13d3'}},
-    {u'\uaba4', {u'\u13d4'}},
-    {u'\uaba5', {u'\u13d5'}},
-    {u'\uaba6', {u'\u13d6'}},
-    {u'\uaba7', {u'\u13d7'}},
-    {u'\uaba8', {u'\u13d8'}},
-    {u'\uaba9', {u'\u13d9'}},
-    {u'\uabaa', {u'\u13da'}},
-    {u'\uabab', {u'\u13db'}},
-    {u'\uabac', {u'\u13dc'}},
-    {u'\uabad', {u'\u13dd'}},
-    {u'\uabae', {u'\u13de'}},
-    {u'\uabaf', {u'\u13df'}},
-    {u'\uabb0', {u'\u13e0'}},
-    {u'\uabb1', {u'\u13e1'}},
-    {u'\uabb2', {u'\u13e2'}},
-    {u'\uabb3', {u'\u13e3'}},
-    {u'\uabb4', {u'\u13e4'}},
-    {u'\uabb5', {u'\u13e5'}},
-    {u'\uabb6', {u'\u13e6'}},
-    {u'\uabb7', {u'\u13e7'}},
-    {u'\uabb8', {u'\u13e8'}},
-    {u'\uabb9', {u'\u13e9'}},
-    {u'\uabba', {u'\u13ea'}},
-    {u'\uabbb', {u'\u13eb'}},
-    {u'\uabbc', {u'\u13ec'}},
-    {u'\uabbd', {u'\u13ed'}},
-    {u'\uabbe', {u'\u13ee'}},
-    {u'\uabbf', {u'\u13ef'}},
     {u'\ufb00', {'F', 'F'}},
     {u'\ufb01', {'F', 'I'}},
     {u'\ufb02', {'F', 'L'}},
@@ -2721,299 +721,25 @@ constexpr auto UPPERCASE_TABLE = std::to_array<std::pair<char_t, str_t>>({
     {u'\ufb15', {u'\u0544', u'\u053b'}},
     {u'\ufb16', {u'\u054e', u'\u0546'}},
     {u'\ufb17', {u'\u0544', u'\u053d'}},
-    {u'\uff41', {u'\uff21'}},
-    {u'\uff42', {u'\uff22'}},
-    {u'\uff43', {u'\uff23'}},
-    {u'\uff44', {u'\uff24'}},
-    {u'\uff45', {u'\uff25'}},
-    {u'\uff46', {u'\uff26'}},
-    {u'\uff47', {u'\uff27'}},
-    {u'\uff48', {u'\uff28'}},
-    {u'\uff49', {u'\uff29'}},
-    {u'\uff4a', {u'\uff2a'}},
-    {u'\uff4b', {u'\uff2b'}},
-    {u'\uff4c', {u'\uff2c'}},
-    {u'\uff4d', {u'\uff2d'}},
-    {u'\uff4e', {u'\uff2e'}},
-    {u'\uff4f', {u'\uff2f'}},
-    {u'\uff50', {u'\uff30'}},
-    {u'\uff51', {u'\uff31'}},
-    {u'\uff52', {u'\uff32'}},
-    {u'\uff53', {u'\uff33'}},
-    {u'\uff54', {u'\uff34'}},
-    {u'\uff55', {u'\uff35'}},
-    {u'\uff56', {u'\uff36'}},
-    {u'\uff57', {u'\uff37'}},
-    {u'\uff58', {u'\uff38'}},
-    {u'\uff59', {u'\uff39'}},
-    {u'\uff5a', {u'\uff3a'}},
-    {U'\U00010428', {U'\U00010400'}},
-    {U'\U00010429', {U'\U00010401'}},
-    {U'\U0001042a', {U'\U00010402'}},
-    {U'\U0001042b', {U'\U00010403'}},
-    {U'\U0001042c', {U'\U00010404'}},
-    {U'\U0001042d', {U'\U00010405'}},
-    {U'\U0001042e', {U'\U00010406'}},
-    {U'\U0001042f', {U'\U00010407'}},
-    {U'\U00010430', {U'\U00010408'}},
-    {U'\U00010431', {U'\U00010409'}},
-    {U'\U00010432', {U'\U0001040a'}},
-    {U'\U00010433', {U'\U0001040b'}},
-    {U'\U00010434', {U'\U0001040c'}},
-    {U'\U00010435', {U'\U0001040d'}},
-    {U'\U00010436', {U'\U0001040e'}},
-    {U'\U00010437', {U'\U0001040f'}},
-    {U'\U00010438', {U'\U00010410'}},
-    {U'\U00010439', {U'\U00010411'}},
-    {U'\U0001043a', {U'\U00010412'}},
-    {U'\U0001043b', {U'\U00010413'}},
-    {U'\U0001043c', {U'\U00010414'}},
-    {U'\U0001043d', {U'\U00010415'}},
-    {U'\U0001043e', {U'\U00010416'}},
-    {U'\U0001043f', {U'\U00010417'}},
-    {U'\U00010440', {U'\U00010418'}},
-    {U'\U00010441', {U'\U00010419'}},
-    {U'\U00010442', {U'\U0001041a'}},
-    {U'\U00010443', {U'\U0001041b'}},
-    {U'\U00010444', {U'\U0001041c'}},
-    {U'\U00010445', {U'\U0001041d'}},
-    {U'\U00010446', {U'\U0001041e'}},
-    {U'\U00010447', {U'\U0001041f'}},
-    {U'\U00010448', {U'\U00010420'}},
-    {U'\U00010449', {U'\U00010421'}},
-    {U'\U0001044a', {U'\U00010422'}},
-    {U'\U0001044b', {U'\U00010423'}},
-    {U'\U0001044c', {U'\U00010424'}},
-    {U'\U0001044d', {U'\U00010425'}},
-    {U'\U0001044e', {U'\U00010426'}},
-    {U'\U0001044f', {U'\U00010427'}},
-    {U'\U000104d8', {U'\U000104b0'}},
-    {U'\U000104d9', {U'\U000104b1'}},
-    {U'\U000104da', {U'\U000104b2'}},
-    {U'\U000104db', {U'\U000104b3'}},
-    {U'\U000104dc', {U'\U000104b4'}},
-    {U'\U000104dd', {U'\U000104b5'}},
-    {U'\U000104de', {U'\U000104b6'}},
-    {U'\U000104df', {U'\U000104b7'}},
-    {U'\U000104e0', {U'\U000104b8'}},
-    {U'\U000104e1', {U'\U000104b9'}},
-    {U'\U000104e2', {U'\U000104ba'}},
-    {U'\U000104e3', {U'\U000104bb'}},
-    {U'\U000104e4', {U'\U000104bc'}},
-    {U'\U000104e5', {U'\U000104bd'}},
-    {U'\U000104e6', {U'\U000104be'}},
-    {U'\U000104e7', {U'\U000104bf'}},
-    {U'\U000104e8', {U'\U000104c0'}},
-    {U'\U000104e9', {U'\U000104c1'}},
-    {U'\U000104ea', {U'\U000104c2'}},
-    {U'\U000104eb', {U'\U000104c3'}},
-    {U'\U000104ec', {U'\U000104c4'}},
-    {U'\U000104ed', {U'\U000104c5'}},
-    {U'\U000104ee', {U'\U000104c6'}},
-    {U'\U000104ef', {U'\U000104c7'}},
-    {U'\U000104f0', {U'\U000104c8'}},
-    {U'\U000104f1', {U'\U000104c9'}},
-    {U'\U000104f2', {U'\U000104ca'}},
-    {U'\U000104f3', {U'\U000104cb'}},
-    {U'\U000104f4', {U'\U000104cc'}},
-    {U'\U000104f5', {U'\U000104cd'}},
-    {U'\U000104f6', {U'\U000104ce'}},
-    {U'\U000104f7', {U'\U000104cf'}},
-    {U'\U000104f8', {U'\U000104d0'}},
-    {U'\U000104f9', {U'\U000104d1'}},
-    {U'\U000104fa', {U'\U000104d2'}},
-    {U'\U000104fb', {U'\U000104d3'}},
-    {U'\U00010597', {U'\U00010570'}},
-    {U'\U00010598', {U'\U00010571'}},
-    {U'\U00010599', {U'\U00010572'}},
-    {U'\U0001059a', {U'\U00010573'}},
-    {U'\U0001059b', {U'\U00010574'}},
-    {U'\U0001059c', {U'\U00010575'}},
-    {U'\U0001059d', {U'\U00010576'}},
-    {U'\U0001059e', {U'\U00010577'}},
-    {U'\U0001059f', {U'\U00010578'}},
-    {U'\U000105a0', {U'\U00010579'}},
-    {U'\U000105a1', {U'\U0001057a'}},
-    {U'\U000105a3', {U'\U0001057c'}},
-    {U'\U000105a4', {U'\U0001057d'}},
-    {U'\U000105a5', {U'\U0001057e'}},
-    {U'\U000105a6', {U'\U0001057f'}},
-    {U'\U000105a7', {U'\U00010580'}},
-    {U'\U000105a8', {U'\U00010581'}},
-    {U'\U000105a9', {U'\U00010582'}},
-    {U'\U000105aa', {U'\U00010583'}},
-    {U'\U000105ab', {U'\U00010584'}},
-    {U'\U000105ac', {U'\U00010585'}},
-    {U'\U000105ad', {U'\U00010586'}},
-    {U'\U000105ae', {U'\U00010587'}},
-    {U'\U000105af', {U'\U00010588'}},
-    {U'\U000105b0', {U'\U00010589'}},
-    {U'\U000105b1', {U'\U0001058a'}},
-    {U'\U000105b3', {U'\U0001058c'}},
-    {U'\U000105b4', {U'\U0001058d'}},
-    {U'\U000105b5', {U'\U0001058e'}},
-    {U'\U000105b6', {U'\U0001058f'}},
-    {U'\U000105b7', {U'\U00010590'}},
-    {U'\U000105b8', {U'\U00010591'}},
-    {U'\U000105b9', {U'\U00010592'}},
-    {U'\U000105bb', {U'\U00010594'}},
-    {U'\U000105bc', {U'\U00010595'}},
-    {U'\U00010cc0', {U'\U00010c80'}},
-    {U'\U00010cc1', {U'\U00010c81'}},
-    {U'\U00010cc2', {U'\U00010c82'}},
-    {U'\U00010cc3', {U'\U00010c83'}},
-    {U'\U00010cc4', {U'\U00010c84'}},
-    {U'\U00010cc5', {U'\U00010c85'}},
-    {U'\U00010cc6', {U'\U00010c86'}},
-    {U'\U00010cc7', {U'\U00010c87'}},
-    {U'\U00010cc8', {U'\U00010c88'}},
-    {U'\U00010cc9', {U'\U00010c89'}},
-    {U'\U00010cca', {U'\U00010c8a'}},
-    {U'\U00010ccb', {U'\U00010c8b'}},
-    {U'\U00010ccc', {U'\U00010c8c'}},
-    {U'\U00010ccd', {U'\U00010c8d'}},
-    {U'\U00010cce', {U'\U00010c8e'}},
-    {U'\U00010ccf', {U'\U00010c8f'}},
-    {U'\U00010cd0', {U'\U00010c90'}},
-    {U'\U00010cd1', {U'\U00010c91'}},
-    {U'\U00010cd2', {U'\U00010c92'}},
-    {U'\U00010cd3', {U'\U00010c93'}},
-    {U'\U00010cd4', {U'\U00010c94'}},
-    {U'\U00010cd5', {U'\U00010c95'}},
-    {U'\U00010cd6', {U'\U00010c96'}},
-    {U'\U00010cd7', {U'\U00010c97'}},
-    {U'\U00010cd8', {U'\U00010c98'}},
-    {U'\U00010cd9', {U'\U00010c99'}},
-    {U'\U00010cda', {U'\U00010c9a'}},
-    {U'\U00010cdb', {U'\U00010c9b'}},
-    {U'\U00010cdc', {U'\U00010c9c'}},
-    {U'\U00010cdd', {U'\U00010c9d'}},
-    {U'\U00010cde', {U'\U00010c9e'}},
-    {U'\U00010cdf', {U'\U00010c9f'}},
-    {U'\U00010ce0', {U'\U00010ca0'}},
-    {U'\U00010ce1', {U'\U00010ca1'}},
-    {U'\U00010ce2', {U'\U00010ca2'}},
-    {U'\U00010ce3', {U'\U00010ca3'}},
-    {U'\U00010ce4', {U'\U00010ca4'}},
-    {U'\U00010ce5', {U'\U00010ca5'}},
-    {U'\U00010ce6', {U'\U00010ca6'}},
-    {U'\U00010ce7', {U'\U00010ca7'}},
-    {U'\U00010ce8', {U'\U00010ca8'}},
-    {U'\U00010ce9', {U'\U00010ca9'}},
-    {U'\U00010cea', {U'\U00010caa'}},
-    {U'\U00010ceb', {U'\U00010cab'}},
-    {U'\U00010cec', {U'\U00010cac'}},
-    {U'\U00010ced', {U'\U00010cad'}},
-    {U'\U00010cee', {U'\U00010cae'}},
-    {U'\U00010cef', {U'\U00010caf'}},
-    {U'\U00010cf0', {U'\U00010cb0'}},
-    {U'\U00010cf1', {U'\U00010cb1'}},
-    {U'\U00010cf2', {U'\U00010cb2'}},
-    {U'\U000118c0', {U'\U000118a0'}},
-    {U'\U000118c1', {U'\U000118a1'}},
-    {U'\U000118c2', {U'\U000118a2'}},
-    {U'\U000118c3', {U'\U000118a3'}},
-    {U'\U000118c4', {U'\U000118a4'}},
-    {U'\U000118c5', {U'\U000118a5'}},
-    {U'\U000118c6', {U'\U000118a6'}},
-    {U'\U000118c7', {U'\U000118a7'}},
-    {U'\U000118c8', {U'\U000118a8'}},
-    {U'\U000118c9', {U'\U000118a9'}},
-    {U'\U000118ca', {U'\U000118aa'}},
-    {U'\U000118cb', {U'\U000118ab'}},
-    {U'\U000118cc', {U'\U000118ac'}},
-    {U'\U000118cd', {U'\U000118ad'}},
-    {U'\U000118ce', {U'\U000118ae'}},
-    {U'\U000118cf', {U'\U000118af'}},
-    {U'\U000118d0', {U'\U000118b0'}},
-    {U'\U000118d1', {U'\U000118b1'}},
-    {U'\U000118d2', {U'\U000118b2'}},
-    {U'\U000118d3', {U'\U000118b3'}},
-    {U'\U000118d4', {U'\U000118b4'}},
-    {U'\U000118d5', {U'\U000118b5'}},
-    {U'\U000118d6', {U'\U000118b6'}},
-    {U'\U000118d7', {U'\U000118b7'}},
-    {U'\U000118d8', {U'\U000118b8'}},
-    {U'\U000118d9', {U'\U000118b9'}},
-    {U'\U000118da', {U'\U000118ba'}},
-    {U'\U000118db', {U'\U000118bb'}},
-    {U'\U000118dc', {U'\U000118bc'}},
-    {U'\U000118dd', {U'\U000118bd'}},
-    {U'\U000118de', {U'\U000118be'}},
-    {U'\U000118df', {U'\U000118bf'}},
-    {U'\U00016e60', {U'\U00016e40'}},
-    {U'\U00016e61', {U'\U00016e41'}},
-    {U'\U00016e62', {U'\U00016e42'}},
-    {U'\U00016e63', {U'\U00016e43'}},
-    {U'\U00016e64', {U'\U00016e44'}},
-    {U'\U00016e65', {U'\U00016e45'}},
-    {U'\U00016e66', {U'\U00016e46'}},
-    {U'\U00016e67', {U'\U00016e47'}},
-    {U'\U00016e68', {U'\U00016e48'}},
-    {U'\U00016e69', {U'\U00016e49'}},
-    {U'\U00016e6a', {U'\U00016e4a'}},
-    {U'\U00016e6b', {U'\U00016e4b'}},
-    {U'\U00016e6c', {U'\U00016e4c'}},
-    {U'\U00016e6d', {U'\U00016e4d'}},
-    {U'\U00016e6e', {U'\U00016e4e'}},
-    {U'\U00016e6f', {U'\U00016e4f'}},
-    {U'\U00016e70', {U'\U00016e50'}},
-    {U'\U00016e71', {U'\U00016e51'}},
-    {U'\U00016e72', {U'\U00016e52'}},
-    {U'\U00016e73', {U'\U00016e53'}},
-    {U'\U00016e74', {U'\U00016e54'}},
-    {U'\U00016e75', {U'\U00016e55'}},
-    {U'\U00016e76', {U'\U00016e56'}},
-    {U'\U00016e77', {U'\U00016e57'}},
-    {U'\U00016e78', {U'\U00016e58'}},
-    {U'\U00016e79', {U'\U00016e59'}},
-    {U'\U00016e7a', {U'\U00016e5a'}},
-    {U'\U00016e7b', {U'\U00016e5b'}},
-    {U'\U00016e7c', {U'\U00016e5c'}},
-    {U'\U00016e7d', {U'\U00016e5d'}},
-    {U'\U00016e7e', {U'\U00016e5e'}},
-    {U'\U00016e7f', {U'\U00016e5f'}},
-    {U'\U0001e922', {U'\U0001e900'}},
-    {U'\U0001e923', {U'\U0001e901'}},
-    {U'\U0001e924', {U'\U0001e902'}},
-    {U'\U0001e925', {U'\U0001e903'}},
-    {U'\U0001e926', {U'\U0001e904'}},
-    {U'\U0001e927', {U'\U0001e905'}},
-    {U'\U0001e928', {U'\U0001e906'}},
-    {U'\U0001e929', {U'\U0001e907'}},
-    {U'\U0001e92a', {U'\U0001e908'}},
-    {U'\U0001e92b', {U'\U0001e909'}},
-    {U'\U0001e92c', {U'\U0001e90a'}},
-    {U'\U0001e92d', {U'\U0001e90b'}},
-    {U'\U0001e92e', {U'\U0001e90c'}},
-    {U'\U0001e92f', {U'\U0001e90d'}},
-    {U'\U0001e930', {U'\U0001e90e'}},
-    {U'\U0001e931', {U'\U0001e90f'}},
-    {U'\U0001e932', {U'\U0001e910'}},
-    {U'\U0001e933', {U'\U0001e911'}},
-    {U'\U0001e934', {U'\U0001e912'}},
-    {U'\U0001e935', {U'\U0001e913'}},
-    {U'\U0001e936', {U'\U0001e914'}},
-    {U'\U0001e937', {U'\U0001e915'}},
-    {U'\U0001e938', {U'\U0001e916'}},
-    {U'\U0001e939', {U'\U0001e917'}},
-    {U'\U0001e93a', {U'\U0001e918'}},
-    {U'\U0001e93b', {U'\U0001e919'}},
-    {U'\U0001e93c', {U'\U0001e91a'}},
-    {U'\U0001e93d', {U'\U0001e91b'}},
-    {U'\U0001e93e', {U'\U0001e91c'}},
-    {U'\U0001e93f', {U'\U0001e91d'}},
-    {U'\U0001e940', {U'\U0001e91e'}},
-    {U'\U0001e941', {U'\U0001e91f'}},
-    {U'\U0001e942', {U'\U0001e920'}},
-    {U'\U0001e943', {U'\U0001e921'}},
 });
 
+// the mapping of a char as a delta from the trie, a search only for the chars that expand
+constexpr auto convert(char_t ch, const unicode::property_trie& table,
+                       std::span<const std::int32_t> deltas,
+                       std::span<const std::pair<char_t, str_t>> expansions) noexcept -> str_t {
+  auto code = std::uint32_t(ch);
+  auto index = table[code];
+  if (index == EXPANDS) {
+    return *bsearch_table(ch, expansions);
+  }
+  return {char_t(unsafe, code + deltas[index])};
+}
+
 constexpr auto to_lower(char_t ch) noexcept -> str_t {
   if (utf8::is_ascii(ch)) {
     return {ascii::to_lower(ch)};
   } else {
-    return bsearch_table(ch, LOWERCASE_TABLE).value_or(str_t{ch});
+    return convert(ch, LOWER, LOWER_DELTAS, LOWER_EXPANSIONS);
   }
 }
 
@@ -3021,7 +747,7 @@ constexpr auto to_upper(char_t ch) noexcept -> str_t {
   if (utf8::is_ascii(ch)) {
     return {ascii::to_upper(ch)};
   } else {
-    return bsearch_table(ch, UPPERCASE_TABLE).value_or(str_t{ch});
+    return convert(ch, UPPER, UPPER_DELTAS, UPPER_EXPANSIONS);
   }
 }
 
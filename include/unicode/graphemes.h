@@ -0,0 +1,185 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+constexpr auto ascii_grapheme_break(char8_t byte) noexcept -> unicode::gcb {
+  using enum unicode::gcb;
+  if (byte == '\r') {
+    return cr;
+  }
+  if (byte == '\n') {
+    return lf;
+  }
+  return byte < 0x20 || byte == 0x7F ? control : other;
+}
+
+// what UAX #29 rules GB3-GB13 say about a pair of properties,
+// GB11 and GB12/13 also depend on the chars before the pair
+enum class grapheme_rule : std::uint8_t { keep, split, emoji, regional };
+
+constexpr auto grapheme_pair_rule(unicode::gcb prev, unicode::gcb next) noexcept
+    -> grapheme_rule {
+  using enum unicode::gcb;
+  if (prev == cr && next == lf) {
+    return grapheme_rule::keep;  // GB3
+  }
+  if (prev == control || prev == cr || prev == lf || next == control || next == cr ||
+      next == lf) {
+    return grapheme_rule::split;  // GB4, GB5
+  }
+  if (prev == l && (next == l || next == v || next == lv || next == lvt)) {
+    return grapheme_rule::keep;  // GB6
+  }
+  if ((prev == lv || prev == v) && (next == v || next == t)) {
+    return grapheme_rule::keep;  // GB7
+  }
+  if ((prev == lvt || prev == t) && next == t) {
+    return grapheme_rule::keep;  // GB8
+  }
+  if (next == extend || next == zwj || next == spacing_mark || prev == prepend) {
+    return grapheme_rule::keep;  // GB9, GB9a, GB9b
+  }
+  if (prev == zwj && next == extended_pictographic) {
+    return grapheme_rule::emoji;  // GB11
+  }
+  if (prev == regional_indicator && next == regional_indicator) {
+    return grapheme_rule::regional;  // GB12, GB13
+  }
+  return grapheme_rule::split;  // GB999
+}
+
+constexpr auto GRAPHEME_RULES = [] {
+  constexpr size_t values = size_t(unicode::gcb::extended_pictographic) + 1;
+  std::array<std::array<grapheme_rule, values>, values> rules{};
+  for (size_t prev = 0; prev < values; prev++) {
+    for (size_t next = 0; next < values; next++) {
+      rules[prev][next] = grapheme_pair_rule(unicode::gcb(prev), unicode::gcb(next));
+    }
+  }
+  return rules;
+}();
+
+// fed with the property of every char in turn
+class grapheme_breaker {
+  unicode::gcb _prev = unicode::gcb::control;  // a break before the first char
+  bool _emoji = false;                         // ExtPict Extend* just before
+  bool _emoji_zwj = false;                     // ExtPict Extend* ZWJ just before
+  size_t _regional = 0;                        // regional indicators just before
+
+ public:
+  /// whether there is a boundary before a char with the property `next`
+  constexpr auto feed(unicode::gcb next) noexcept -> bool {
+    using enum unicode::gcb;
+    auto boundary = true;
+    switch (GRAPHEME_RULES[size_t(_prev)][size_t(next)]) {
+      case grapheme_rule::keep:
+        boundary = false;
+        break;
+      case grapheme_rule::split:
+        break;
+      case grapheme_rule::emoji:
+        boundary = not _emoji_zwj;
+        break;
+      case grapheme_rule::regional:
+        boundary = _regional % 2 == 0;
+        break;
+    }
+
+    _emoji_zwj = _emoji && next == zwj;
+    _emoji = next == extended_pictographic || (_emoji && next == extend);
+    _regional = next == regional_indicator ? _regional + 1 : 0;
+    _prev = next;
+    return boundary;
+  }
+};
+
+constexpr auto grapheme_break(const char* place) noexcept -> unicode::gcb {
+  char8_t byte = *place;
+  return byte < 0x80 ? ascii_grapheme_break(byte) : unicode::gcb(unicode::GCB[decode_char(place)]);
+}
+
+struct graphemes_skipped {
+  size_t pos;
+  size_t count;
+};
+
+// passes up to `limit` grapheme clusters from `pos` in one pass over the chars,
+// ascii runs are passed without the table: their chars are clusters of their own,
+// except for CR LF and for the last one, which may be followed by a combining mark
+constexpr auto skip_graphemes(std::string_view str, size_t pos, size_t limit) noexcept
+    -> graphemes_skipped {
+  if (pos == str.size() || limit == 0) {
+    return {pos, 0};
+  }
+
+  grapheme_breaker breaker;
+  breaker.feed(grapheme_break(str.data() + pos));
+  pos += thin_decode(str[pos]);
+
+  size_t count = 0;  // boundaries passed
+  while (pos < str.size()) {
+    if (char8_t(str[pos]) >= 0x80) {
+      if (breaker.feed(grapheme_break(str.data() + pos)) && ++count == limit) {
+        return {pos, count};
+      }
+      pos += thin_decode(str[pos]);
+      continue;
+    }
+
+    if (breaker.feed(ascii_grapheme_break(str[pos])) && ++count == limit) {
+      return {pos, count};
+    }
+    auto run = str.substr(pos, skip_ascii(str, pos) - pos);
+    auto inner = run.size() - 1;
+    for (auto crlf = run.find("\r\n"); crlf != run.npos; crlf = run.find("\r\n", crlf + 2)) {
+      inner--;
+    }
+
+    if (count + inner >= limit) {
+      for (size_t at = 1;; at++) {
+        if (not(run[at - 1] == '\r' && run[at] == '\n') && ++count == limit) {
+          return {pos + at, count};
+        }
+      }
+    }
+    count += inner;
+    breaker.feed(ascii_grapheme_break(run.back()));
+    pos += run.size();
+  }
+  return {pos, count + 1};  // the end of the string is a boundary too
+}
+
+// end of the grapheme cluster that starts at `pos`
+constexpr auto grapheme_end(std::string_view str, size_t pos) noexcept -> size_t {
+  char8_t first = str[pos];
+  // an ascii char followed by an ascii one never needs the table
+  if (first < 0x80 && (pos + 1 == str.size() || char8_t(str[pos + 1]) < 0x80)) {
+    return pos + 1 + size_t(first == '\r' && pos + 1 < str.size() && str[pos + 1] == '\n');
+  }
+  return skip_graphemes(str, pos, 1).pos;
+}
+
+}  // namespace noexport
+
+/// extended grapheme clusters (user-perceived characters) of UAX #29
+using graphemes_view = segments_view<noexport::grapheme_end>;
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::graphemes() const noexcept {
+  return graphemes_view(*this);
+}
+
+/// number of extended grapheme clusters
+[[nodiscard]] constexpr auto count_graphemes(string_view str) noexcept -> size_t {
+  return noexport::skip_graphemes(str, 0, SIZE_MAX).count;
+}
+
+/// first `n` extended grapheme clusters (or the whole string if it has less)
+[[nodiscard]] constexpr auto truncate_graphemes(string_view str, size_t n) noexcept
+    -> string_view {
+  auto bytes = std::string_view(str);
+  return {noexport::unsafe, bytes.substr(0, noexport::skip_graphemes(bytes, 0, n).pos)};
+}
+
+}  // namespace utf8
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <compare>  // std::weak_ordering
+
+namespace utf8 {
+
+namespace noexport {
+constexpr auto fold_ascii(char8_t byte) noexcept -> char8_t {
+  return unsigned(byte - 'A') < 26 ? byte | ASCII_CASE_MASK : byte;
+}
+
+constexpr auto fold_code(std::uint32_t code) noexcept -> std::uint32_t {
+  return code + unicode::FOLD_DELTAS[unicode::FOLD[code]];
+}
+
+struct folded_t {
+  std::uint32_t code;
+  size_t len;  // of the char before folding
+};
+
+// ascii bytes are folded without decoding
+constexpr auto fold_at(std::string_view str, size_t pos) noexcept -> folded_t {
+  char8_t byte = str[pos];
+  if (byte < 0x80) {
+    return {fold_ascii(byte), 1};
+  }
+  return {fold_code(decode_char(str.data() + pos)), thin_decode(byte)};
+}
+
+struct icase_prefix_t {
+  size_t a, b;
+};
+
+// the longest prefixes of `a` and `b` that are equal after folding,
+// their byte lengths may differ (`K` of the Kelvin sign folds to `k`)
+constexpr auto icase_prefix(std::string_view a, std::string_view b) noexcept -> icase_prefix_t {
+  size_t i = 0, j = 0;
+  size_t retry = 0;  // where to try SIMD again: after the char it stopped at if it went far
+  while (i < a.size() && j < b.size()) {
+    if not consteval {
+      if (i >= retry) {
+        auto done = simd::icase_prefix(a.data() + i, b.data() + j,
+                                       std::min(a.size() - i, b.size() - j));
+        i += done;
+        j += done;
+        retry = done >= 16 ? i + 1 : i + simd::BLOCK;
+        if (i == a.size() || j == b.size()) {
+          break;
+        }
+      }
+    }
+    char8_t x = a[i], y = b[j];
+    if ((x | y) < 0x80) {
+      if (fold_ascii(x) != fold_ascii(y)) {
+        break;
+      }
+      i++;
+      j++;
+      continue;
+    }
+    auto folded_x = fold_at(a, i);
+    auto folded_y = fold_at(b, j);
+    if (folded_x.code != folded_y.code) {
+      break;
+    }
+    i += folded_x.len;
+    j += folded_y.len;
+  }
+  return {i, j};
+}
+
+// bytes of the folded string are mixed a word at a time wherever they come from,
+// so the hash does not depend on how much of them SIMD has folded
+class icase_hasher {
+  std::uint64_t _hash = 0;
+  std::uint64_t _word = 0;  // bytes not mixed yet, `_len` of them
+  size_t _len = 0;
+  size_t _total = 0;
+
+  constexpr void mix(std::uint64_t word) noexcept {
+    _hash = std::rotl((_hash ^ word) * 0x9E3779B97F4A7C15, 27);
+  }
+
+ public:
+  constexpr void push(char8_t byte) noexcept {
+    _word |= std::uint64_t(byte) << (8 * _len);
+    _total++;
+    if (++_len == 8) {
+      mix(_word);
+      _word = _len = 0;
+    }
+  }
+
+  constexpr void push(const char* bytes, size_t len) noexcept {
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+      auto word = load_word(bytes + i);
+      if (_len == 0) {
+        mix(word);
+      } else {
+        mix(_word | word << (8 * _len));
+        _word = word >> (64 - 8 * _len);
+      }
+    }
+    _total += i;
+    for (; i < len; i++) {
+      push(char8_t(bytes[i]));
+    }
+  }
+
+  constexpr auto finish() noexcept -> size_t {
+    mix(_word);
+    // the finalizer of MurmurHash3
+    auto hash = _hash ^ _total;
+    hash = (hash ^ hash >> 33) * 0xFF51AFD7ED558CCD;
+    hash = (hash ^ hash >> 33) * 0xC4CEB9FE1A85EC53;
+    return size_t(hash ^ hash >> 33);
+  }
+};
+}  // namespace noexport
+
+/// equal after simple case folding: each char is folded on its own,
+/// so `ß` is not `ss` (that needs full case folding), no string is allocated
+[[nodiscard]] constexpr auto eq_icase(string_view a, string_view b) noexcept -> bool {
+  if (a == b) {
+    return true;
+  }
+  auto [i, j] = noexport::icase_prefix(a, b);
+  return i == a.size() && j == b.size();
+}
+
+/// order of the folded code points, a prefix goes first
+[[nodiscard]] constexpr auto compare_icase(string_view a, string_view b) noexcept
+    -> std::weak_ordering {
+  auto [i, j] = noexport::icase_prefix(a, b);
+  auto a_end = i == a.size(), b_end = j == b.size();
+  if (a_end || b_end) {
+    return b_end <=> a_end;
+  }
+  return noexport::fold_at(a, i).code <=> noexport::fold_at(b, j).code;
+}
+
+[[nodiscard]] constexpr auto starts_with_icase(string_view str, string_view prefix) noexcept
+    -> bool {
+  return noexport::icase_prefix(str, prefix).b == prefix.size();
+}
+
+/// byte offset of the first place at or after `pos` that starts with `needle` ignoring case,
+/// a needle that starts with an ascii char is looked for by its few possible first bytes
+[[nodiscard]] constexpr auto find_icase(string_view str, string_view needle,
+                                        size_t pos = 0) noexcept -> size_t {
+  if (needle.empty()) {
+    return pos <= str.size() ? pos : str.npos;
+  }
+  auto haystack = std::string_view(str);
+  auto first = noexport::fold_at(needle, 0).code;
+  std::array<char, 3> bytes{};
+  if (first < 0x80) {
+    auto other = first - 'a' < 26u ? first ^ noexport::ASCII_CASE_MASK : first;
+    bytes = {char(first), char(other), char(first)};
+    for (char32_t code : noexport::unicode::FOLD_INTO_ASCII) {
+      if (noexport::fold_code(code) == first) {
+        char lead[4];  // of `ſ` or the Kelvin sign
+        noexport::encode_utf8_unchecked(code, lead);
+        bytes[2] = lead[0];
+      }
+    }
+  }
+  for (; pos < str.size(); pos++) {
+    if not consteval {
+      if (first < 0x80) {
+        pos += noexport::simd::find_any_byte(haystack.data() + pos, str.size() - pos, bytes[0],
+                                             bytes[1], bytes[2]);
+        if (pos == str.size()) {
+          break;
+        }
+      }
+    }
+    // the SIMD scan may stop in the middle of a char
+    if (noexport::is_utf8_bound(haystack[pos]) && noexport::fold_at(haystack, pos).code == first &&
+        noexport::icase_prefix(haystack.substr(pos), needle).b == needle.size()) {
+      return pos;
+    }
+  }
+  return str.npos;
+}
+
+/// hash that agrees with `icase_equal`, transparent so lookups take any `string_view`
+struct icase_hash {
+  using is_transparent = void;
+
+  [[nodiscard]] constexpr auto operator()(string_view str) const noexcept -> size_t {
+    auto bytes = std::string_view(str);
+    noexport::icase_hasher hasher;
+    size_t pos = 0, retry = 0;  // as in `icase_prefix`
+    while (pos < bytes.size()) {
+      if not consteval {
+        if (pos >= retry) {
+          std::array<char, noexport::simd::BLOCK> block;
+          auto len = std::min(bytes.size() - pos, block.size());
+          auto done = noexport::simd::convert_ascii(bytes.data() + pos, len, block.data(),
+                                                    noexport::simd::UPPER_HIGH);
+          hasher.push(block.data(), done);
+          pos += done;
+          retry = done >= 16 ? pos + 1 : pos + block.size();
+          continue;
+        }
+      }
+      char8_t byte = bytes[pos];
+      if (byte < 0x80) {
+        hasher.push(noexport::fold_ascii(byte));
+        pos++;
+        continue;
+      }
+      auto [code, len] = noexport::fold_at(bytes, pos);
+      char folded[4];
+      hasher.push(folded, noexport::encode_utf8_unchecked(code, folded));
+      pos += len;
+    }
+    return hasher.finish();
+  }
+};
+
+/// `eq_icase` as a transparent function object
+struct icase_equal {
+  using is_transparent = void;
+
+  [[nodiscard]] constexpr auto operator()(string_view a, string_view b) const noexcept -> bool {
+    return eq_icase(a, b);
+  }
+};
+
+}  // namespace utf8
@@ -0,0 +1,242 @@
+#pragma once
+
+namespace utf8 {
+
+/// a place to wrap a line at: before the byte `pos`,
+/// `mandatory` after a line break char and at the end of the string
+struct line_break {
+  size_t pos;
+  bool mandatory;
+
+  constexpr auto operator==(const line_break&) const noexcept -> bool = default;
+};
+
+namespace noexport {
+constexpr auto LINE_ASCII = ascii_properties<unicode::lb>(unicode::LB);
+
+constexpr auto line_break_class(const char* place) noexcept -> unicode::lb {
+  char8_t byte = *place;
+  return byte < 0x80 ? LINE_ASCII[byte] : unicode::lb(unicode::LB[decode_char(place)]);
+}
+
+// what UAX #14 rules LB11-LB31 say about a pair of classes, LB14-LB17 also look through
+// the spaces before the pair, LB21a and LB30a depend on the chars before it
+enum class line_rule : std::uint8_t { keep, split, regional };
+
+constexpr auto any_of(unicode::lb prop, auto... of) noexcept -> bool {
+  return ((prop == of) || ...);
+}
+
+// LB14-LB17 with `prev` as the char before the spaces
+constexpr auto spaces_kept(unicode::lb prev, unicode::lb next) noexcept -> bool {
+  using enum unicode::lb;
+  return any_of(prev, op, op_wide) || (prev == qu && any_of(next, op, op_wide)) ||
+         (any_of(prev, cl, cp) && next == ns) || (prev == b2 && next == b2);
+}
+
+constexpr auto line_pair_rule(unicode::lb prev, unicode::lb next) noexcept -> line_rule {
+  using enum unicode::lb;
+  auto keep = true;
+  if (next == wj || prev == wj) {
+    // LB11
+  } else if (prev == gl || (next == gl && not any_of(prev, sp, ba, hy))) {
+    // LB12, LB12a
+  } else if (any_of(next, cl, cp, ex, is, sy)) {
+    // LB13
+  } else if (spaces_kept(prev, next)) {
+    // LB14, LB15, LB16, LB17
+  } else if (prev == sp) {
+    keep = false;  // LB18
+  } else if (next == qu || prev == qu) {
+    // LB19
+  } else if (next == cb || prev == cb) {
+    keep = false;  // LB20
+  } else if (any_of(next, ba, hy, ns, in) || prev == bb || (prev == sy && next == hl)) {
+    // LB21, LB21b, LB22
+  } else if ((any_of(prev, al, hl) && any_of(next, nu, pr, po)) ||
+             (any_of(prev, nu, pr, po) && any_of(next, al, hl)) ||
+             (prev == pr && any_of(next, id, id_pictographic, eb, em)) ||
+             (any_of(prev, id, id_pictographic, eb, em) && next == po)) {
+    // LB23, LB23a, LB24
+  } else if ((any_of(prev, cl, cp, nu) && any_of(next, po, pr)) ||
+             (any_of(prev, po, pr) && any_of(next, op, op_wide)) ||
+             (any_of(prev, po, pr, hy, is, nu, sy) && next == nu)) {
+    // LB25
+  } else if ((prev == jl && any_of(next, jl, jv, h2, h3)) ||
+             (any_of(prev, jv, h2) && any_of(next, jv, jt)) ||
+             (any_of(prev, jt, h3) && next == jt) ||
+             (any_of(prev, jl, jv, jt, h2, h3) && next == po) ||
+             (prev == pr && any_of(next, jl, jv, jt, h2, h3))) {
+    // LB26, LB27
+  } else if (any_of(prev, al, hl, is) && any_of(next, al, hl)) {
+    // LB28, LB29
+  } else if ((any_of(prev, al, hl, nu) && next == op) ||
+             (prev == cp && any_of(next, al, hl, nu))) {
+    // LB30, wide brackets are `op_wide`
+  } else if (prev == ri && next == ri) {
+    return line_rule::regional;  // LB30a
+  } else if (any_of(prev, eb, id_pictographic) && next == em) {
+    // LB30b
+  } else {
+    keep = false;  // LB31
+  }
+  return keep ? line_rule::keep : line_rule::split;
+}
+
+constexpr auto LINE_RULES = [] {
+  constexpr size_t values = size_t(unicode::lb::ri) + 1;
+  std::array<std::array<line_rule, values>, values> rules{};
+  for (size_t prev = 0; prev < values; prev++) {
+    for (size_t next = 0; next < values; next++) {
+      rules[prev][next] = line_pair_rule(unicode::lb(prev), unicode::lb(next));
+    }
+  }
+  return rules;
+}();
+
+enum class line_action : std::uint8_t { keep, allow, force };
+
+// fed with the class of every char in turn, the start of the string is taken
+// as a hard line break that is never reported
+class line_breaker {
+  unicode::lb _raw = unicode::lb::bk;     // the char just before, even if LB9 attaches it
+  unicode::lb _prev = unicode::lb::bk;    // the char before after LB9 and LB10
+  unicode::lb _before = unicode::lb::bk;  // the char before `_prev`
+  unicode::lb _spaced = unicode::lb::bk;  // the char before the spaces if `_prev` is one
+  size_t _regional = 0;                   // regional indicators just before
+
+  constexpr auto decide(unicode::lb raw, unicode::lb next) const noexcept -> line_action {
+    using enum unicode::lb;
+    if (any_of(next, bk, cr, lf, nl, sp, zw)) {
+      return line_action::keep;  // LB6, LB7
+    }
+    if (_prev == zw || (_prev == sp && _spaced == zw)) {
+      return line_action::allow;  // LB8
+    }
+    if (raw == zwj) {
+      return line_action::keep;  // LB8a
+    }
+
+    auto rule = LINE_RULES[size_t(_prev)][size_t(next)];
+    if (rule == line_rule::split && _prev == sp && spaces_kept(_spaced, next)) {
+      rule = line_rule::keep;  // LB14-LB17
+    }
+    if (rule == line_rule::split && _before == hl && any_of(_prev, hy, ba) && next != cb) {
+      rule = line_rule::keep;  // LB21a
+    }
+    if (rule == line_rule::regional) {
+      rule = _regional % 2 == 1 ? line_rule::keep : line_rule::split;
+    }
+    return rule == line_rule::keep ? line_action::keep : line_action::allow;
+  }
+
+ public:
+  /// whether a line may or must be broken before a char of the class `next`
+  constexpr auto feed(unicode::lb next) noexcept -> line_action {
+    using enum unicode::lb;
+    auto raw = std::exchange(_raw, next);
+    if (any_of(next, cm, zwj)) {
+      if (not any_of(raw, bk, cr, lf, nl, sp, zw)) {
+        return line_action::keep;  // LB9
+      }
+      next = al;  // LB10
+    }
+
+    auto action = raw == cr && next == lf          ? line_action::keep    // LB5
+                  : any_of(raw, bk, cr, lf, nl) ? line_action::force  // LB4, LB5
+                                                : decide(raw, next);
+
+    if (next == sp && _prev != sp) {
+      _spaced = _prev;
+    }
+    _regional = next == ri ? _regional + 1 : 0;
+    _before = std::exchange(_prev, next);
+    return action;
+  }
+};
+
+class line_break_iter {
+  std::string_view _str;
+  size_t _pos = 0;  // the chars before it are fed to `_breaker`
+  line_break _current{SIZE_MAX, false};
+  line_breaker _breaker;
+
+  // ascii chars take their class from a small table instead of decoding
+  constexpr void next() noexcept {
+    while (_pos < _str.size()) {
+      auto action = _breaker.feed(line_break_class(_str.data() + _pos));
+      if (action != line_action::keep && _pos > 0) {
+        _current = {_pos, action == line_action::force};
+        _pos += thin_decode(_str[_pos]);
+        return;
+      }
+      _pos += thin_decode(_str[_pos]);
+    }
+    // LB3: the end of the string is a mandatory break, unless the string is empty
+    _current = {_current.pos == _str.size() || _str.empty() ? SIZE_MAX : _str.size(), true};
+  }
+
+ public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = line_break;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr line_break_iter() noexcept = default;
+  explicit constexpr line_break_iter(std::string_view str) noexcept : _str(str) {
+    next();
+  }
+
+  constexpr auto operator++() noexcept -> line_break_iter& {
+    next();
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> line_break_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return _current;
+  }
+
+  constexpr auto operator==(const line_break_iter& other) const noexcept -> bool {
+    return _current.pos == other._current.pos;
+  }
+
+  constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool {
+    return _current.pos == SIZE_MAX;
+  }
+};
+}  // namespace noexport
+
+/// line break opportunities of UAX #14 in order, the end of a non-empty string is the last one
+class line_breaks_view : public std::ranges::view_interface<line_breaks_view> {
+  std::string_view _str;
+
+ public:
+  constexpr line_breaks_view() noexcept = default;
+  explicit constexpr line_breaks_view(string_view str) noexcept : _str(str) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    return noexport::line_break_iter(_str);
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return std::default_sentinel;
+  }
+};
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::line_break_opportunities() const noexcept {
+  return line_breaks_view(*this);
+}
+
+}  // namespace utf8
+
+namespace std::ranges {
+template <>
+constexpr bool enable_borrowed_range<utf8::line_breaks_view> = true;
+}  // namespace std::ranges
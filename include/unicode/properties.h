@@ -0,0 +1,3225 @@
+#pragma once
+
+// generated by tools/unicode_tables.py from the Unicode Character Database 14.0.0,
+// do not edit by hand
+namespace utf8::noexport::unicode {
+
+// a byte-sized property of every code in three stages: `code >> 9` selects a row of 32 blocks,
+// a block holds the property of 16 codes, equal rows and blocks are stored once
+struct property_trie {
+  std::span<const std::uint8_t> rows;
+  std::span<const std::uint16_t> blocks;
+  std::span<const std::uint8_t> values;
+
+  [[nodiscard]] constexpr auto operator[](std::uint32_t code) const noexcept -> std::uint8_t {
+    auto block = blocks[rows[code >> 9] * 32 + (code >> 4 & 31)];
+    return values[block * 16 + (code & 15)];
+  }
+};
+
+// Grapheme_Cluster_Break, with Extended_Pictographic as one more value
+enum class gcb : std::uint8_t {
+  other,
+  cr,
+  lf,
+  control,
+  extend,
+  zwj,
+  regional_indicator,
+  prepend,
+  spacing_mark,
+  l,
+  v,
+  t,
+  lv,
+  lvt,
+  extended_pictographic,
+};
+
+constexpr std::uint8_t GCB_ROWS[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+    15, 16, 17, 18, 19, 20, 21, 10, 22, 23, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29,
+    30, 31, 32, 33, 27, 28, 29, 30, 31, 32, 33, 34, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 35, 10, 36,
+    37, 38, 10, 10, 10, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 51, 10, 52, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 53, 10,
+    10, 10, 10, 10, 10, 10, 10, 54, 55, 56, 10, 10, 10, 57, 10, 10,
+    58, 59, 10, 10, 60, 10, 10, 10, 61, 62, 63, 64, 65, 66, 67, 68,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    69, 70, 70, 70, 70, 70, 70, 70, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+constexpr std::uint16_t GCB_BLOCKS[] = {
+    0, 1, 2, 2, 2, 2, 2, 3, 1, 1, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 5, 8, 9, 2, 2, 2,
+    10, 11, 2, 2, 12, 5, 2, 13, 2, 2, 2, 2, 2, 14, 15, 2,
+    16, 17, 2, 5, 18, 2, 2, 2, 2, 2, 19, 13, 2, 2, 12, 20,
+    2, 21, 22, 2, 2, 23, 2, 2, 2, 24, 2, 2, 25, 5, 26, 5,
+    27, 2, 2, 28, 29, 30, 31, 2, 32, 2, 2, 33, 34, 35, 31, 36,
+    37, 2, 2, 38, 39, 17, 2, 40, 37, 2, 2, 38, 41, 2, 31, 25,
+    32, 2, 2, 42, 34, 43, 31, 2, 44, 2, 2, 45, 46, 35, 2, 2,
+    47, 2, 2, 42, 48, 49, 31, 2, 32, 2, 2, 50, 51, 49, 31, 2,
+    52, 2, 2, 53, 54, 35, 31, 2, 32, 2, 2, 2, 55, 56, 2, 57,
+    2, 2, 2, 58, 59, 2, 2, 2, 2, 2, 2, 60, 61, 2, 2, 2,
+    2, 62, 2, 63, 2, 2, 2, 64, 65, 66, 5, 67, 68, 2, 2, 2,
+    2, 2, 69, 70, 2, 71, 13, 72, 73, 74, 2, 2, 2, 2, 2, 2,
+    75, 75, 75, 75, 75, 75, 76, 76, 76, 76, 77, 78, 78, 78, 78, 78,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 79, 2, 80, 2, 31, 2, 31, 2, 2, 2, 81, 82, 20, 2, 2,
+    83, 2, 2, 2, 2, 2, 2, 2, 49, 2, 84, 2, 2, 2, 2, 2,
+    2, 2, 85, 86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 87, 2, 2, 2, 88, 89, 90, 2, 2, 2, 5, 91, 2, 2, 2,
+    92, 2, 2, 93, 94, 2, 12, 95, 96, 2, 97, 2, 2, 2, 98, 52,
+    2, 2, 99, 100, 2, 2, 2, 2, 2, 2, 2, 2, 2, 101, 102, 103,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
+    104, 2, 105, 106, 107, 2, 1, 2, 2, 2, 2, 2, 2, 5, 5, 13,
+    2, 2, 108, 107, 2, 2, 2, 2, 2, 109, 110, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 111, 112, 2, 2, 2, 2, 2, 112, 2, 2, 2, 113, 2, 114, 115,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 108, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 116, 117, 2, 2, 118,
+    119, 120, 121, 121, 121, 121, 121, 121, 122, 121, 121, 121, 121, 121, 121, 121,
+    123, 124, 125, 126, 127, 128, 129, 2, 2, 130, 131, 132, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 133, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    130, 134, 2, 2, 2, 135, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 136, 137,
+    2, 2, 2, 2, 2, 2, 2, 136, 2, 2, 2, 2, 2, 2, 5, 5,
+    2, 2, 25, 138, 2, 2, 2, 2, 2, 139, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 140, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 136, 141, 2, 142, 2, 2, 2, 2, 2, 137,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    143, 2, 144, 2, 2, 2, 2, 2, 145, 2, 2, 146, 147, 2, 5, 148,
+    2, 2, 149, 2, 150, 52, 75, 151, 27, 2, 2, 152, 153, 2, 154, 2,
+    2, 2, 155, 156, 157, 2, 2, 158, 2, 2, 2, 159, 17, 2, 160, 161,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 162, 2,
+    163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164,
+    165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166,
+    165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167,
+    165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163,
+    164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165,
+    166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165,
+    167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165,
+    163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164,
+    165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166,
+    165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167,
+    165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163,
+    164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165,
+    166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165,
+    167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165,
+    163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164,
+    165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 168, 76, 169, 78, 78, 170,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 36, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 142, 2, 2, 2, 2, 2, 171,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 74,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2,
+    2, 2, 2, 2, 2, 2, 2, 172, 2, 2, 2, 2, 2, 2, 2, 2,
+    173, 2, 2, 174, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 49, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 175, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 176, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19, 13, 2, 2, 177, 2, 2, 2, 2, 2, 2, 2,
+    178, 2, 2, 179, 180, 2, 2, 181, 96, 2, 2, 182, 183, 2, 2, 2,
+    184, 2, 185, 186, 187, 2, 2, 188, 96, 2, 2, 189, 190, 2, 2, 2,
+    2, 2, 191, 192, 2, 2, 2, 2, 2, 2, 2, 2, 2, 136, 193, 2,
+    52, 2, 2, 53, 194, 35, 195, 186, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 196, 197, 36, 2, 2, 2, 2, 2, 198, 199, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 136, 200, 13, 201, 2, 2,
+    2, 2, 2, 202, 13, 2, 2, 2, 2, 2, 203, 204, 2, 2, 2, 2,
+    2, 69, 205, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 191, 206, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 207, 208, 2, 2, 2, 2, 2, 2, 2, 2, 209, 210, 2,
+    211, 2, 2, 212, 35, 213, 2, 2, 214, 215, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 216, 217, 2, 2, 2, 2, 2, 218, 219, 220, 2, 2, 2, 2,
+    2, 2, 2, 221, 222, 2, 2, 2, 223, 224, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 225,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 226, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 186,
+    2, 2, 2, 180, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 136, 227, 228, 228, 229, 184, 2, 2, 2, 2, 230, 145,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 231, 232, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 233, 5, 180, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 234, 235, 236, 2, 237, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 238, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 239, 5, 5, 67, 154, 230, 12, 7, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    240, 241, 242, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 180, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2, 2, 243, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 180, 2, 2,
+    2, 2, 2, 2, 244, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    245, 2, 113, 2, 2, 2, 246, 247, 248, 249, 245, 121, 121, 121, 250, 251,
+    252, 253, 113, 254, 114, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 255,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 256, 257, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 2, 2, 2, 121, 121, 121, 121, 121, 121, 121, 121,
+    2, 2, 2, 2, 2, 2, 2, 258, 2, 2, 2, 2, 2, 259, 121, 121,
+    246, 2, 2, 2, 260, 261, 2, 2, 260, 2, 262, 121, 121, 121, 121, 121,
+    246, 121, 121, 263, 119, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 256,
+    1, 1, 5, 5, 5, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+constexpr std::uint8_t GCB_VALUES[] = {
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 3, 14, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+    7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 0, 8, 8,
+    8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8,
+    0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 8,
+    8, 4, 4, 4, 4, 0, 0, 8, 8, 0, 0, 8, 8, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 8,
+    8, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+    4, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 4, 4, 4, 4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4,
+    0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8,
+    4, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 4, 0, 0,
+    4, 8, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 8, 8, 8, 8, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 4,
+    8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8, 4, 4, 0, 0,
+    4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 8,
+    8, 4, 4, 4, 4, 0, 8, 8, 8, 0, 8, 8, 8, 4, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+    8, 8, 4, 4, 4, 0, 4, 0, 8, 8, 8, 8, 8, 8, 8, 4,
+    0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 8, 8,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+    4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 8, 4, 4, 4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0, 0, 0, 4, 4,
+    0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    0, 0, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 8, 8,
+    8, 8, 8, 8, 8, 8, 4, 8, 8, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 3, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 8, 8, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0,
+    8, 8, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 4, 8, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 8,
+    8, 8, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 8, 4, 4, 8, 8, 8, 4, 8, 4,
+    0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4,
+    4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 0,
+    14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 0, 0, 14, 0, 0, 0, 0, 14, 0, 14, 0,
+    0, 0, 0, 14, 14, 14, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0,
+    14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 14, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+    0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 4, 4, 8, 0, 0, 0, 0, 4, 0, 0, 0,
+    8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+    0, 0, 0, 4, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 8,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 8,
+    8, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 8, 8,
+    0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 4, 8, 8, 4, 8, 8, 0, 8, 4, 0, 0,
+    12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    8, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 7, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+    4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 8, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+    8, 0, 7, 7, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 8, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4,
+    4, 4, 8, 8, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    4, 8, 8, 8, 8, 0, 0, 8, 8, 0, 0, 8, 8, 8, 0, 0,
+    0, 0, 8, 8, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4,
+    8, 8, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 8, 8, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 4, 8, 4,
+    4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 4, 4, 4, 4, 0, 0, 8, 8, 8, 8, 4, 4, 8, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 8, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 8, 8,
+    4, 4, 4, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0,
+    4, 8, 8, 8, 8, 8, 0, 8, 8, 0, 0, 4, 4, 8, 4, 7,
+    8, 7, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 4, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 8,
+    4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 4, 8, 7, 4, 4, 4, 4, 0,
+    0, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 8, 4,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 8, 4, 4, 4, 4, 4, 4,
+    4, 8, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0,
+    4, 4, 0, 8, 8, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 8, 4, 4, 4, 0, 0, 0, 8, 4, 4,
+    4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14,
+    14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+    0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0,
+    14, 14, 14, 14, 14, 14, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 4, 4, 4, 4, 4,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14,
+};
+
+constexpr auto GCB = property_trie{GCB_ROWS, GCB_BLOCKS, GCB_VALUES};  // 10944 bytes
+// Word_Break, with Extended_Pictographic as one more value (or two for ALetter ones)
+enum class wb : std::uint8_t {
+  other,
+  cr,
+  lf,
+  newline,
+  extend,
+  zwj,
+  regional_indicator,
+  format,
+  katakana,
+  hebrew_letter,
+  aletter,
+  single_quote,
+  double_quote,
+  mid_num_let,
+  mid_letter,
+  mid_num,
+  numeric,
+  extend_num_let,
+  wseg_space,
+  extended_pictographic,
+  aletter_extended_pictographic,
+};
+
+constexpr std::uint8_t WB_ROWS[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    27, 27, 28, 29, 30, 31, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 32, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    27, 52, 53, 26, 26, 26, 26, 54, 27, 27, 55, 26, 26, 26, 26, 26,
+    26, 26, 27, 56, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 27, 57, 26, 58, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 59, 60, 26, 26, 26, 26, 26, 61, 26,
+    26, 26, 26, 26, 26, 26, 26, 62, 63, 64, 65, 66, 26, 67, 26, 68,
+    69, 70, 26, 71, 72, 26, 26, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    82, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+};
+
+constexpr std::uint16_t WB_BLOCKS[] = {
+    0, 1, 2, 3, 4, 5, 4, 6, 7, 1, 8, 9, 10, 11, 10, 11,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 10, 10,
+    13, 13, 13, 13, 13, 13, 13, 14, 15, 10, 16, 10, 10, 10, 10, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 18, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 4, 10, 19, 10, 10, 20, 21, 13, 22, 23, 24, 25, 26,
+    27, 28, 10, 10, 29, 13, 30, 31, 10, 10, 10, 10, 10, 32, 33, 34,
+    35, 36, 10, 13, 37, 10, 10, 10, 10, 10, 38, 39, 40, 10, 29, 41,
+    10, 42, 43, 1, 10, 44, 6, 10, 45, 46, 10, 10, 47, 13, 48, 13,
+    49, 10, 10, 50, 13, 51, 52, 4, 53, 54, 55, 56, 57, 58, 52, 59,
+    60, 54, 55, 61, 62, 63, 64, 65, 66, 16, 55, 67, 68, 69, 52, 70,
+    71, 54, 55, 67, 72, 73, 52, 74, 75, 76, 77, 78, 79, 80, 64, 1,
+    81, 82, 55, 83, 84, 85, 52, 1, 86, 82, 55, 87, 84, 88, 52, 89,
+    90, 82, 10, 91, 92, 93, 52, 94, 95, 96, 10, 97, 98, 99, 64, 100,
+    1, 1, 1, 101, 102, 103, 1, 1, 1, 1, 1, 104, 105, 103, 1, 1,
+    69, 106, 103, 107, 108, 10, 109, 21, 110, 111, 13, 112, 113, 1, 1, 1,
+    1, 1, 114, 115, 103, 116, 117, 118, 119, 120, 10, 10, 121, 10, 10, 122,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 123, 124, 10, 10, 123, 10, 10, 125, 126, 11, 10, 10,
+    10, 126, 10, 10, 10, 127, 1, 1, 10, 1, 10, 10, 10, 10, 10, 128,
+    4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 129, 10, 130, 6, 10, 10, 10, 10, 131, 132,
+    10, 133, 10, 134, 10, 135, 136, 137, 1, 1, 1, 138, 13, 139, 103, 1,
+    140, 103, 10, 10, 10, 10, 10, 132, 141, 10, 142, 10, 10, 10, 10, 143,
+    10, 144, 145, 145, 64, 1, 1, 1, 1, 1, 1, 1, 1, 103, 1, 1,
+    10, 146, 1, 1, 1, 147, 13, 148, 103, 103, 1, 13, 115, 1, 1, 1,
+    149, 10, 10, 150, 151, 103, 114, 152, 153, 10, 154, 40, 10, 10, 38, 152,
+    10, 10, 150, 155, 156, 40, 10, 157, 132, 10, 10, 158, 1, 159, 160, 161,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 128, 10, 10, 128, 162, 10, 157, 10, 10, 10, 163, 164, 165, 109, 164,
+    166, 167, 168, 169, 170, 171, 172, 173, 1, 109, 1, 1, 1, 13, 13, 174,
+    175, 176, 177, 178, 179, 1, 10, 10, 132, 180, 181, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 182, 183, 1, 1, 1, 1, 1, 183, 1, 1, 1, 184, 1, 185, 186,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 187, 188, 10, 189, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 182, 190, 191, 1, 1, 192,
+    193, 194, 195, 195, 195, 195, 195, 195, 196, 195, 195, 195, 195, 195, 195, 195,
+    197, 198, 199, 200, 201, 202, 203, 1, 1, 204, 205, 206, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 207, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    204, 208, 1, 1, 1, 209, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 210, 211,
+    10, 10, 121, 10, 10, 10, 212, 213, 10, 214, 215, 215, 215, 215, 13, 13,
+    1, 1, 216, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    217, 1, 218, 219, 1, 1, 1, 1, 1, 220, 221, 221, 221, 221, 221, 222,
+    223, 10, 10, 4, 10, 10, 10, 10, 144, 1, 10, 10, 1, 1, 1, 221,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 224, 1, 1, 1, 221, 221, 225,
+    221, 221, 221, 221, 221, 226, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 109, 1, 1, 1, 1, 10, 10, 157,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    109, 10, 227, 1, 10, 10, 228, 229, 10, 230, 10, 10, 10, 10, 10, 231,
+    232, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 233, 1, 234,
+    235, 10, 236, 1, 10, 10, 10, 237, 238, 10, 10, 150, 239, 103, 13, 240,
+    40, 10, 241, 10, 242, 152, 10, 109, 49, 10, 10, 243, 244, 103, 245, 103,
+    10, 10, 246, 247, 248, 103, 1, 249, 1, 1, 1, 250, 251, 1, 29, 252,
+    253, 254, 215, 10, 10, 10, 189, 10, 10, 10, 10, 10, 10, 10, 255, 103,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 237, 10, 256, 10, 10, 257,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    214, 258, 259, 260, 261, 10, 10, 10, 10, 10, 10, 262, 1, 263, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 157, 1, 10, 10, 10, 10, 234, 10, 10, 264, 1, 1, 257,
+    13, 265, 13, 266, 267, 268, 1, 269, 10, 10, 10, 10, 10, 10, 10, 270,
+    271, 3, 4, 5, 4, 6, 272, 221, 221, 273, 10, 144, 274, 275, 1, 276,
+    277, 10, 11, 278, 157, 157, 1, 1, 10, 10, 10, 10, 10, 10, 10, 6,
+    1, 1, 1, 1, 10, 10, 10, 279, 1, 1, 1, 1, 1, 1, 1, 280,
+    1, 1, 1, 1, 1, 1, 1, 1, 10, 109, 10, 10, 10, 69, 174, 1,
+    10, 10, 281, 10, 6, 10, 10, 282, 10, 157, 10, 10, 283, 284, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 157, 103, 10, 10, 283, 10, 257,
+    10, 10, 264, 10, 10, 10, 237, 122, 122, 285, 16, 286, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 214, 10, 143, 264, 1, 17, 10, 10, 287, 1, 1, 1, 1,
+    288, 10, 10, 289, 10, 143, 10, 214, 10, 144, 1, 1, 1, 1, 10, 290,
+    10, 143, 10, 189, 1, 1, 1, 1, 10, 10, 10, 12, 1, 1, 1, 1,
+    291, 292, 10, 293, 1, 1, 10, 109, 10, 109, 1, 1, 108, 10, 294, 1,
+    10, 10, 10, 143, 10, 143, 10, 295, 10, 262, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 132, 1, 1, 1, 10, 10, 10, 295, 10, 10, 10, 295,
+    10, 10, 296, 103, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 297, 262, 1, 1, 1, 1,
+    10, 109, 298, 10, 38, 174, 1, 10, 299, 1, 1, 10, 279, 1, 10, 214,
+    153, 10, 10, 300, 247, 1, 64, 301, 153, 10, 10, 302, 303, 10, 132, 103,
+    153, 10, 242, 304, 305, 10, 10, 306, 153, 10, 10, 243, 307, 308, 1, 1,
+    10, 16, 309, 310, 1, 1, 1, 1, 311, 312, 132, 10, 10, 228, 313, 103,
+    314, 54, 55, 315, 72, 316, 317, 318, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 319, 320, 321, 262, 1, 10, 10, 10, 13, 322, 103, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 228, 323, 174, 324, 1, 1,
+    10, 10, 10, 13, 325, 103, 1, 1, 10, 10, 29, 326, 103, 1, 1, 1,
+    1, 327, 145, 103, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 309, 313, 1, 1, 1, 1, 1, 1, 10, 10, 10, 10, 103, 216,
+    328, 329, 10, 330, 331, 103, 1, 1, 1, 1, 332, 10, 10, 333, 334, 1,
+    335, 10, 10, 336, 337, 338, 10, 10, 47, 339, 1, 10, 10, 10, 10, 132,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    55, 10, 228, 340, 69, 103, 1, 234, 10, 341, 111, 247, 1, 1, 1, 1,
+    342, 10, 10, 343, 344, 103, 345, 10, 346, 347, 103, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 348,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 69, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 189, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 144, 1, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 237, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 10, 10, 10, 10, 69,
+    10, 10, 144, 349, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 214, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 132, 10, 144, 103, 10, 10, 10, 10, 144, 103, 10, 157, 318,
+    10, 10, 10, 247, 237, 103, 263, 350, 10, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 10, 10, 10, 10, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 351, 352, 13, 13, 353, 153, 1, 1, 1, 1, 354, 231,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 355,
+    356, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 357, 1, 1, 1, 358, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 6, 109, 132, 359, 360, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    13, 13, 361, 13, 247, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 362, 363, 364, 1, 365, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 366, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 269, 10, 10, 10, 136, 367, 368, 369, 10, 10, 10,
+    370, 371, 10, 372, 373, 82, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 374, 10, 82, 122, 10, 122,
+    10, 269, 10, 269, 144, 10, 144, 10, 55, 10, 55, 10, 375, 376, 376, 376,
+    13, 13, 13, 377, 13, 13, 112, 245, 378, 114, 21, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 144, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    340, 379, 380, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 109, 381, 382, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 383, 1, 10, 10, 309, 103,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 384, 144,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 279, 247, 1, 1,
+    10, 10, 10, 10, 385, 103, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    369, 10, 386, 387, 388, 389, 390, 391, 392, 257, 393, 257, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    394, 1, 184, 10, 189, 10, 395, 396, 397, 398, 394, 195, 195, 195, 399, 400,
+    401, 402, 184, 403, 185, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 404,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 405, 406, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 1, 1, 1, 195, 195, 195, 195, 195, 195, 195, 195,
+    1, 1, 1, 1, 1, 1, 1, 407, 1, 1, 1, 1, 1, 408, 195, 195,
+    409, 1, 1, 1, 410, 411, 1, 1, 410, 1, 412, 195, 195, 195, 195, 195,
+    409, 195, 195, 413, 193, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 103,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 405,
+    414, 1, 13, 13, 13, 13, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 1,
+};
+
+constexpr std::uint8_t WB_VALUES[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 3, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 0, 12, 0, 0, 0, 0, 11, 0, 0, 0, 0, 15, 0, 13, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 14, 15, 0, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 10, 0, 0, 7, 19, 0,
+    0, 0, 0, 0, 0, 10, 0, 14, 0, 0, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 10, 10, 10, 10, 15, 10,
+    0, 0, 0, 0, 0, 0, 10, 14, 10, 10, 10, 0, 10, 0, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 14,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 15, 10, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9,
+    9, 9, 9, 10, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 7, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 15, 0, 10, 10,
+    4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+    4, 4, 4, 4, 4, 10, 10, 4, 4, 0, 4, 4, 4, 4, 10, 10,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 10, 10, 0, 0, 15, 0, 10, 0, 0, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 10, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 4, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 0,
+    7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4,
+    4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 10, 4, 4,
+    10, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    10, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10,
+    10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 10, 10, 0, 10,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 4, 0,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10,
+    10, 0, 10, 10, 0, 10, 10, 0, 10, 10, 0, 0, 4, 0, 4, 4,
+    4, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 0, 10, 0,
+    0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    4, 4, 10, 10, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10,
+    10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 0,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 4, 4, 4, 4, 4, 4,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 10, 10, 0, 10,
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 10, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10,
+    10, 0, 10, 10, 10, 10, 0, 0, 0, 10, 10, 0, 10, 0, 10, 10,
+    0, 0, 0, 10, 10, 0, 0, 0, 10, 10, 10, 0, 0, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 4, 4,
+    4, 4, 4, 0, 0, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    10, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 0, 10, 10, 10, 0, 0, 10, 0, 0,
+    10, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 10, 10, 0,
+    0, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 10, 0,
+    0, 0, 0, 0, 10, 10, 10, 4, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+    4, 4, 4, 4, 4, 0, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    4, 4, 4, 4, 4, 0, 4, 4, 10, 10, 10, 10, 10, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4,
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4, 4, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 0, 0, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 0,
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 0,
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    18, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    10, 10, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 7, 4,
+    10, 10, 10, 10, 10, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 4, 10, 10,
+    10, 10, 10, 10, 4, 10, 10, 4, 4, 4, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 0, 10, 0, 10,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0,
+    0, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 0, 4, 5, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13, 0, 0, 14, 3, 3, 7, 7, 7, 7, 7, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 17,
+    17, 0, 0, 0, 15, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 0, 0, 0, 0, 10, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0,
+    0, 0, 19, 0, 10, 0, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 20, 0, 0, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 0,
+    0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 0, 0, 0, 0, 19, 19, 19, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 20, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 0,
+    19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 19, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+    0, 19, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 19, 0, 0, 19, 0, 0, 0, 0, 19, 0, 19, 0,
+    0, 0, 0, 19, 19, 19, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+    0, 0, 0, 0, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 0, 0, 0,
+    19, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 4,
+    4, 4, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    18, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+    19, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 10, 10, 19, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 10, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 4, 10, 10, 10, 4, 10, 10, 10, 10, 4, 10, 10, 10, 10,
+    10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0,
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 0, 10, 10, 4,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0,
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0,
+    0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 9, 4, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 0, 9, 0,
+    9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    15, 0, 0, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17,
+    15, 0, 13, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 15, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4,
+    0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10,
+    0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10,
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 0, 10, 0, 0, 10,
+    10, 10, 10, 0, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    10, 10, 10, 10, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4,
+    10, 10, 10, 10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 10, 10, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 7, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+    4, 4, 4, 4, 4, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    0, 0, 0, 0, 10, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 10, 10, 10, 10, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 0, 10, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 4, 4, 10, 4, 4,
+    10, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 10, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 4, 10,
+    4, 4, 4, 4, 10, 10, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 4, 4, 0, 0,
+    4, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 0, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 4, 4, 4, 4, 10,
+    4, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 10, 0, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10,
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 10, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 10, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10,
+    10, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4,
+    4, 4, 4, 4, 4, 4, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0,
+    4, 4, 0, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 4,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4,
+    10, 10, 0, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 0,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 4, 4, 0,
+    7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0,
+    10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 10, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 10, 0,
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0,
+    0, 10, 10, 0, 10, 0, 0, 10, 0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 0, 10, 0, 0, 0, 0,
+    0, 0, 10, 0, 0, 0, 0, 10, 0, 10, 0, 10, 0, 10, 10, 10,
+    0, 10, 10, 0, 10, 0, 0, 10, 0, 10, 0, 10, 0, 10, 0, 10,
+    0, 10, 10, 0, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10, 10, 10,
+    10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10,
+    0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 19, 19, 19, 19,
+    20, 20, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 20, 20,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 19, 0,
+    0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 19, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+    0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 4, 4, 4, 4, 4,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 19, 19, 19, 19,
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr auto WB = property_trie{WB_ROWS, WB_BLOCKS, WB_VALUES};  // 14128 bytes
+// Sentence_Break
+enum class sb : std::uint8_t {
+  other,
+  cr,
+  lf,
+  extend,
+  sep,
+  format,
+  sp,
+  lower,
+  upper,
+  oletter,
+  numeric,
+  aterm,
+  scontinue,
+  sterm,
+  close,
+};
+
+constexpr std::uint8_t SB_ROWS[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 21, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 27, 28, 29, 30, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 31, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    25, 52, 53, 21, 21, 21, 21, 54, 25, 25, 55, 21, 21, 21, 21, 21,
+    21, 21, 25, 56, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 25, 57, 21, 58, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 59, 25, 25, 60, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 61, 62, 63, 21, 21, 21, 21, 64, 21,
+    21, 21, 21, 21, 21, 21, 21, 65, 66, 67, 68, 69, 21, 70, 21, 71,
+    72, 73, 21, 74, 75, 21, 21, 76, 77, 21, 21, 78, 21, 79, 21, 21,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 80, 25, 25, 25, 25, 25, 25, 25, 81, 82, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 83, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 84, 21, 21, 21, 21, 21, 21, 25, 85, 21, 21,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 86, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    87, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+};
+
+constexpr std::uint16_t SB_BLOCKS[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+    15, 15, 15, 16, 17, 15, 15, 18, 19, 20, 21, 22, 23, 24, 15, 25,
+    15, 15, 15, 26, 27, 13, 13, 13, 13, 28, 13, 29, 30, 31, 32, 1,
+    33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 13, 38, 39, 15, 40,
+    11, 11, 11, 13, 13, 13, 15, 15, 41, 15, 15, 15, 42, 15, 15, 15,
+    15, 15, 15, 4, 11, 43, 13, 13, 44, 45, 33, 46, 47, 48, 49, 50,
+    51, 52, 48, 48, 53, 33, 54, 55, 48, 48, 48, 48, 48, 56, 57, 58,
+    59, 60, 48, 33, 61, 48, 48, 48, 48, 48, 62, 63, 64, 48, 53, 65,
+    48, 66, 67, 68, 48, 69, 70, 48, 71, 72, 48, 48, 73, 33, 74, 33,
+    75, 48, 48, 76, 33, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 81, 82, 89, 90, 91, 92, 93, 94, 95, 82, 96, 97, 98, 86, 99,
+    100, 81, 82, 96, 101, 102, 86, 103, 104, 105, 106, 107, 108, 109, 92, 1,
+    110, 111, 82, 112, 113, 114, 86, 1, 115, 111, 82, 116, 113, 117, 86, 118,
+    119, 111, 48, 120, 121, 122, 86, 123, 124, 125, 48, 126, 127, 128, 92, 129,
+    79, 48, 48, 130, 131, 132, 1, 1, 133, 48, 134, 135, 136, 137, 1, 1,
+    98, 138, 132, 139, 140, 48, 141, 45, 142, 143, 33, 144, 145, 1, 1, 1,
+    48, 48, 53, 146, 147, 148, 149, 150, 151, 152, 11, 11, 153, 48, 48, 154,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 155, 156, 48, 48, 155, 48, 48, 157, 158, 159, 48, 48,
+    48, 158, 48, 48, 48, 160, 161, 1, 48, 1, 11, 11, 11, 11, 11, 162,
+    79, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 163, 48, 164, 165, 48, 48, 48, 48, 166, 167,
+    48, 168, 48, 169, 48, 170, 171, 172, 48, 48, 48, 173, 33, 174, 132, 1,
+    175, 132, 48, 48, 48, 48, 48, 167, 176, 48, 177, 48, 48, 48, 48, 178,
+    48, 179, 180, 180, 181, 48, 182, 183, 48, 48, 184, 48, 185, 132, 1, 1,
+    48, 186, 48, 48, 48, 187, 33, 188, 132, 132, 189, 33, 190, 1, 1, 1,
+    191, 48, 48, 173, 192, 193, 194, 195, 196, 48, 197, 64, 48, 48, 62, 198,
+    48, 48, 173, 199, 200, 64, 48, 201, 202, 48, 48, 203, 1, 204, 205, 206,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 33, 33, 33, 33,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 207, 15, 15, 15, 15, 15, 15,
+    208, 209, 208, 208, 209, 210, 208, 211, 208, 208, 208, 212, 213, 214, 215, 213,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 1, 1, 1, 33, 33, 226,
+    227, 228, 229, 230, 231, 1, 11, 13, 232, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    233, 1, 234, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 235, 11, 13, 236, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 237, 238, 239, 1, 1, 1, 1, 240, 1, 241, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 242, 243, 1, 1, 1, 233, 1, 244,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    11, 11, 11, 13, 13, 13, 245, 246, 15, 15, 15, 15, 15, 15, 247, 248,
+    13, 13, 249, 48, 48, 48, 250, 251, 48, 252, 253, 253, 253, 253, 33, 33,
+    254, 244, 255, 256, 257, 258, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    259, 260, 261, 262, 79, 48, 48, 48, 48, 263, 79, 48, 48, 48, 48, 154,
+    264, 48, 48, 79, 48, 48, 48, 48, 179, 1, 48, 48, 1, 1, 1, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 48, 48, 141, 1, 1, 1, 1, 48, 48, 265,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    266, 48, 267, 1, 15, 15, 268, 269, 15, 270, 48, 48, 48, 48, 48, 271,
+    1, 272, 273, 274, 15, 15, 15, 275, 276, 277, 278, 279, 280, 281, 1, 282,
+    283, 48, 284, 1, 48, 48, 48, 285, 286, 48, 48, 173, 287, 132, 33, 288,
+    64, 48, 289, 48, 290, 198, 48, 141, 75, 48, 48, 291, 292, 132, 293, 294,
+    48, 48, 295, 296, 297, 298, 48, 299, 48, 48, 48, 300, 301, 302, 53, 303,
+    304, 305, 253, 13, 13, 306, 307, 13, 13, 13, 13, 13, 48, 48, 308, 132,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 48, 309, 48, 48, 184,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 182, 48, 48, 48, 48, 48, 48, 185, 1, 1,
+    310, 311, 82, 312, 313, 48, 48, 48, 48, 48, 48, 31, 1, 314, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 315, 1, 48, 48, 48, 48, 316, 48, 48, 317, 1, 1, 184,
+    33, 318, 33, 319, 320, 321, 322, 323, 48, 48, 48, 48, 48, 48, 48, 324,
+    325, 3, 4, 5, 6, 326, 327, 48, 48, 328, 48, 179, 329, 330, 1, 331,
+    332, 48, 159, 333, 182, 182, 1, 1, 48, 48, 48, 48, 48, 48, 48, 70,
+    1, 1, 1, 1, 48, 48, 48, 183, 1, 1, 1, 1, 1, 1, 1, 334,
+    1, 1, 1, 1, 1, 1, 1, 1, 48, 141, 48, 48, 48, 98, 226, 1,
+    48, 48, 335, 48, 70, 48, 48, 336, 48, 182, 48, 48, 337, 338, 1, 1,
+    11, 11, 339, 13, 13, 48, 48, 48, 48, 182, 132, 11, 11, 340, 13, 341,
+    48, 48, 317, 48, 48, 48, 50, 342, 342, 343, 344, 345, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 252, 48, 178, 317, 1, 346, 13, 13, 347, 1, 1, 1, 1,
+    348, 48, 48, 349, 48, 178, 48, 252, 48, 179, 1, 1, 1, 1, 48, 350,
+    48, 178, 48, 185, 1, 1, 1, 1, 48, 48, 48, 351, 1, 1, 1, 1,
+    352, 353, 48, 354, 1, 355, 48, 141, 48, 141, 1, 1, 140, 48, 356, 1,
+    48, 48, 48, 178, 48, 178, 48, 357, 48, 31, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 167, 1, 1, 1, 11, 11, 11, 358, 13, 13, 13, 359,
+    48, 48, 360, 132, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 48, 48, 361, 31, 1, 1, 1, 1,
+    48, 141, 362, 48, 62, 363, 1, 48, 364, 1, 1, 48, 183, 1, 48, 252,
+    196, 48, 48, 365, 366, 1, 92, 367, 196, 48, 48, 368, 369, 48, 167, 132,
+    196, 48, 290, 370, 371, 48, 48, 372, 196, 48, 48, 291, 373, 374, 1, 1,
+    48, 95, 375, 376, 1, 1, 1, 1, 377, 378, 379, 48, 48, 380, 381, 132,
+    382, 81, 82, 383, 101, 384, 385, 386, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 387, 388, 389, 31, 1, 48, 48, 48, 33, 390, 132, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 48, 48, 380, 391, 392, 393, 1, 1,
+    48, 48, 48, 33, 394, 132, 1, 1, 48, 48, 53, 395, 132, 1, 1, 1,
+    48, 160, 180, 396, 252, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 375, 381, 1, 1, 1, 1, 1, 1, 11, 11, 13, 13, 132, 397,
+    398, 399, 48, 400, 401, 132, 1, 1, 1, 1, 402, 48, 48, 403, 404, 1,
+    405, 48, 48, 406, 407, 408, 48, 48, 73, 409, 1, 48, 48, 48, 48, 167,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    82, 48, 380, 410, 411, 132, 1, 316, 48, 412, 143, 296, 1, 1, 1, 1,
+    413, 48, 48, 414, 415, 132, 416, 48, 417, 418, 132, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 48, 419,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 98, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 185, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 179, 1, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 50, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 48, 48, 48, 48, 48, 48, 98,
+    48, 48, 179, 420, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 252, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 167, 48, 179, 421, 48, 48, 48, 48, 179, 132, 48, 182, 422,
+    48, 48, 48, 366, 423, 132, 314, 424, 48, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 11, 11, 13, 13, 1, 425, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 426, 427, 33, 33, 428, 196, 1, 1, 1, 1, 429, 430,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 317,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 178, 1, 1,
+    167, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 431,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 357, 1, 1, 357, 432, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 184,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 70, 141, 167, 433, 434, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    33, 33, 435, 33, 296, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 436, 437, 438, 1, 439, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 440, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    11, 441, 13, 442, 443, 444, 208, 11, 445, 446, 447, 448, 449, 11, 441, 13,
+    450, 451, 13, 452, 453, 454, 455, 11, 456, 13, 11, 441, 13, 442, 443, 13,
+    208, 11, 445, 455, 11, 456, 13, 11, 441, 13, 457, 11, 454, 306, 458, 459,
+    13, 460, 11, 461, 462, 463, 464, 13, 465, 11, 466, 13, 467, 468, 468, 468,
+    33, 33, 33, 469, 33, 33, 144, 470, 471, 194, 45, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    472, 462, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    410, 473, 474, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 141, 475, 476, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 48, 477, 1, 48, 48, 375, 132,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 478, 179,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 183, 296, 1, 1,
+    11, 11, 445, 13, 479, 132, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    480, 48, 481, 482, 483, 484, 485, 486, 487, 184, 488, 184, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 11, 489, 11, 489, 11, 489, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 490, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 132,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 1, 1,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 167, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 182, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 31, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 98, 1,
+    48, 182, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 70, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    491, 1, 33, 33, 33, 33, 33, 33, 1, 1, 1, 1, 1, 1, 1, 1,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 1,
+};
+
+constexpr std::uint8_t SB_VALUES[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 2, 6, 6, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 13, 14, 0, 0, 0, 0, 14, 14, 14, 0, 0, 12, 12, 11, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 0, 0, 0, 0, 13,
+    0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14, 0, 14, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 14, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 14, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 7, 14, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    8, 7, 8, 7, 8, 7, 8, 7, 7, 8, 7, 8, 7, 8, 7, 8,
+    7, 8, 7, 8, 7, 8, 7, 8, 7, 7, 8, 7, 8, 7, 8, 7,
+    8, 7, 8, 7, 8, 7, 8, 7, 8, 8, 7, 8, 7, 8, 7, 7,
+    7, 8, 8, 7, 8, 7, 8, 8, 7, 8, 8, 8, 7, 7, 8, 8,
+    8, 8, 7, 8, 8, 7, 8, 8, 8, 7, 7, 7, 8, 8, 7, 8,
+    8, 7, 8, 7, 8, 7, 8, 8, 7, 8, 7, 7, 8, 7, 8, 8,
+    7, 8, 8, 8, 7, 8, 7, 8, 8, 7, 7, 9, 8, 7, 7, 7,
+    9, 9, 9, 9, 8, 8, 7, 8, 8, 7, 8, 8, 7, 8, 7, 8,
+    7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 7, 8, 7,
+    7, 8, 8, 7, 8, 7, 8, 8, 8, 7, 8, 7, 8, 7, 8, 7,
+    8, 7, 8, 7, 7, 7, 7, 7, 7, 7, 8, 8, 7, 8, 8, 7,
+    7, 8, 7, 8, 8, 8, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    7, 7, 7, 7, 9, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 9, 9, 9, 9, 9,
+    7, 7, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 9, 0, 9, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    8, 7, 8, 7, 9, 0, 8, 7, 0, 0, 7, 7, 7, 7, 0, 8,
+    0, 0, 0, 0, 0, 0, 8, 0, 8, 8, 8, 0, 8, 0, 8, 8,
+    7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8,
+    7, 7, 8, 8, 8, 7, 7, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    7, 7, 7, 7, 8, 7, 0, 8, 7, 8, 8, 7, 7, 8, 8, 8,
+    8, 7, 0, 3, 3, 3, 3, 3, 3, 3, 8, 7, 8, 7, 8, 7,
+    8, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 7,
+    8, 8, 8, 8, 8, 8, 8, 0, 0, 9, 0, 0, 0, 12, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 13, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3,
+    0, 3, 3, 0, 3, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9,
+    9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 12, 12, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 5, 13, 13, 13,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 9, 9,
+    3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 13, 9, 3, 3, 3, 3, 3, 3, 3, 5, 0, 3,
+    3, 3, 3, 3, 3, 9, 9, 3, 3, 0, 3, 3, 3, 3, 9, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 0, 0, 9,
+    13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    9, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 9, 9,
+    3, 3, 3, 3, 9, 9, 0, 0, 12, 13, 9, 0, 0, 3, 0, 0,
+    9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 9, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 9, 3, 3, 3, 9, 3, 3, 3, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 13, 0, 0, 0, 13, 13, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3,
+    3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 9, 3, 3,
+    9, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 3, 3, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9,
+    9, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9,
+    9, 0, 9, 0, 0, 0, 9, 9, 9, 9, 0, 0, 3, 9, 3, 3,
+    3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 9, 9, 0, 9,
+    9, 9, 3, 3, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 3, 0,
+    0, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9,
+    9, 0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 0, 3, 0, 3, 3,
+    3, 3, 3, 0, 0, 0, 0, 3, 3, 0, 0, 3, 3, 3, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 0, 9, 0,
+    0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    3, 3, 9, 9, 9, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9,
+    9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 0, 0, 3, 9, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 3, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9,
+    3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 9, 9, 0, 9,
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 9, 0, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 9,
+    9, 0, 9, 9, 9, 9, 0, 0, 0, 9, 9, 0, 9, 0, 9, 9,
+    0, 0, 0, 9, 9, 0, 0, 0, 9, 9, 9, 0, 0, 0, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 3, 3,
+    3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9,
+    9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 3, 9, 3, 3,
+    3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 3, 3, 0, 9, 9, 9, 0, 0, 9, 0, 0,
+    9, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9,
+    9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 0, 0, 3, 9, 3, 3,
+    0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 9, 9, 0,
+    0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 9, 3, 3,
+    3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 9, 0,
+    0, 0, 0, 0, 9, 9, 9, 3, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9,
+    0, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 9, 9, 9, 9, 9,
+    9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 3, 0, 0, 0, 0, 3,
+    3, 3, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 3, 9, 9, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    0, 9, 9, 0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9,
+    9, 9, 9, 9, 0, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 3, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 0, 0,
+    9, 9, 9, 9, 9, 0, 9, 0, 3, 3, 3, 3, 3, 3, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 9, 9, 9, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 14, 14, 14, 14, 3, 3,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+    3, 3, 3, 3, 3, 0, 3, 3, 9, 9, 9, 9, 9, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 9, 9, 9, 9, 3, 3,
+    3, 9, 3, 3, 3, 9, 9, 3, 3, 3, 3, 3, 3, 3, 9, 9,
+    9, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 3,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 3, 3, 0, 0,
+    8, 8, 8, 8, 8, 8, 0, 8, 0, 0, 0, 0, 0, 8, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 0, 9, 9, 9, 9, 0, 0,
+    9, 0, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 9, 9, 0,
+    9, 0, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 3, 3, 3,
+    0, 0, 13, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 0, 0, 7, 7, 7, 7, 7, 7, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 13, 9,
+    6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 14, 14, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    9, 9, 3, 3, 3, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9,
+    9, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 0, 9, 0, 0, 0, 0, 9, 3, 0, 0,
+    0, 0, 12, 13, 0, 0, 0, 0, 12, 13, 0, 3, 3, 3, 5, 3,
+    9, 9, 9, 9, 9, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 9, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+    9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 9, 13, 13, 13, 13, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 0, 0, 13, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 0,
+    3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 13, 13, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 13, 13,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9,
+    3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 3, 9, 9,
+    9, 9, 9, 9, 3, 9, 9, 3, 3, 3, 9, 0, 0, 0, 0, 0,
+    8, 7, 8, 7, 8, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+    7, 7, 7, 7, 7, 7, 0, 0, 8, 8, 8, 8, 8, 8, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 0, 8, 0, 8, 0, 8, 0, 8,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0,
+    7, 7, 7, 7, 7, 0, 7, 7, 8, 8, 8, 8, 8, 0, 7, 0,
+    0, 0, 7, 7, 7, 0, 7, 7, 8, 8, 8, 8, 8, 0, 0, 0,
+    7, 7, 7, 7, 0, 0, 7, 7, 8, 8, 8, 8, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 3, 3, 5, 5,
+    0, 0, 0, 12, 12, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 0, 11, 0, 0, 0, 4, 4, 5, 5, 5, 5, 5, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 13, 13, 0, 0,
+    0, 0, 0, 0, 0, 14, 14, 13, 13, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 0, 0, 0, 0, 8, 0, 0, 7, 8, 8, 8, 7, 7,
+    8, 8, 8, 7, 0, 8, 0, 0, 0, 8, 8, 8, 8, 8, 0, 0,
+    0, 0, 0, 0, 8, 0, 8, 0, 8, 0, 8, 8, 8, 8, 0, 7,
+    8, 8, 8, 8, 7, 9, 9, 9, 9, 7, 0, 0, 7, 7, 8, 8,
+    0, 0, 0, 0, 0, 8, 7, 7, 7, 7, 0, 0, 0, 0, 7, 0,
+    9, 9, 9, 8, 7, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14,
+    14, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0,
+    8, 7, 8, 8, 8, 7, 7, 8, 7, 8, 7, 8, 7, 8, 8, 8,
+    8, 7, 8, 7, 7, 8, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8,
+    8, 7, 8, 7, 7, 0, 0, 0, 0, 0, 0, 8, 7, 8, 7, 3,
+    3, 3, 8, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 0, 7, 0, 0, 0, 0, 0, 7, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 0,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 13, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0,
+    6, 12, 13, 0, 0, 9, 9, 9, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14,
+    0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3,
+    0, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 3, 3, 0, 0, 9, 9, 9,
+    0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 13,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 13, 13,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 0, 0, 0, 0,
+    8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 9, 3,
+    3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 9,
+    8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 7, 7, 3, 3,
+    3, 3, 0, 13, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 0, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    7, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8, 7, 8, 8, 7,
+    8, 7, 8, 7, 8, 7, 8, 7, 9, 0, 0, 8, 7, 8, 7, 9,
+    8, 7, 8, 7, 7, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 8, 8, 8, 8, 7,
+    8, 8, 8, 8, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+    8, 7, 8, 7, 8, 8, 8, 8, 7, 8, 7, 0, 0, 0, 0, 0,
+    8, 7, 0, 7, 0, 7, 8, 7, 8, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 9, 8, 7, 9, 7, 7, 7, 9, 9, 9, 9, 9,
+    9, 9, 3, 9, 9, 9, 3, 9, 9, 9, 9, 3, 9, 9, 9, 9,
+    9, 9, 9, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, 0, 0, 0,
+    9, 9, 9, 9, 0, 0, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13,
+    3, 3, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 0, 9, 9, 3,
+    9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 0, 13,
+    9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 0, 9,
+    9, 9, 9, 9, 9, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 9, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 3, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 13, 13, 13,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 3, 3, 3, 9, 9,
+    3, 9, 3, 3, 3, 9, 9, 3, 3, 9, 9, 9, 9, 9, 3, 3,
+    9, 3, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 0, 0,
+    13, 13, 9, 9, 9, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 9, 0,
+    0, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 13, 3, 3, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9, 9, 9, 9, 9,
+    7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 9, 3, 9,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 0, 9, 0,
+    9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 14, 14,
+    0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    12, 12, 0, 12, 0, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 12, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0,
+    12, 12, 11, 0, 0, 12, 13, 13, 12, 14, 14, 14, 14, 14, 14, 0,
+    0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 5,
+    0, 13, 0, 0, 0, 0, 0, 0, 14, 14, 0, 0, 12, 12, 11, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 14, 0, 14, 0, 14,
+    14, 13, 14, 14, 12, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3,
+    0, 0, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 9,
+    0, 0, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 8, 8, 8, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8,
+    8, 8, 8, 0, 8, 8, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 0, 0, 0,
+    7, 9, 9, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 0, 0, 9, 0, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 0, 9, 9, 0, 0, 0, 9, 0, 0, 9,
+    9, 9, 9, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 9, 9,
+    9, 3, 3, 3, 0, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 3,
+    9, 9, 9, 9, 0, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 0, 0, 3, 3, 3, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0,
+    9, 9, 3, 3, 3, 3, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+    3, 9, 9, 3, 3, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 5, 13, 13,
+    13, 13, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    3, 3, 3, 3, 3, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 13, 13, 13, 9, 3, 3, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 3, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 9, 9, 9, 9, 13, 13, 0, 0, 3, 3, 3, 3, 13, 3, 3,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 0, 9, 0, 13, 13,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 13, 13, 0, 13, 13, 0, 3, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 0, 9, 9, 9, 9, 0, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 13, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9,
+    9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 0, 3, 3, 9, 3, 3,
+    9, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 9, 9, 9,
+    9, 9, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+    3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 13, 13, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 3, 9,
+    3, 3, 3, 3, 9, 9, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 13, 13, 0, 0, 0, 0, 0, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 9, 9, 9, 9, 3, 3, 0, 0,
+    3, 13, 13, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 9, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 13, 13, 13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    9, 9, 9, 9, 9, 9, 9, 0, 0, 9, 0, 0, 9, 9, 9, 9,
+    9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    3, 3, 3, 3, 3, 3, 0, 3, 3, 0, 0, 3, 3, 3, 3, 9,
+    3, 9, 3, 3, 13, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 9,
+    9, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3,
+    3, 9, 0, 9, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9,
+    9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 9, 3, 3, 3, 3, 0,
+    0, 0, 13, 13, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 13, 13, 9, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    9, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9,
+    9, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 0, 3, 3, 0, 3,
+    3, 3, 3, 3, 3, 3, 9, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 0,
+    3, 3, 0, 3, 3, 3, 3, 3, 9, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 3, 3, 3, 3, 13, 13, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 13, 13,
+    3, 3, 3, 3, 3, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 9, 9, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 3,
+    9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3,
+    9, 9, 0, 9, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 0,
+    0, 0, 0, 0, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 3, 3, 13,
+    5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 3, 3, 3,
+    3, 3, 3, 5, 5, 5, 5, 5, 5, 5, 5, 3, 3, 3, 3, 3,
+    3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0,
+    0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7,
+    7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    8, 8, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 0, 8, 8,
+    0, 0, 8, 0, 0, 8, 8, 0, 0, 8, 8, 8, 8, 0, 8, 8,
+    8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 0, 7, 0, 7, 7, 7,
+    7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 8, 8, 0, 8, 8, 8, 8, 0, 0, 8, 8, 8,
+    8, 8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 0, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 0, 8, 8, 8, 8, 0,
+    8, 8, 8, 8, 8, 0, 8, 0, 0, 0, 8, 8, 8, 8, 8, 8,
+    8, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8,
+    7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0,
+    7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 8, 7, 0, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 7, 7, 7, 7, 7,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3,
+    3, 3, 0, 3, 3, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 9, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 0,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 0, 9, 9, 0,
+    7, 7, 7, 7, 3, 3, 3, 3, 3, 3, 3, 9, 0, 0, 0, 0,
+    9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 9, 9, 0, 9, 0, 0, 9, 0, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 0, 9, 9, 9, 9, 0, 9, 0, 9, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 9, 0, 9, 0, 9, 0, 9, 9, 9,
+    0, 9, 9, 0, 9, 0, 0, 9, 0, 9, 0, 9, 0, 9, 0, 9,
+    0, 9, 9, 0, 9, 0, 0, 9, 9, 9, 9, 0, 9, 9, 9, 9,
+    9, 9, 9, 0, 9, 9, 9, 9, 0, 9, 9, 9, 9, 0, 9, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9,
+    0, 9, 9, 9, 0, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr auto SB = property_trie{SB_ROWS, SB_BLOCKS, SB_VALUES};  // 15680 bytes
+// Line_Break after LB1, with wide OP and unassigned pictographic ID split out
+enum class lb : std::uint8_t {
+  bk,
+  cr,
+  lf,
+  nl,
+  sp,
+  zw,
+  zwj,
+  cm,
+  wj,
+  gl,
+  ba,
+  hy,
+  bb,
+  b2,
+  cb,
+  cl,
+  cp,
+  op,
+  op_wide,
+  qu,
+  ex,
+  is,
+  sy,
+  ns,
+  in,
+  nu,
+  pr,
+  po,
+  al,
+  hl,
+  id,
+  id_pictographic,
+  eb,
+  em,
+  h2,
+  h3,
+  jl,
+  jv,
+  jt,
+  ri,
+};
+
+constexpr std::uint8_t LB_ROWS[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 18, 21, 22, 23, 24, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    27, 25, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 32, 33, 34,
+    35, 36, 37, 38, 32, 33, 34, 35, 36, 37, 38, 39, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 40, 41, 42, 43,
+    44, 45, 46, 18, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    18, 18, 59, 18, 18, 18, 18, 18, 18, 60, 61, 18, 18, 18, 18, 18,
+    18, 18, 62, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 63, 18, 64, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 65, 25, 66, 67, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 68, 69, 18, 18, 18, 18, 70, 18,
+    18, 18, 18, 18, 18, 18, 18, 71, 72, 73, 18, 74, 18, 75, 18, 18,
+    76, 77, 18, 18, 78, 18, 79, 18, 80, 81, 82, 83, 84, 85, 86, 87,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 88,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 88,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    89, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+};
+
+constexpr std::uint16_t LB_BLOCKS[] = {
+    0, 1, 2, 3, 4, 5, 4, 6, 7, 1, 8, 9, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 11, 4, 4,
+    1, 1, 1, 1, 12, 13, 14, 15, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 16, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 17, 18, 1, 19, 20, 21, 22, 23,
+    24, 25, 4, 4, 26, 1, 27, 28, 4, 4, 4, 4, 4, 29, 30, 31,
+    4, 32, 4, 1, 33, 4, 4, 4, 4, 4, 34, 28, 31, 4, 26, 35,
+    4, 36, 37, 4, 4, 38, 4, 4, 4, 39, 4, 4, 40, 1, 41, 1,
+    42, 4, 4, 43, 1, 44, 45, 4, 46, 4, 4, 47, 48, 49, 50, 51,
+    46, 4, 4, 47, 52, 32, 53, 54, 46, 4, 4, 47, 55, 4, 50, 56,
+    46, 4, 4, 47, 48, 57, 50, 4, 58, 4, 4, 59, 60, 49, 53, 61,
+    62, 4, 4, 47, 63, 64, 50, 65, 66, 4, 4, 47, 63, 64, 50, 4,
+    42, 4, 4, 67, 63, 49, 50, 68, 46, 4, 4, 4, 69, 70, 53, 71,
+    4, 4, 4, 72, 73, 74, 4, 4, 4, 4, 4, 75, 76, 31, 4, 4,
+    77, 78, 31, 79, 4, 4, 4, 80, 81, 82, 1, 83, 84, 85, 4, 4,
+    4, 4, 26, 86, 74, 87, 88, 89, 90, 91, 4, 4, 4, 4, 4, 4,
+    92, 92, 92, 92, 92, 92, 93, 93, 93, 93, 94, 95, 95, 95, 95, 95,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 96, 97, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    98, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 98, 99, 4, 4, 4, 4, 100, 4,
+    4, 101, 4, 102, 4, 71, 4, 71, 4, 4, 4, 103, 1, 104, 31, 4,
+    105, 31, 4, 4, 4, 4, 4, 4, 64, 4, 106, 4, 4, 4, 4, 4,
+    4, 4, 107, 107, 108, 4, 4, 4, 4, 4, 4, 4, 4, 31, 4, 4,
+    4, 109, 4, 4, 4, 110, 1, 111, 31, 31, 4, 1, 86, 4, 4, 4,
+    62, 4, 4, 103, 62, 112, 113, 114, 115, 4, 116, 31, 4, 4, 34, 42,
+    4, 4, 103, 117, 31, 31, 4, 118, 4, 4, 4, 4, 4, 119, 120, 121,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 1, 1,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 122,
+    123, 124, 125, 126, 127, 128, 129, 130, 130, 4, 131, 132, 133, 1, 1, 28,
+    134, 135, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 136, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 137, 4,
+    138, 139, 140, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 141,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    141, 142, 4, 143, 4, 4, 144, 145, 4, 4, 4, 146, 147, 148, 149, 150,
+    151, 4, 4, 4, 4, 152, 153, 154, 4, 4, 4, 4, 155, 4, 156, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 157, 158, 4, 4, 4, 138, 4, 159,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 160, 161,
+    4, 4, 4, 4, 4, 4, 4, 162, 4, 4, 4, 4, 4, 4, 1, 1,
+    163, 164, 165, 166, 167, 168, 4, 4, 169, 170, 169, 169, 169, 169, 169, 141,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 171, 4, 172,
+    173, 174, 175, 176, 177, 169, 178, 169, 179, 180, 181, 169, 178, 169, 179, 182,
+    183, 169, 169, 184, 169, 169, 169, 169, 185, 169, 169, 169, 169, 169, 141, 186,
+    169, 185, 169, 169, 187, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 4, 4, 4, 4,
+    169, 188, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 189, 169, 169, 169, 190, 4, 4, 118,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    191, 4, 31, 4, 4, 4, 160, 192, 4, 59, 4, 4, 4, 4, 4, 193,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    194, 4, 195, 196, 4, 4, 4, 197, 198, 4, 4, 103, 199, 31, 1, 200,
+    31, 4, 201, 4, 202, 42, 92, 203, 42, 4, 4, 204, 205, 31, 206, 31,
+    4, 4, 207, 208, 209, 210, 4, 211, 4, 4, 4, 212, 32, 4, 26, 213,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 214, 31,
+    215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216,
+    217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218,
+    217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219,
+    217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215,
+    216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217,
+    218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217,
+    219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217,
+    215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216,
+    217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218,
+    217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219,
+    217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215,
+    216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217,
+    218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217,
+    219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217,
+    215, 216, 217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 219, 217, 215, 216,
+    217, 218, 217, 219, 217, 215, 216, 217, 218, 217, 220, 93, 221, 95, 95, 222,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    4, 223, 224, 225, 226, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 227, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 228,
+    1, 229, 1, 230, 231, 232, 233, 4, 4, 4, 4, 4, 4, 4, 4, 234,
+    235, 236, 169, 237, 169, 238, 239, 240, 169, 241, 169, 185, 242, 243, 244, 245,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    246, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 247,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 28, 4,
+    4, 4, 4, 4, 4, 4, 4, 248, 4, 249, 4, 4, 4, 98, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 31, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 250, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 249, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    251, 4, 4, 252, 4, 253, 4, 4, 4, 4, 4, 4, 4, 4, 64, 254,
+    4, 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 256, 31, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 257, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 34, 28, 4, 4, 101, 4, 4, 4, 4, 4, 4, 4,
+    115, 4, 4, 39, 258, 4, 53, 259, 115, 4, 4, 260, 261, 4, 4, 31,
+    115, 4, 202, 262, 263, 4, 4, 264, 115, 4, 4, 204, 265, 266, 4, 4,
+    4, 4, 267, 268, 4, 4, 4, 4, 4, 4, 269, 4, 4, 160, 33, 31,
+    42, 4, 4, 67, 48, 49, 270, 62, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 271, 272, 273, 4, 4, 4, 4, 4, 1, 42, 31, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 160, 274, 275, 276, 4, 4,
+    4, 4, 4, 1, 277, 31, 278, 4, 4, 4, 26, 279, 31, 4, 4, 4,
+    4, 96, 107, 280, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 267, 33, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 31, 4,
+    4, 4, 4, 281, 282, 31, 4, 4, 4, 4, 4, 4, 4, 283, 284, 4,
+    285, 4, 4, 286, 287, 288, 4, 4, 40, 289, 290, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 160, 291, 292, 31, 4, 293, 4, 294, 82, 208, 4, 4, 4, 4,
+    4, 4, 4, 295, 296, 31, 4, 4, 297, 298, 31, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 299,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 300, 301, 249,
+    4, 4, 4, 4, 4, 4, 4, 302, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 303, 4, 4, 304, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 305, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 306, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 307, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 308, 4, 4, 4, 4, 4, 31, 4, 4, 309,
+    4, 4, 4, 310, 311, 31, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 312, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 160, 18, 1, 1, 313, 115, 4, 4, 4, 4, 314, 198,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 187,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    315, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 316, 4, 4, 317, 318, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 172,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 319, 42, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    1, 1, 320, 1, 208, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 321, 1, 322, 4, 323, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 324, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 325, 326, 326, 326,
+    1, 1, 1, 327, 1, 1, 328, 206, 329, 26, 18, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    291, 330, 331, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 208, 31, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 332, 4, 4, 4, 267, 333,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 208, 4, 4,
+    4, 4, 4, 4, 334, 335, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 228, 301, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    169, 169, 336, 169, 169, 169, 169, 169, 169, 337, 338, 339, 339, 339, 169, 340,
+    146, 4, 4, 4, 4, 4, 146, 4, 4, 4, 341, 342, 342, 342, 343, 344,
+    345, 169, 169, 336, 346, 347, 340, 342, 342, 342, 342, 342, 342, 342, 342, 342,
+    169, 169, 169, 169, 169, 169, 169, 169, 348, 349, 169, 350, 351, 169, 169, 352,
+    169, 169, 169, 169, 353, 354, 355, 356, 357, 358, 359, 360, 169, 169, 169, 169,
+    361, 190, 183, 362, 363, 169, 169, 364, 169, 365, 169, 169, 169, 366, 169, 367,
+    169, 169, 169, 169, 368, 4, 4, 369, 169, 169, 370, 371, 372, 373, 374, 374,
+    4, 4, 4, 4, 4, 4, 4, 375, 4, 4, 4, 4, 4, 376, 336, 377,
+    378, 4, 4, 4, 379, 380, 4, 4, 379, 4, 381, 347, 342, 342, 342, 342,
+    382, 383, 384, 385, 169, 169, 169, 386, 169, 169, 169, 387, 388, 389, 169, 169,
+    4, 4, 4, 4, 4, 375, 390, 391, 392, 169, 374, 393, 394, 395, 396, 397,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 31,
+    342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342,
+    342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342,
+    342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342,
+    342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 342, 398,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 399,
+    32, 4, 1, 1, 1, 1, 1, 1, 4, 4, 4, 4, 4, 4, 4, 4,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4,
+};
+
+constexpr std::uint8_t LB_VALUES[] = {
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 2, 0, 0, 1, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    4, 20, 19, 28, 26, 27, 28, 19, 17, 16, 28, 26, 21, 11, 21, 22,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 21, 21, 28, 28, 28, 20,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 26, 16, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 10, 15, 28, 7,
+    7, 7, 7, 7, 7, 3, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    9, 17, 27, 26, 26, 26, 28, 28, 28, 28, 28, 19, 28, 10, 28, 28,
+    27, 26, 28, 28, 12, 28, 28, 28, 28, 28, 28, 19, 28, 28, 28, 17,
+    28, 28, 28, 28, 28, 28, 28, 28, 12, 28, 28, 28, 12, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 12,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 9, 9,
+    9, 9, 9, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 28,
+    28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 21, 10, 28, 28, 28, 28, 26,
+    28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 7,
+    28, 7, 7, 28, 7, 7, 20, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 29,
+    29, 29, 29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 21, 21, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 20, 7, 20, 20, 20,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 27, 25, 25, 28, 28, 28,
+    7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 20, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 7,
+    7, 7, 7, 7, 7, 28, 28, 7, 7, 28, 7, 7, 7, 7, 28, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 28, 28, 28, 28, 28,
+    28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 28, 28, 28, 28, 21, 20, 28, 28, 28, 7, 26, 26,
+    28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 28, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 28, 7, 7, 7, 28, 7, 7, 7, 7, 7, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7,
+    7, 7, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 28, 7, 7,
+    28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 7, 10, 10, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    28, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 28, 7, 7,
+    7, 7, 7, 7, 7, 28, 28, 7, 7, 28, 28, 7, 7, 7, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 7, 28, 28, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    28, 28, 27, 27, 28, 28, 28, 28, 28, 27, 28, 26, 28, 28, 7, 28,
+    7, 7, 7, 28, 28, 28, 28, 7, 7, 28, 28, 7, 7, 7, 28, 28,
+    28, 28, 28, 28, 28, 28, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    7, 7, 28, 28, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 28, 7, 7, 7, 28, 7, 7, 7, 28, 28,
+    28, 26, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7,
+    28, 28, 28, 28, 28, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7,
+    7, 7, 7, 28, 28, 28, 7, 7, 7, 28, 7, 7, 7, 7, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 26, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 28, 7, 7, 7, 28, 7, 7, 7, 7, 28, 28,
+    28, 28, 28, 28, 28, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 12, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 7, 7, 12, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 28, 7, 7,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 27, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 28, 28, 28, 28, 7,
+    7, 7, 7, 7, 7, 28, 7, 28, 7, 7, 7, 7, 7, 7, 7, 7,
+    28, 28, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 26,
+    28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 10, 10, 28, 28, 28, 28,
+    28, 7, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 28, 28,
+    28, 12, 12, 12, 12, 28, 12, 12, 9, 12, 12, 10, 9, 20, 20, 20,
+    20, 20, 9, 28, 20, 28, 28, 28, 7, 7, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 10, 7, 28, 7, 28, 7, 17, 15, 17, 15, 7, 7,
+    28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10,
+    7, 7, 7, 7, 7, 10, 7, 7, 28, 28, 28, 28, 28, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 28, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 10, 10,
+    28, 28, 28, 28, 28, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    12, 12, 10, 12, 28, 28, 28, 28, 28, 9, 9, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28,
+    28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 28, 28, 28, 28, 7, 7,
+    7, 28, 7, 7, 7, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28,
+    28, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 7,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 7, 7, 7, 7, 28, 28,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7,
+    28, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 15, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 10, 10, 10, 28, 28,
+    28, 28, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 7, 7, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 10, 10, 23, 28, 10, 28, 10, 26, 28, 7, 28, 28,
+    28, 28, 20, 20, 10, 10, 12, 28, 20, 20, 28, 7, 7, 7, 9, 7,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28,
+    28, 28, 28, 28, 20, 20, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 7,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 10, 10, 28, 10, 10, 10,
+    10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 10, 10, 28,
+    7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 10, 10, 10, 10, 10,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 10, 10,
+    7, 7, 7, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 7, 28, 28,
+    28, 28, 28, 28, 7, 28, 28, 7, 7, 7, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 12, 28, 28,
+    10, 10, 10, 10, 10, 10, 10, 9, 10, 10, 10, 5, 7, 6, 7, 7,
+    10, 9, 10, 10, 13, 28, 28, 28, 19, 19, 17, 19, 19, 19, 17, 19,
+    28, 28, 28, 28, 24, 24, 24, 10, 0, 0, 7, 7, 7, 7, 7, 9,
+    27, 27, 27, 27, 27, 27, 27, 27, 28, 19, 19, 28, 23, 23, 28, 28,
+    28, 28, 28, 28, 21, 17, 15, 23, 23, 23, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 10, 28, 10, 10, 10, 10, 28, 10, 10, 10,
+    8, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 15, 28,
+    26, 26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 27, 26, 26, 27, 26,
+    27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 28, 28, 27, 28, 28, 28, 28, 28, 27, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 24,
+    28, 28, 28, 28, 28, 28, 28, 28, 17, 15, 17, 15, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 18, 15, 28, 28, 28, 28, 28,
+    30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 30, 30, 28, 28, 30, 28, 30, 30, 30, 32, 30, 30,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 30, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 30,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 28, 28, 28, 30, 28, 30,
+    30, 30, 28, 30, 30, 28, 28, 28, 30, 30, 28, 28, 30, 28, 28, 30,
+    30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28,
+    28, 30, 30, 30, 30, 30, 28, 30, 30, 32, 30, 28, 28, 30, 30, 30,
+    30, 30, 30, 30, 30, 28, 28, 28, 30, 30, 32, 32, 32, 32, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 19, 19, 19, 19, 19,
+    19, 28, 20, 20, 30, 28, 28, 28, 17, 15, 17, 15, 17, 15, 17, 15,
+    17, 15, 17, 15, 17, 15, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 17, 15, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 17, 15, 17, 15, 17, 15, 17, 15, 17, 15,
+    28, 28, 28, 17, 15, 17, 15, 17, 15, 17, 15, 17, 15, 17, 15, 17,
+    15, 17, 15, 17, 15, 17, 15, 17, 15, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 15, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7,
+    7, 7, 28, 28, 28, 28, 28, 28, 28, 20, 10, 10, 10, 28, 20, 10,
+    10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 10, 10,
+    10, 10, 10, 10, 10, 10, 28, 10, 17, 10, 28, 28, 19, 19, 28, 28,
+    19, 19, 17, 15, 17, 15, 17, 15, 17, 15, 10, 10, 10, 10, 20, 28,
+    10, 10, 28, 10, 10, 28, 28, 28, 28, 28, 13, 13, 10, 10, 10, 28,
+    10, 10, 17, 10, 10, 10, 10, 10, 10, 10, 10, 28, 10, 28, 10, 10,
+    28, 28, 28, 20, 20, 17, 15, 17, 15, 17, 15, 17, 15, 10, 28, 28,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 28, 28, 28,
+    10, 15, 15, 30, 30, 23, 30, 30, 18, 15, 18, 15, 18, 15, 18, 15,
+    18, 15, 30, 30, 18, 15, 18, 15, 18, 15, 18, 15, 23, 18, 15, 15,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 7, 7, 7, 7, 7, 7,
+    30, 30, 30, 30, 30, 7, 30, 30, 30, 30, 30, 23, 23, 30, 30, 30,
+    28, 23, 30, 23, 30, 23, 30, 23, 30, 23, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 23, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 23, 30, 23, 30, 23, 30, 30, 30, 30, 30, 30, 23, 30,
+    30, 30, 30, 30, 30, 23, 23, 28, 28, 7, 7, 23, 23, 23, 23, 30,
+    23, 23, 30, 23, 30, 23, 30, 23, 30, 23, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 23, 23, 30, 30, 30, 30, 23, 23, 23, 23, 30,
+    28, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    30, 30, 30, 30, 30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28,
+    30, 30, 30, 30, 30, 23, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 28, 28,
+    30, 30, 30, 30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 10, 20, 10,
+    7, 7, 7, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28,
+    7, 7, 28, 10, 10, 10, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 28, 28, 28, 7, 28, 28, 28, 28, 7, 28, 28, 28, 28,
+    28, 28, 28, 7, 7, 7, 7, 7, 28, 28, 28, 28, 7, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 27, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 12, 12, 20, 20, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 10, 10,
+    7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 12, 28, 28, 7,
+    28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 10, 10,
+    28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 28, 28, 28,
+    28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 28, 28, 28, 28, 28, 28, 10, 10, 10, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 28, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 28, 28, 10, 10, 10,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 28, 28,
+    7, 28, 7, 7, 7, 28, 28, 7, 7, 28, 28, 28, 28, 28, 7, 7,
+    10, 10, 28, 28, 28, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 10, 7, 7, 28, 28,
+    34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 34, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 34, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    37, 37, 37, 37, 37, 37, 37, 28, 28, 28, 28, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 7, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 28, 29, 28,
+    29, 29, 28, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 15, 17,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 27, 28, 28, 28,
+    21, 15, 15, 21, 21, 20, 20, 18, 15, 24, 28, 28, 28, 28, 28, 28,
+    30, 30, 30, 30, 30, 18, 15, 18, 15, 18, 15, 18, 15, 18, 15, 18,
+    15, 18, 15, 18, 15, 30, 30, 18, 15, 30, 30, 30, 30, 30, 30, 30,
+    15, 30, 15, 28, 23, 23, 20, 20, 30, 18, 15, 18, 15, 18, 15, 30,
+    30, 30, 30, 30, 30, 30, 30, 28, 30, 26, 27, 30, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 8,
+    28, 20, 30, 30, 26, 27, 30, 30, 18, 15, 30, 30, 15, 30, 15, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 23, 23, 30, 30, 30, 20,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 18, 30, 15, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 18, 30, 15, 30, 18,
+    15, 15, 18, 15, 15, 23, 30, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 23, 23,
+    28, 28, 30, 30, 30, 30, 30, 30, 28, 28, 30, 30, 30, 30, 30, 30,
+    28, 28, 30, 30, 30, 30, 30, 30, 28, 28, 30, 30, 30, 28, 28, 28,
+    27, 26, 30, 30, 30, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 14, 28, 28, 28,
+    10, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 28, 28,
+    28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 10,
+    28, 28, 28, 28, 28, 28, 28, 10, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 7, 7, 28, 7, 7, 28, 28, 28, 28, 28, 7, 7, 7, 7,
+    28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 28, 28, 28, 28, 7,
+    10, 10, 10, 10, 10, 10, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28,
+    10, 10, 10, 10, 10, 10, 24, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 10, 10, 10, 10, 10, 10, 10,
+    28, 28, 28, 28, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 10, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 10, 10, 28, 28, 28, 28, 28, 28, 28,
+    7, 28, 28, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 10, 10,
+    10, 10, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 28, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    10, 10, 10, 10, 28, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 7, 28, 12, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 28, 28, 28, 28, 10, 10, 28, 10, 7, 7, 7, 7, 28, 7, 7,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 12, 28, 10, 10, 10,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 10, 10, 28, 10, 10, 28, 7, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 10, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 7, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28,
+    28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 10, 10, 10, 10, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 10, 10, 28, 28, 7, 28,
+    7, 7, 7, 7, 7, 7, 28, 28, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 12, 10, 10, 20, 20, 28, 28, 28, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 28, 28, 28, 28, 7, 7, 28, 28,
+    7, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 28, 10, 10, 10, 28,
+    7, 7, 7, 7, 7, 7, 28, 7, 7, 28, 28, 7, 7, 7, 7, 28,
+    7, 28, 7, 7, 10, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 7, 7, 7, 7, 7, 7,
+    7, 28, 12, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28,
+    28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 7, 7, 7, 7, 12,
+    28, 10, 10, 10, 10, 12, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 10, 10, 10, 28, 12, 12,
+    12, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 28, 7, 7, 7, 7, 7, 7, 7, 7,
+    28, 10, 10, 10, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    12, 20, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    28, 7, 7, 7, 7, 7, 7, 28, 28, 28, 7, 28, 7, 7, 28, 7,
+    7, 7, 7, 7, 7, 7, 28, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 28,
+    7, 7, 28, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27,
+    27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    10, 10, 10, 10, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 17, 17, 17, 15, 15, 15, 28, 28,
+    28, 28, 15, 28, 28, 28, 17, 15, 17, 15, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 15, 15, 28, 28, 28, 28,
+    9, 9, 9, 9, 9, 9, 9, 17, 15, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 17, 15,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 28, 28, 28, 10, 10,
+    7, 7, 7, 7, 7, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 10, 10, 10, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 10, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 10, 10, 28, 28, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 7,
+    23, 23, 23, 23, 9, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28,
+    30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    23, 23, 23, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 23, 23, 23, 23, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 10,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28,
+    28, 28, 28, 28, 28, 7, 7, 7, 7, 7, 28, 28, 28, 7, 7, 7,
+    7, 7, 7, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 7, 7, 7, 28, 28,
+    28, 28, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28,
+    28, 28, 28, 28, 7, 28, 28, 10, 10, 10, 10, 28, 28, 28, 28, 28,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 7, 7, 7, 7, 7,
+    7, 7, 28, 7, 7, 28, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 7, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 28, 28, 28, 28, 26,
+    28, 28, 28, 28, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 28, 28, 28, 28, 17, 17,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31,
+    30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31,
+    31, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 30, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31,
+    30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    30, 30, 30, 30, 30, 32, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 28, 30, 30,
+    30, 30, 30, 30, 30, 28, 28, 30, 30, 30, 30, 30, 28, 30, 30, 30,
+    30, 30, 32, 32, 32, 30, 30, 32, 30, 30, 32, 32, 32, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 33, 33, 33, 33, 33,
+    30, 30, 32, 32, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 30, 30, 30, 32, 30, 30, 30,
+    30, 32, 32, 32, 30, 32, 32, 32, 30, 30, 30, 30, 30, 30, 30, 32,
+    30, 32, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    28, 30, 28, 30, 28, 30, 30, 30, 30, 30, 32, 30, 30, 30, 30, 28,
+    30, 28, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    28, 28, 28, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 32, 32, 30, 30, 30, 30, 32, 30, 30, 30, 30, 30,
+    32, 30, 30, 30, 30, 32, 32, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 30, 30,
+    30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 32, 32, 32, 30, 30, 30, 32, 32, 32, 32, 32,
+    28, 28, 28, 28, 28, 28, 19, 19, 19, 23, 23, 23, 28, 28, 28, 28,
+    30, 30, 30, 32, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 32, 32, 32, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    32, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 32, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31,
+    28, 28, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    28, 28, 28, 28, 28, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31,
+    30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 31, 31, 31, 31,
+    28, 28, 28, 28, 28, 28, 28, 28, 31, 31, 31, 31, 31, 31, 31, 31,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 31, 31, 31, 31, 31, 31,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 31, 31,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 32, 30, 30, 32,
+    30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+    30, 30, 30, 30, 30, 30, 32, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 30, 30, 32, 32, 32, 30,
+    30, 30, 30, 30, 30, 30, 30, 32, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 32, 32, 30, 32, 32, 30, 32, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32,
+    30, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31,
+    30, 30, 30, 30, 30, 31, 31, 31, 30, 30, 30, 30, 30, 31, 31, 31,
+    30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31,
+    30, 30, 30, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31,
+    30, 30, 30, 30, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+    32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 28, 28,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 28,
+};
+
+constexpr auto LB = property_trie{LB_ROWS, LB_BLOCKS, LB_VALUES};  // 14336 bytes
+// Simple_Case_Folding as an index into `FOLD_DELTAS`, the difference to the folded code
+constexpr std::int32_t FOLD_DELTAS[] = {
+    0, -42319, -42315, -42308, -42307, -42305, -42282, -42280, -42261, -42258, -38864, -35384,
+    -35332, -10815, -10783, -10782, -10780, -10749, -10743, -10727, -8383, -8262, -7615, -7517,
+    -7173, -6222, -6221, -6212, -6211, -6210, -6204, -6180, -3814, -3008, -268, -195,
+    -163, -130, -128, -126, -121, -112, -100, -97, -86, -74, -64, -60,
+    -58, -56, -54, -48, -30, -25, -22, -15, -9, -8, -7, 1,
+    2, 8, 15, 16, 26, 28, 32, 34, 37, 38, 39, 40,
+    48, 63, 64, 69, 71, 79, 80, 116, 202, 203, 205, 206,
+    207, 209, 210, 211, 213, 214, 217, 218, 219, 775, 928, 7264,
+    10792, 10795, 35267,
+};
+
+constexpr std::uint8_t FOLD_ROWS[] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 7,
+    8, 3, 9, 3, 3, 3, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 11, 3, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 13,
+    3, 3, 14, 3, 3, 3, 15, 3, 3, 3, 3, 3, 16, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 17, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 18, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+constexpr std::uint16_t FOLD_BLOCKS[] = {
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 4, 5, 0, 0,
+    6, 6, 6, 7, 8, 6, 6, 9, 10, 11, 12, 13, 14, 15, 6, 16,
+    6, 6, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, 0, 0, 21, 22, 1, 23, 0, 24, 25, 6, 26,
+    27, 4, 4, 0, 0, 0, 6, 6, 28, 6, 6, 6, 29, 6, 6, 6,
+    6, 6, 6, 30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 34, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+    0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 37, 38, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 39, 6, 6, 6, 6, 6, 6,
+    40, 35, 40, 40, 35, 41, 40, 0, 40, 40, 40, 42, 43, 44, 45, 46,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 47, 48, 0, 0, 49, 0, 50, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    31, 31, 31, 0, 0, 0, 53, 54, 6, 6, 6, 6, 6, 6, 55, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 57, 0, 6, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 59, 59, 6, 6, 6, 60, 61, 62, 63, 64, 65, 66, 0, 67,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    69, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 71, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 72, 72, 73, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 74, 75, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    76, 76, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr std::uint8_t FOLD_VALUES[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 0, 66, 66, 66, 66, 66, 66, 66, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    0, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0, 59, 0, 59, 0, 59,
+    0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0, 59, 0, 59, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 40, 59, 0, 59, 0, 59, 0, 34,
+    0, 86, 59, 0, 59, 0, 83, 59, 0, 82, 82, 59, 0, 0, 77, 80,
+    81, 59, 0, 82, 84, 0, 87, 85, 59, 0, 0, 0, 87, 88, 0, 89,
+    59, 0, 59, 0, 59, 0, 91, 59, 0, 91, 0, 0, 59, 0, 91, 59,
+    0, 90, 90, 59, 0, 59, 0, 92, 59, 0, 0, 0, 59, 0, 0, 0,
+    0, 0, 0, 0, 60, 59, 0, 60, 59, 0, 60, 59, 0, 59, 0, 59,
+    0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 59, 0,
+    0, 60, 59, 0, 59, 0, 43, 49, 59, 0, 59, 0, 59, 0, 59, 0,
+    37, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 36, 96, 0,
+    0, 59, 0, 35, 75, 76, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 0, 59, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 79,
+    0, 0, 0, 0, 0, 0, 69, 0, 68, 68, 68, 0, 74, 0, 73, 73,
+    66, 66, 0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0,
+    0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61,
+    52, 53, 0, 0, 0, 55, 54, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    50, 51, 0, 0, 47, 46, 0, 59, 0, 58, 59, 0, 0, 37, 37, 37,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 59, 0,
+    62, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0,
+    0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 0, 95, 0, 0, 0, 0, 0, 95, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0,
+    25, 26, 27, 29, 29, 28, 30, 31, 98, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 33, 33, 33,
+    59, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 48, 0, 0, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 57, 0, 57, 0, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 45, 45, 56, 0, 24, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 56, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 42, 42, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 41, 41, 58, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 39, 39, 56, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 20, 21, 0, 0, 0, 0,
+    0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    59, 0, 18, 32, 19, 0, 0, 59, 0, 59, 0, 59, 0, 16, 17, 14,
+    15, 0, 59, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13,
+    59, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0,
+    0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 0,
+    0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 59, 0, 12, 59, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 0, 0, 0, 59, 0, 7, 0, 0,
+    59, 0, 59, 0, 0, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 3, 1, 2, 5, 3, 0,
+    9, 6, 8, 94, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0, 59, 0,
+    59, 0, 59, 0, 51, 4, 11, 59, 0, 59, 0, 0, 0, 0, 0, 0,
+    59, 0, 0, 0, 0, 0, 59, 0, 59, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+    71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 0, 70, 70, 70, 70,
+    70, 70, 70, 0, 70, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr auto FOLD = property_trie{FOLD_ROWS, FOLD_BLOCKS, FOLD_VALUES};  // 5036 bytes
+
+// the only chars out of ascii that fold into it
+constexpr char32_t FOLD_INTO_ASCII[] = {0x17f, 0x212a};
+
+}  // namespace utf8::noexport::unicode
@@ -0,0 +1,74 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+// the property of ascii chars without walking the trie
+template <typename Property>
+constexpr auto ascii_properties(const unicode::property_trie& trie) noexcept {
+  std::array<Property, 0x80> ascii{};
+  for (std::uint32_t code = 0; code < 0x80; code++) {
+    ascii[code] = Property(trie[code]);
+  }
+  return ascii;
+}
+
+// `End(str, pos)` is the end of the segment that starts at `pos`
+template <auto End>
+struct segment_iter {
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = string_view;
+  using difference_type = std::ptrdiff_t;
+
+  std::string_view str;
+  size_t pos = 0, end = 0;
+
+  constexpr auto operator++() noexcept -> segment_iter& {
+    pos = end;
+    end = pos < str.size() ? End(str, pos) : pos;
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> segment_iter {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr auto operator*() const noexcept -> value_type {
+    return {unsafe, str.substr(pos, end - pos)};
+  }
+
+  constexpr auto operator==(const segment_iter& other) const noexcept -> bool {
+    return pos == other.pos;
+  }
+};
+}  // namespace noexport
+
+/// consecutive segments that cover the whole string, every segment starts at a boundary
+/// found by `End` with no state carried over from the previous one
+template <auto End>
+class segments_view : public std::ranges::view_interface<segments_view<End>> {
+  std::string_view _str;
+
+ public:
+  constexpr segments_view() noexcept = default;
+  explicit constexpr segments_view(string_view str) noexcept : _str(str) {}
+
+  [[nodiscard]] constexpr auto begin() const noexcept {
+    auto end = _str.empty() ? 0 : End(_str, 0);
+    return noexport::segment_iter<End>{_str, 0, end};
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept {
+    return noexport::segment_iter<End>{_str, _str.size(), _str.size()};
+  }
+};
+
+}  // namespace utf8
+
+namespace std::ranges {
+template <auto End>
+constexpr bool enable_borrowed_range<utf8::segments_view<End>> = true;
+}  // namespace std::ranges
@@ -0,0 +1,91 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+constexpr auto SENTENCE_ASCII = ascii_properties<unicode::sb>(unicode::SB);
+
+constexpr auto sentence_break(const char* place) noexcept -> unicode::sb {
+  char8_t byte = *place;
+  return byte < 0x80 ? SENTENCE_ASCII[byte] : unicode::sb(unicode::SB[decode_char(place)]);
+}
+
+constexpr auto is_para_sep(unicode::sb prop) noexcept -> bool {
+  using enum unicode::sb;
+  return prop == sep || prop == cr || prop == lf;
+}
+
+// SB8: whether the first char from `pos` that may start a sentence is a lowercase letter
+constexpr auto lower_follows(std::string_view str, size_t pos) noexcept -> bool {
+  using enum unicode::sb;
+  for (; pos < str.size(); pos += thin_decode(str[pos])) {
+    auto prop = sentence_break(str.data() + pos);
+    if (prop == oletter || prop == upper || prop == lower || prop == aterm || prop == sterm ||
+        is_para_sep(prop)) {
+      return prop == lower;
+    }
+  }
+  return false;
+}
+
+// end of the sentence that starts at `pos`, it keeps the spaces and the paragraph separator
+// after its terminator
+constexpr auto sentence_end(std::string_view str, size_t pos) noexcept -> size_t {
+  using enum unicode::sb;
+  auto prev = sentence_break(str.data() + pos);
+  auto before = other;  // the char before `prev`, SB5 skips Extend and Format
+  // the terminator of the SATerm Close* Sp* run that ends at `prev`, `other` out of such a run
+  auto term = prev == aterm || prev == sterm ? prev : other;
+  auto spaced = false;  // the run has got to Sp
+  pos += thin_decode(str[pos]);
+
+  for (; pos < str.size(); pos += thin_decode(str[pos])) {
+    auto next = sentence_break(str.data() + pos);
+    if (prev == cr && next == lf) {
+      prev = next;  // SB3
+      continue;
+    }
+    if (is_para_sep(prev)) {
+      return pos;  // SB4
+    }
+    if (next == extend || next == format) {
+      continue;  // SB5
+    }
+
+    if (prev == aterm && next == numeric) {
+      // SB6
+    } else if ((before == upper || before == lower) && prev == aterm && next == upper) {
+      // SB7
+    } else if (term != other) {
+      auto joined = next == scontinue || next == aterm || next == sterm ||  // SB8a
+                    (not spaced && next == close) ||                        // SB9
+                    next == sp || is_para_sep(next) ||                      // SB9, SB10
+                    (term == aterm && lower_follows(str, pos));             // SB8
+      if (not joined) {
+        return pos;  // SB11
+      }
+    }
+
+    if (next == aterm || next == sterm) {
+      term = next;
+      spaced = false;
+    } else if (term != other && next == sp) {
+      spaced = true;
+    } else if (not(term != other && next == close && not spaced)) {
+      term = other;
+    }
+    before = std::exchange(prev, next);
+  }
+  return pos;
+}
+}  // namespace noexport
+
+/// sentences of UAX #29, each one with the spaces and the line break that follow it
+using sentences_view = segments_view<noexport::sentence_end>;
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::sentences() const noexcept {
+  return sentences_view(*this);
+}
+
+}  // namespace utf8
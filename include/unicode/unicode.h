@@ -1,6 +1,13 @@
 #pragma once
 
+#include "properties.h"
 #include "conversions.h"
+#include "segments.h"
+#include "graphemes.h"
+#include "words.h"
+#include "sentences.h"
+#include "line_break.h"
+#include "icase.h"
 
 namespace utf8 {
 
@@ -24,6 +31,35 @@ constexpr auto convert_while_ascii(std::string_view str, std::invocable<char> au
   return place;
 }
 
+// `str` converted in place while each char maps to one of the same byte length,
+// the offset of the first char that does not (or the size)
+constexpr auto convert_in_place(str_mut str, const std::array<std::uint8_t, 16>& letters,
+                                const unicode::property_trie& table,
+                                std::span<const std::int32_t> deltas) noexcept -> size_t {
+  auto bytes = str.data_mut();
+  size_t pos = 0;
+  size_t retry = 0;  // where to try SIMD again: after the char it stopped at if it went far
+  while (pos < str.size()) {
+    if not consteval {
+      if (pos >= retry) {
+        auto done = simd::convert_ascii(bytes + pos, str.size() - pos, bytes + pos, letters);
+        pos += done;
+        retry = done >= 16 ? pos + 1 : pos + simd::BLOCK;
+        continue;
+      }
+    }
+    auto code = decode_char(bytes + pos);
+    auto len = thin_decode(bytes[pos]);
+    auto index = table[code];
+    if (index == conversions::EXPANDS || size_utf8(code + deltas[index]) != len) {
+      return pos;
+    }
+    encode_utf8_unchecked(code + deltas[index], bytes + pos);
+    pos += len;
+  }
+  return pos;
+}
+
 }  // namespace noexport
 
 constexpr auto to_lower(string_view str) -> string {
@@ -54,6 +90,36 @@ constexpr auto to_upper(string_view str) -> string {
   return out;
 }
 
+/// lower case in place while every char keeps the byte length of its encoding, as in nearly all
+/// scripts, then `nullopt` is returned; otherwise the result is a new `string`, and `str` is left
+/// partly converted
+constexpr auto do_lower(str_mut str) -> std::optional<string> {
+  auto pos = noexport::convert_in_place(str, noexport::simd::UPPER_HIGH,
+                                        noexport::conversions::LOWER,
+                                        noexport::conversions::LOWER_DELTAS);
+  if (pos == str.size()) {
+    return std::nullopt;
+  }
+  auto bytes = std::string_view(str);
+  auto out = string(noexport::unsafe, bytes.substr(0, pos));
+  out += to_lower(string_view(noexport::unsafe, bytes.substr(pos)));
+  return out;
+}
+
+/// upper case as `do_lower` does it, `ß` is one of the chars that needs a new string
+constexpr auto do_upper(str_mut str) -> std::optional<string> {
+  auto pos = noexport::convert_in_place(str, noexport::simd::LOWER_HIGH,
+                                        noexport::conversions::UPPER,
+                                        noexport::conversions::UPPER_DELTAS);
+  if (pos == str.size()) {
+    return std::nullopt;
+  }
+  auto bytes = std::string_view(str);
+  auto out = string(noexport::unsafe, bytes.substr(0, pos));
+  out += to_upper(string_view(noexport::unsafe, bytes.substr(pos)));
+  return out;
+}
+
 using noexport::conversions::str_t;
 
 constexpr auto to_lower(char_t ch) -> str_t {
@@ -0,0 +1,138 @@
+#pragma once
+
+namespace utf8 {
+
+namespace noexport {
+constexpr auto WORD_ASCII = ascii_properties<unicode::wb>(unicode::WB);
+
+constexpr auto word_break(const char* place) noexcept -> unicode::wb {
+  char8_t byte = *place;
+  return byte < 0x80 ? WORD_ASCII[byte] : unicode::wb(unicode::WB[decode_char(place)]);
+}
+
+constexpr auto is_ahletter(unicode::wb prop) noexcept -> bool {
+  using enum unicode::wb;
+  return prop == aletter || prop == hebrew_letter || prop == aletter_extended_pictographic;
+}
+
+// MidLetter | MidNumLetQ
+constexpr auto is_mid_letter(unicode::wb prop) noexcept -> bool {
+  using enum unicode::wb;
+  return prop == mid_letter || prop == mid_num_let || prop == single_quote;
+}
+
+// MidNum | MidNumLetQ
+constexpr auto is_mid_num(unicode::wb prop) noexcept -> bool {
+  using enum unicode::wb;
+  return prop == mid_num || prop == mid_num_let || prop == single_quote;
+}
+
+// chars that WB4 attaches to the one before them
+constexpr auto is_word_ignored(unicode::wb prop) noexcept -> bool {
+  using enum unicode::wb;
+  return prop == extend || prop == format || prop == zwj;
+}
+
+// the first char from `pos` that WB4 does not skip, `other` at the end of the string
+constexpr auto word_break_after(std::string_view str, size_t pos) noexcept -> unicode::wb {
+  for (; pos < str.size(); pos += thin_decode(str[pos])) {
+    if (auto prop = word_break(str.data() + pos); not is_word_ignored(prop)) {
+      return prop;
+    }
+  }
+  return unicode::wb::other;
+}
+
+// UAX #29 rules WB5-WB16 for chars that WB4 does not skip, `after` is the one past `next`
+constexpr auto word_joined(unicode::wb before, unicode::wb prev, unicode::wb next,
+                           size_t regional, auto after) noexcept -> bool {
+  using enum unicode::wb;
+  if (is_ahletter(prev)) {
+    if (is_ahletter(next) || next == numeric || next == extend_num_let) {
+      return true;  // WB5, WB9, WB13a
+    }
+    if (is_mid_letter(next) && is_ahletter(after())) {
+      return true;  // WB6
+    }
+    if (prev == hebrew_letter && (next == single_quote ||
+                                  (next == double_quote && after() == hebrew_letter))) {
+      return true;  // WB7a, WB7b
+    }
+    return false;
+  }
+  if (prev == numeric) {
+    if (is_ahletter(next) || next == numeric || next == extend_num_let) {
+      return true;  // WB8, WB10, WB13a
+    }
+    return is_mid_num(next) && after() == numeric;  // WB12
+  }
+  if (is_ahletter(before) && is_mid_letter(prev) && is_ahletter(next)) {
+    return true;  // WB7
+  }
+  if (before == hebrew_letter && prev == double_quote && next == hebrew_letter) {
+    return true;  // WB7c
+  }
+  if (before == numeric && is_mid_num(prev) && next == numeric) {
+    return true;  // WB11
+  }
+  if (prev == katakana) {
+    return next == katakana || next == extend_num_let;  // WB13, WB13a
+  }
+  if (prev == extend_num_let) {
+    return is_ahletter(next) || next == numeric || next == katakana ||
+           next == extend_num_let;  // WB13a, WB13b
+  }
+  return prev == regional_indicator && next == regional_indicator &&
+         regional % 2 == 1;  // WB15, WB16
+}
+
+// end of the word segment that starts at `pos`,
+// ascii chars take their property from a small table instead of decoding
+constexpr auto word_end(std::string_view str, size_t pos) noexcept -> size_t {
+  using enum unicode::wb;
+  auto prev = word_break(str.data() + pos);
+  auto raw = prev;      // the char just before, even if WB4 skips it
+  auto before = other;  // the char before `prev`
+  size_t regional = prev == regional_indicator;
+  pos += thin_decode(str[pos]);
+
+  while (pos < str.size()) {
+    auto next = word_break(str.data() + pos);
+    auto len = thin_decode(str[pos]);
+    if (raw == cr && next == lf) {
+      raw = prev = next;  // WB3
+      pos += len;
+      continue;
+    }
+    if (raw == cr || raw == lf || raw == newline || next == cr || next == lf || next == newline) {
+      return pos;  // WB3a, WB3b
+    }
+
+    auto joined = (raw == zwj && (next == extended_pictographic ||
+                                  next == aletter_extended_pictographic)) ||  // WB3c
+                  (raw == wseg_space && next == wseg_space);                  // WB3d
+    raw = next;
+    if (not is_word_ignored(next)) {
+      auto after = [&] { return word_break_after(str, pos + len); };
+      if (not joined && not word_joined(before, prev, next, regional, after)) {
+        return pos;  // WB999
+      }
+      regional = next == regional_indicator ? regional + 1 : 0;
+      before = std::exchange(prev, next);
+    }
+    pos += len;  // WB4 skips ignored chars
+  }
+  return pos;
+}
+}  // namespace noexport
+
+/// word boundaries of UAX #29: words, numbers, and every space, punctuation mark or emoji
+/// between them as a segment of its own
+using words_view = segments_view<noexport::word_end>;
+
+template <typename Q>
+constexpr auto basic_string_view<Q>::words() const noexcept {
+  return words_view(*this);
+}
+
+}  // namespace utf8
@@ -0,0 +1,187 @@
+#pragma once
+
+namespace utf8 {
+
+/// unpaired surrogate at `valid_to` (in UTF-16 units)
+struct utf16_error : std::exception {
+  size_t valid_to;
+
+  explicit utf16_error(size_t valid_to) noexcept : valid_to(valid_to) {}
+
+  [[nodiscard]] auto what() const noexcept -> const char* override {
+    return "invalid UTF-16, catch as `utf16_error` for more details";
+  }
+};
+
+namespace noexport {
+constexpr auto is_high_surrogate(char16_t unit) noexcept -> bool {
+  return (unit & 0xFC00) == 0xD800;
+}
+
+constexpr auto is_low_surrogate(char16_t unit) noexcept -> bool {
+  return (unit & 0xFC00) == 0xDC00;
+}
+
+constexpr auto combine_surrogates(char16_t high, char16_t low) noexcept -> std::uint32_t {
+  return 0x10000 + ((std::uint32_t(high) - 0xD800) << 10) + (std::uint32_t(low) - 0xDC00);
+}
+
+// code at `pos` (and the units it takes), a lone surrogate is returned as is
+constexpr auto decode_utf16(std::u16string_view str, size_t pos) noexcept
+    -> std::pair<std::uint32_t, size_t> {
+  auto unit = str[pos];
+  if (is_high_surrogate(unit) && pos + 1 < str.size() && is_low_surrogate(str[pos + 1])) {
+    return {combine_surrogates(unit, str[pos + 1]), 2};
+  }
+  return {unit, 1};
+}
+
+// stops at the first lone surrogate unless `lossy`, then returns the units read so far
+constexpr auto utf16_to_utf8(std::u16string_view src, char* dst, bool lossy) noexcept
+    -> std::pair<char*, size_t> {
+  // the caller has room for `utf8_length_from_utf16(src)` bytes
+  auto encode = [&](std::uint32_t code) { dst += encode_utf8_unchecked(code, dst); };
+
+  size_t pos = 0;
+  while (pos < src.size()) {
+    auto end = src.size();
+#ifdef _UTF8_SIMD_SSE2
+    if not consteval {
+      if (pos + 8 <= src.size()) {
+        // every unit after the block takes at least one byte
+        if (auto next = sse2::narrow(src.data() + pos, dst, src.size() - pos - 8)) {
+          dst = next;
+          pos += 8;
+          continue;
+        }
+        // scalar until the end of the block (and maybe one unit more for a pair)
+        end = pos + 8;
+      }
+    }
+#endif
+    while (pos < end) {
+      auto [code, len] = decode_utf16(src, pos);
+      if (not is_valid_code(code)) {
+        if (not lossy) {
+          return {dst, pos};
+        }
+        code = 0xFFFD;
+      }
+      encode(code);
+      pos += len;
+    }
+  }
+  return {dst, pos};
+}
+}  // namespace noexport
+
+/// exact number of UTF-16 units for `to_utf16(str)`
+[[nodiscard]] constexpr auto utf16_length_from_utf8(string_view str) noexcept -> size_t {
+  size_t len = 0;
+  for (char8_t byte : std::string_view(str)) {
+    // a unit for every lead byte and one more for a surrogate pair
+    len += size_t(noexport::is_utf8_bound(byte)) + size_t(byte >= 0xF0);
+  }
+  return len;
+}
+
+/// exact number of bytes for `from_utf16(str)`, also for `from_utf16_lossy(str)`
+/// because U+FFFD takes 3 bytes just as a lone surrogate would
+[[nodiscard]] constexpr auto utf8_length_from_utf16(std::u16string_view str) noexcept -> size_t {
+  size_t len = 0;
+  for (size_t pos = 0; pos < str.size(); pos++) {
+    auto unit = str[pos];
+    if (unit < noexport::MAX_ONE) {
+      len += 1;
+    } else if (unit < noexport::MAX_TWO) {
+      len += 2;
+    } else if (noexport::is_high_surrogate(unit) && pos + 1 < str.size() &&
+               noexport::is_low_surrogate(str[pos + 1])) {
+      len += 4;
+      pos++;
+    } else {
+      len += 3;
+    }
+  }
+  return len;
+}
+
+[[nodiscard]] constexpr auto validate_utf16(std::u16string_view str) noexcept
+    -> std::optional<utf16_error> {
+  for (size_t pos = 0; pos < str.size();) {
+    auto [code, len] = noexport::decode_utf16(str, pos);
+    if (not noexport::is_valid_code(code)) {
+      return utf16_error(pos);
+    }
+    pos += len;
+  }
+  return std::nullopt;
+}
+
+/// writes `utf16_length_from_utf8(str)` units to `dst`, returns the end of them
+constexpr auto to_utf16(string_view str, char16_t* dst) noexcept -> char16_t* {
+  auto bytes = std::string_view(str);
+
+  size_t pos = 0;
+  while (pos < bytes.size()) {
+    auto end = bytes.size();
+#ifdef _UTF8_SIMD_SSE2
+    if not consteval {
+      auto [read, written] = noexport::sse2::decode_runs(bytes.data() + pos, bytes.size() - pos,
+                                                         dst, bytes.size());
+      pos += read;
+      dst += written;
+      // the next block has longer chars, do not try again until it is passed
+      end = std::min(bytes.size(), pos + 16);
+    }
+#endif
+    while (pos < end) {
+      auto code = noexport::decode_char(bytes.data() + pos);
+      pos += noexport::thin_decode(bytes[pos]);
+
+      if (code < noexport::MAX_THREE) {
+        *dst++ = char16_t(code);
+      } else {
+        code -= 0x10000;
+        *dst++ = char16_t(0xD800 + (code >> 10));
+        *dst++ = char16_t(0xDC00 + (code & 0x3FF));
+      }
+    }
+  }
+  return dst;
+}
+
+[[nodiscard]] constexpr auto to_utf16(string_view str) -> std::u16string {
+  std::u16string place(utf16_length_from_utf8(str), u'\0');
+  to_utf16(str, place.data());
+  return place;
+}
+
+/// writes `utf8_length_from_utf16(str)` bytes to `dst`, returns the end of them,
+/// throws `utf16_error` at a lone surrogate
+constexpr auto from_utf16(std::u16string_view str, char* dst) -> char* {
+  auto [end, read] = noexport::utf16_to_utf8(str, dst, false);
+  if (read != str.size()) {
+    throw utf16_error(read);
+  }
+  return end;
+}
+
+/// lone surrogates are replaced by U+FFFD
+constexpr auto from_utf16_lossy(std::u16string_view str, char* dst) noexcept -> char* {
+  return noexport::utf16_to_utf8(str, dst, true).first;
+}
+
+[[nodiscard]] constexpr auto from_utf16(std::u16string_view str) -> string {
+  std::string place(utf8_length_from_utf16(str), '\0');
+  from_utf16(str, place.data());
+  return {noexport::unsafe, std::move(place)};
+}
+
+[[nodiscard]] constexpr auto from_utf16_lossy(std::u16string_view str) -> string {
+  std::string place(utf8_length_from_utf16(str), '\0');
+  from_utf16_lossy(str, place.data());
+  return {noexport::unsafe, std::move(place)};
+}
+
+}  // namespace utf8
@@ -0,0 +1,76 @@
+#pragma once
+
+namespace utf8 {
+
+/// exact number of bytes for `encode_all(chars)`
+[[nodiscard]] constexpr auto utf8_length_from_utf32(std::span<const char_t> chars) noexcept
+    -> size_t {
+  size_t len = 0;
+  for (auto ch : chars) {
+    len += ch.size_utf8();
+  }
+  return len;
+}
+
+/// exact number of chars for `decode_all(str)`
+[[nodiscard]] constexpr auto utf32_length_from_utf8(string_view str) noexcept -> size_t {
+  return count_chars(str);
+}
+
+/// writes `utf8_length_from_utf32(chars)` bytes to `dst`, returns the end of them,
+/// throws `std::logic_error` at an invalid code (a `char_t` that was made as `unsafe`)
+constexpr auto encode_all(std::span<const char_t> chars, char* dst) -> char* {
+  size_t pos = 0;
+  while (pos < chars.size()) {
+    auto end = chars.size();
+#ifdef _UTF8_SIMD_SSE2
+    if not consteval {
+      if (pos + 8 <= chars.size()) {
+        auto src = reinterpret_cast<const std::uint32_t*>(chars.data() + pos);
+        // valid BMP codes: 1-3 bytes each and never a surrogate
+        if (__m128i units; noexport::sse2::pack_bmp(src, units)) {
+          // every char after the block takes at least one byte
+          if (auto next = noexport::sse2::narrow(units, dst, chars.size() - pos - 8)) {
+            dst = next;
+            pos += 8;
+            continue;
+          }
+        }
+        end = pos + 8;
+      }
+    }
+#endif
+    for (; pos < end; pos++) {
+      auto code = std::uint32_t(chars[pos]);
+      if (not noexport::is_valid_code(code)) {
+        throw std::logic_error(
+            std::format("encode_all: U+{:x} at {} is not a valid char", code, pos));
+      }
+      dst += noexport::encode_utf8_unchecked(code, dst);
+    }
+  }
+  return dst;
+}
+
+[[nodiscard]] constexpr auto encode_all(std::span<const char_t> chars) -> string {
+  std::string place(utf8_length_from_utf32(chars), '\0');
+  encode_all(chars, place.data());
+  return {noexport::unsafe, std::move(place)};
+}
+
+/// decodes `str` into the beginning of `dst`, which needs `utf32_length_from_utf8(str)` chars
+constexpr auto decode_all(string_view str, std::span<char_t> dst) -> std::span<char_t> {
+  auto bytes = std::string_view(str);
+  // every char takes at least a byte, so count them only if the buffer may be short
+  if (dst.size() < bytes.size()) {
+    if (auto len = utf32_length_from_utf8(str); len > dst.size()) {
+      throw std::logic_error(std::format(
+          "decode_all: need {} chars to decode the string, but the buffer has {}", len,
+          dst.size()));
+    }
+  }
+
+  return dst.first(str.chars().decode_into(dst).chars);
+}
+
+}  // namespace utf8
@@ -14,9 +14,13 @@ static_assert(std::numeric_limits<char8_t>::max() == (char8_t)char(-1),
 // clang-format off
 #include "noexport/utils.h"
 #include "noexport/encode.h"
+#include "noexport/simd.h"
 #include "noexport/validation.h"
+#include "noexport/transcode.h"
 
 #include "state.h"
+#include "validator.h"
+#include "parallel.h"
 
 #include "basic_string_view.h"
 #include "char_t.h"
@@ -25,9 +29,19 @@ static_assert(std::numeric_limits<char8_t>::max() == (char8_t)char(-1),
 
 #include "inner.h"
 #include "basic_string.h"
+#include "count.h"
+#include "indexed_string_view.h"
+#include "checked_chars.h"
+#include "split.h"
+#include "char_set.h"
+#include "multi_searcher.h"
+#include "searcher.h"
 
 #include "is_ascii.h"
 #include "is_utf8.h"
+#include "utf16.h"
+#include "utf32.h"
+#include "mapped_file.h"
 
 #include "to_ascii.h"
 
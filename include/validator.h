@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>  // std::ranges::copy
+
+namespace utf8 {
+
+/// validates a stream chunk by chunk: a char split between chunks waits in `state_t`,
+/// so every byte is checked once and errors are reported with absolute stream offsets
+class validator {
+  state_t _state;
+  size_t _pending = 0;   // bytes of a split char in `_state`
+  size_t _consumed = 0;  // bytes fed so far
+  std::optional<utf8_error> _error;
+
+  auto fail(size_t valid_to, std::optional<size_t> error_len) noexcept {
+    _error = utf8_error(valid_to, error_len);
+    return _error;
+  }
+
+ public:
+  // the first error stays reported for all next chunks
+  auto feed(std::string_view chunk) noexcept -> std::optional<utf8_error> {
+    if (_error) {
+      return _error;
+    }
+
+    size_t pos = 0;
+    if (_pending > 0) {
+      auto start = _consumed - _pending;
+      auto place = std::span<char>(_state);
+      auto width = char_width(place[0]);
+
+      while (_pending < width && pos < chunk.size()) {
+        place[_pending++] = chunk[pos++];
+      }
+      if (auto error = validate({place.data(), _pending}); error && error->error_len) {
+        return fail(start + error->valid_to, error->error_len);
+      }
+      if (_pending < width) {
+        _consumed += chunk.size();
+        return std::nullopt;
+      }
+      _pending = 0;
+    }
+
+    auto rest = chunk.substr(pos);
+    if (auto error = validate(rest)) {
+      if (not error->error_len) {
+        // at most 3 bytes of a char that continues in the next chunk
+        auto tail = rest.substr(error->valid_to);
+        std::ranges::copy(tail, std::span<char>(_state).begin());
+        _pending = tail.size();
+      } else {
+        return fail(_consumed + pos + error->valid_to, error->error_len);
+      }
+    }
+    _consumed += chunk.size();
+    return std::nullopt;
+  }
+
+  // end of the stream: a split char that was never completed is an error
+  auto finish() noexcept -> std::optional<utf8_error> {
+    if (not _error && _pending > 0) {
+      return fail(_consumed - _pending, std::nullopt);
+    }
+    return _error;
+  }
+
+  [[nodiscard]] auto consumed() const noexcept -> size_t {
+    return _consumed;
+  }
+
+  // bytes of the last char that is still waiting for its continuation
+  [[nodiscard]] auto pending() const noexcept -> size_t {
+    return _pending;
+  }
+};
+
+}  // namespace utf8
@@ -2,11 +2,15 @@
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
 #include <utf8.hpp>
 
+#include "text.h"
+
 namespace views = std::views;
 namespace ranges = std::ranges;
 using utf8::char_t;
+using namespace utf8::literals;
 
 TEST(access, push_pop) {
   constexpr utf8::string_view text = R"(
@@ -84,5 +88,112 @@ TEST(access, find_first_last) {
   ASSERT_EQ(2 * len, str.find_first_of("🏽🏽🏾"));
   ASSERT_EQ(len, str.substr(len).find_first_of("🏽🏽🏾"));
   ASSERT_EQ(0, str.substr(len).find_first_not_of("🏽🏽🏾"));
+}
+
+TEST(access, char_set) {
+  constexpr auto N = std::string_view::npos;
+
+  utf8::char_set set("!?ж😋");
+  ASSERT_TRUE(set.contains('?') && set.contains(U'ж') && set.contains(U'😋'));
+  ASSERT_FALSE(set.contains('a') || set.contains(U'з') || set.contains(U'😌'));
+  ASSERT_FALSE(set.is_ascii());
+  ASSERT_TRUE(utf8::char_set("!?#").is_ascii());
+
+  // only a search with a set built beforehand cannot throw
+  utf8::string_view view = "!?";
+  static_assert(noexcept(view.find_first_of(set)) && not noexcept(view.find_first_of(view)));
+
+  static_assert(utf8::string_view("привет, мир").find_first_not_of("тпир") == 6 &&
+                utf8::string_view("привет, мир").find_last_not_of("тпир") == 14 &&
+                utf8::string_view("привет").find_first_of("") == N);
+
+  // a char across the end of the last whole register, the scalar tail must start after it
+  for (size_t len = 0; len < 140; len++) {
+    auto bytes = std::string(len, 'x') + "€,y";
+    auto str = utf8::parse(bytes);
+    ASSERT_EQ(len + 3, str.find_first_of(",")) << len;
+    ASSERT_EQ(len + 3, str.find_first_not_of("x€")) << len;
+    ASSERT_EQ(len, str.find_first_not_of("x")) << len;
+  }
 
-}
\ No newline at end of file
+  // runs longer than the SIMD registers, the sets are checked against a walk over the chars
+  auto text = test::random_text(500, U"aaaaaaaaж😋!", {U"😋😋", U"!ж!"});
+  for (auto chars : {"!"sv, "a"sv, "a!"sv, "!?#ж"sv, "😋"sv, "aж😋!"sv}) {
+    auto set = utf8::char_set(chars);
+    for (size_t from = 0; from < text.size(); from += 7) {
+      if (not text.is_boundary(from)) {
+        continue;
+      }
+      auto str = utf8::string_view(text).substr(from);
+      size_t first_of = N, first_not_of = N, last_of = N, last_not_of = N;
+      for (auto [idx, ch] : str.char_indices()) {
+        auto in = set.contains(ch);
+        auto& first = in ? first_of : first_not_of;
+        first = std::min(first, idx);
+        (in ? last_of : last_not_of) = idx;
+      }
+      ASSERT_EQ(first_of, str.find_first_of(set));
+      ASSERT_EQ(first_not_of, str.find_first_not_of(set));
+      ASSERT_EQ(last_of, str.find_last_of(set));
+      ASSERT_EQ(last_not_of, str.find_last_not_of(set));
+      // and with a set built for the one search
+      ASSERT_EQ(first_of, str.find_first_of(chars));
+      ASSERT_EQ(first_not_of, str.find_first_not_of(chars));
+      ASSERT_EQ(last_of, str.find_last_of(chars));
+      ASSERT_EQ(last_not_of, str.find_last_not_of(chars));
+    }
+  }
+}
+
+TEST(access, indexed) {
+  // the edge puts `a农a` at chars 2..4 and `农` last
+  auto text = test::random_text(600, U"aaaaaж😋农农农", {U"ж😋a农a农"});
+  auto chars = std::vector<char_t>(text.chars().begin(), text.chars().end());
+
+  for (size_t stride : {1, 3, 64, 1000}) {
+    utf8::indexed_string_view indexed(text, stride);
+    ASSERT_EQ(chars.size(), indexed.char_count());
+    ASSERT_FALSE(indexed.is_ascii());
+
+    size_t offset = 0;
+    for (size_t n = 0; n < chars.size(); n++) {
+      ASSERT_EQ(offset, indexed.char_offset(n));
+      ASSERT_EQ(chars[n], indexed.char_at(n));
+      offset += chars[n].size_utf8();
+    }
+    ASSERT_EQ(text.size(), indexed.char_offset(chars.size()));
+    ASSERT_THROW((void)indexed.char_at(chars.size()), std::out_of_range);
+  }
+
+  utf8::indexed_string_view indexed(text);
+  ASSERT_EQ("a农a"sv, indexed.substr_chars(2, 3));
+  ASSERT_EQ("农"sv, indexed.substr_chars(chars.size() - 1));
+  ASSERT_EQ(""sv, indexed.substr_chars(chars.size()));
+
+  utf8::indexed_string_view ascii("plain ascii text");
+  ASSERT_TRUE(ascii.is_ascii());
+  ASSERT_EQ("ascii"sv, ascii.substr_chars(6, 5));
+  ASSERT_EQ(char_t('t'), ascii.char_at(12));
+}
+
+TEST(access, count_chars) {
+  auto text = test::random_text(550, U"aaaaaaaaaaaж😋农", {U"农😋", U"жж"});
+
+  size_t count = 0;
+  for (auto [offset, ch] : text.char_indices()) {
+    ASSERT_EQ(offset, utf8::byte_offset_of_char(text, count));
+    for (size_t byte = offset; byte < offset + ch.size_utf8(); byte++) {
+      ASSERT_EQ(count, utf8::char_index_of_byte(text, byte));
+    }
+    count++;
+  }
+  ASSERT_EQ(count, utf8::count_chars(text));
+  ASSERT_EQ(text.size(), utf8::byte_offset_of_char(text, count));
+  ASSERT_EQ(count, utf8::char_index_of_byte(text, text.size()));
+
+  ASSERT_THROW((void)utf8::byte_offset_of_char(text, count + 1), std::out_of_range);
+  ASSERT_THROW((void)utf8::char_index_of_byte(text, text.size() + 1), std::out_of_range);
+
+  static_assert(utf8::count_chars("农历新年 and a long ascii tail") == 26);
+  static_assert(utf8::byte_offset_of_char("农历新年", 2) == 6);
+}
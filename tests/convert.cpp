@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <iostream>
+#include <random>
+#include <unordered_map>
 #include <utf8.hpp>
 
 using namespace utf8::literals;
@@ -31,6 +33,7 @@ TEST(to_lower, unicode) {
   ASSERT_EQ("🍌"sv, utf8::string(utf8::to_upper(U'🍌')));
 
   ASSERT_EQ("农历新年"sv, utf8::to_lower("农历新年"));
+  ASSERT_EQ("i\u0307stanbul"sv, utf8::to_lower("İSTANBUL"));  // the only expanding lower case
   // ASSERT_EQ("ὀδυσσεύς"sv, utf8::to_lower("ὈΔΥΣΣΕΎΣ")); -- map sigma at the end of word
 }
 
@@ -40,6 +43,7 @@ TEST(to_upper, unicode) {
 
   ASSERT_EQ("农历新年"sv, utf8::to_upper("农历新年"));
   ASSERT_EQ("TSCHÜSS"sv, utf8::to_upper("tschüß"));
+  ASSERT_EQ("OFFICE ΣΟΦΊΑ"sv, utf8::to_upper("oﬃce σοφία"));
 }
 
 TEST(do_lower, ascii) {
@@ -55,3 +59,102 @@ TEST(do_upper, ascii) {
 
   ASSERT_EQ("G0ОDBYE MONKEY 🍌"sv, str);
 }
+
+TEST(do_lower, unicode) {
+  utf8::string str = "Ünïcode ПРИВЕТ ΣΟΦΊΑ 🍌"sv;
+  ASSERT_EQ(utf8::do_lower(str), std::nullopt);
+  ASSERT_EQ("ünïcode привет σοφία 🍌"sv, str);
+
+  // `Ⱥ` takes 2 bytes and `ⱥ` takes 3
+  utf8::string grows = "ПРИВЕТ Ⱥ ПРИВЕТ"sv;
+  ASSERT_EQ(utf8::do_lower(grows), "привет ⱥ привет"sv);
+}
+
+TEST(do_upper, unicode) {
+  utf8::string str = "ünïcode привет σοφία 🍌"sv;
+  ASSERT_EQ(utf8::do_upper(str), std::nullopt);
+  ASSERT_EQ("ÜNÏCODE ПРИВЕТ ΣΟΦΊΑ 🍌"sv, str);
+
+  utf8::string grows = "straße"sv;
+  ASSERT_EQ(utf8::do_upper(grows), "STRASSE"sv);
+
+  // long enough for SIMD on both sides of the expansion
+  auto long_str = utf8::parse_lossy(std::string(100, 'a') + "ß" + std::string(100, 'b'));
+  auto expected = utf8::parse_lossy(std::string(100, 'A') + "SS" + std::string(100, 'B'));
+  ASSERT_EQ(utf8::do_upper(long_str), expected);
+}
+
+static_assert(utf8::eq_icase("Content-Type", "content-type"));
+static_assert(utf8::find_icase("Ab Ǆ Σ", "ǆ σ") == 3);
+
+TEST(icase, simple_folding) {
+  ASSERT_TRUE(utf8::eq_icase("ὈΔΥΣΣΕΎΣ", "ὀδυσσεύς"));
+  ASSERT_TRUE(utf8::eq_icase("\u212A", "k"));  // the Kelvin sign
+  ASSERT_TRUE(utf8::eq_icase("ſ", "S"));
+  ASSERT_FALSE(utf8::eq_icase("tschüß", "TSCHÜSS"));
+  ASSERT_FALSE(utf8::eq_icase("key", "keys"));
+
+  ASSERT_EQ(utf8::compare_icase("apple", "BANANA"), std::weak_ordering::less);
+  ASSERT_EQ(utf8::compare_icase("Straße", "STRASSE"), std::weak_ordering::greater);
+  ASSERT_EQ(utf8::compare_icase("ПРИВЕТ", "привет"), std::weak_ordering::equivalent);
+  ASSERT_EQ(utf8::compare_icase("abc", "ABCD"), std::weak_ordering::less);
+
+  ASSERT_TRUE(utf8::starts_with_icase("X-Forwarded-For: 10.0.0.1", "x-forwarded-for:"));
+  ASSERT_TRUE(utf8::starts_with_icase("\u212Aelvin", "KEL"));
+  ASSERT_FALSE(utf8::starts_with_icase("Kel", "kelvin"));
+
+  ASSERT_EQ(utf8::find_icase("Ünïcödé and \u212Aelvin", "kelVIN"), 16);
+  ASSERT_EQ(utf8::find_icase("abcabc", "BC", 2), 4);
+  ASSERT_EQ(utf8::find_icase("abc", "", 3), 3);
+  ASSERT_EQ(utf8::find_icase("abc", "abcd"), utf8::string_view::npos);
+}
+
+TEST(icase, against_naive) {
+  // the first six are ascii, `ſ` and the Kelvin sign fold into it
+  const char* alphabet[] = {"a", "A", "k", "K", "s", "S", "ſ",
+                            "\u212A", "σ", "Σ", "ς", "-", "ÿ", "Ÿ"};
+  std::mt19937 rng(23);
+  auto random_text = [&](size_t len) {
+    auto letters = len % 2 == 0 ? 6 : std::size(alphabet);
+    std::string out;
+    for (size_t i = 0; i < len; i++) {
+      out += alphabet[rng() % letters];
+    }
+    return out;
+  };
+  auto flip_case = [](std::string str) {
+    for (auto& byte : str) {
+      byte = char(utf8::ascii::is_lower(byte) ? byte - 32 : byte);
+    }
+    return str;
+  };
+
+  for (size_t i = 0; i < 300; i++) {
+    auto str = random_text(i);
+    auto same = flip_case(str);
+    auto text = utf8::string_view(utf8::noexport::unsafe, str);
+    auto copy = utf8::string_view(utf8::noexport::unsafe, same);
+    ASSERT_TRUE(utf8::eq_icase(text, copy));
+    ASSERT_EQ(utf8::icase_hash{}(text), utf8::icase_hash{}(copy));
+
+    auto needle = random_text(rng() % 4 + 1);
+    auto expected = utf8::string_view::npos;
+    for (size_t pos = 0; pos < str.size(); pos += utf8::noexport::thin_decode(str[pos])) {
+      if (utf8::starts_with_icase(text.substr(pos), {utf8::noexport::unsafe, needle})) {
+        expected = pos;
+        break;
+      }
+    }
+    ASSERT_EQ(utf8::find_icase(text, {utf8::noexport::unsafe, needle}), expected);
+  }
+}
+
+TEST(icase, unordered_map) {
+  std::unordered_map<utf8::string, int, utf8::icase_hash, utf8::icase_equal> headers;
+  headers.emplace(utf8::string("Content-Length"), 42);
+  headers.emplace(utf8::string("Accept-Language"), 7);
+
+  ASSERT_EQ(headers.find("content-length"sv)->second, 42);
+  ASSERT_EQ(headers.find("ACCEPT-LANGUAGE"sv)->second, 7);
+  ASSERT_EQ(headers.find("Accept"sv), headers.end());
+}
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
 #include <utf8.hpp>
 
+#include "text.h"
+
 namespace views = std::views;
 namespace ranges = std::ranges;
 using utf8::char_t;
@@ -43,6 +46,56 @@ TEST(chars, non_ascii) {
   ASSERT_EQ(chars.end(), iter);
 }
 
+TEST(chars, decode_into) {
+  // ascii and 2-byte blocks, then the rest
+  utf8::string_view text =
+      "0123456789abcdefабвгдежзийклмноп农历新年 é x 😋😋 0123456789abcdef0123456789abcdef";
+  auto expected = std::vector<char_t>(text.chars().begin(), text.chars().end());
+
+  for (size_t cap = 1; cap < expected.size() + 2; cap++) {
+    std::vector<char_t> place(cap, char_t('\0'));
+    auto [chars, bytes] = text.chars().decode_into(place);
+    ASSERT_EQ(std::min(cap, expected.size()), chars);
+    ASSERT_TRUE(text.is_boundary(bytes));
+    ASSERT_TRUE(ranges::equal(text.substr(0, bytes).chars(), views::take(place, chars)));
+  }
+
+  std::vector<char_t> blocks;
+  for (std::span<const char_t> block : text.chars().blocks<7>()) {
+    ASSERT_LE(block.size(), 7);
+    blocks.insert(blocks.end(), block.begin(), block.end());
+  }
+  ASSERT_EQ(expected, blocks);
+
+  // every width in every place of a register, a block may end inside one of them
+  for (unsigned seed = 1; seed <= 20; seed++) {
+    auto mixed = test::random_text(300, U"aa ж€农😋\U0010FFFF", {}, seed);
+    auto all = std::vector<char_t>(mixed.chars().begin(), mixed.chars().end());
+
+    std::vector<char_t> place(all.size(), char_t('\0'));
+    ASSERT_EQ(all.size(), mixed.chars().decode_into(place).chars);
+    ASSERT_EQ(all, place);
+
+    blocks.clear();
+    for (std::span<const char_t> block : mixed.chars().blocks<20>()) {
+      ASSERT_LE(block.size(), 20);
+      blocks.insert(blocks.end(), block.begin(), block.end());
+    }
+    ASSERT_EQ(all, blocks);
+  }
+}
+
+TEST(chars, table_decoder) {
+  utf8::string_view text = "a é ж € 农 💖 \U0010FFFF \u07FF\u0800\uFFFF\U00010000 z";
+
+  auto table = utf8::basic_chars_view<utf8::table_decoder>(text);
+  ASSERT_TRUE(ranges::equal(text.chars(), table));
+  ASSERT_TRUE(ranges::equal(text.chars() | views::reverse, table | views::reverse));
+
+  static_assert(ranges::equal(utf8::basic_chars_view<utf8::table_decoder>(utf8::string_view("农历")),
+                              utf8::string_view("农历").chars()));
+}
+
 TEST(char_indices, ascii) {
   utf8::string_view word = "goodbye";
 
@@ -122,4 +175,66 @@ TEST(bytes, raw_access) {
   }
 
   ASSERT_EQ("🦀∈🌏"sv, str);
-}
\ No newline at end of file
+}
+
+namespace {
+
+auto pieces(auto view) -> std::vector<std::string_view> {
+  std::vector<std::string_view> out;
+  for (utf8::string_view piece : view) {
+    out.emplace_back(piece);
+  }
+  return out;
+}
+
+using list = std::vector<std::string_view>;
+
+}  // namespace
+
+TEST(split, by_char) {
+  utf8::string_view csv = "a,b,,ü,";
+  ASSERT_EQ((list{"a", "b", "", "ü", ""}), pieces(csv.split(',')));
+  ASSERT_EQ((list{"a,b,,", ","}), pieces(csv.split(char_t(U'ü'))));
+  ASSERT_EQ((list{""}), pieces(""sv.split(',')));
+  ASSERT_EQ((list{"🦀", "🦀"}), pieces("🦀∈🦀"sv.split("∈"c)));
+
+  // delimiters are found by bytes, `¬` (C2 AC) never matches the tail of `€` (E2 82 AC)
+  ASSERT_EQ((list{"€€"}), pieces("€€"sv.split(char_t(U'¬'))));
+}
+
+TEST(split, by_str) {
+  ASSERT_EQ((list{"key", "value", "", "x"}), pieces("key => value =>  => x"sv.split(" => "sv)));
+  ASSERT_EQ((list{"abc"}), pieces("abc"sv.split(""sv)));
+
+  // pieces are borrowed from the string, not from the view
+  utf8::string_view log = "INFO ok\nWARN slow\n";
+  auto first = *log.split("\n"sv).begin();
+  ASSERT_EQ("INFO ok"sv, first);
+  ASSERT_EQ(log.data(), first.data());
+  static_assert(ranges::borrowed_range<decltype(log.split(' '))>);
+}
+
+TEST(split, lines) {
+  ASSERT_EQ((list{"one", "two", "", "three\r"}), pieces("one\ntwo\r\n\r\nthree\r"sv.lines()));
+  ASSERT_EQ((list{"one", ""}), pieces("one\n\n"sv.lines()));
+  ASSERT_TRUE(pieces(""sv.lines()).empty());
+  ASSERT_EQ((list{""}), pieces("\r\n"sv.lines()));
+}
+
+TEST(split, whitespace) {
+  // ascii spaces, a no-break space, an ideographic space and a line separator
+  utf8::string_view text = " \tone  two three　четыре 五\n ";
+  ASSERT_EQ((list{"one", "two", "three", "четыре", "五"}), pieces(text.split_whitespace()));
+  ASSERT_TRUE(pieces(" \r\n "sv.split_whitespace()).empty());
+
+  // long runs go through SIMD, `ぁ` and `‐` share the leads of U+3000 and U+2000
+  std::string big;
+  for (size_t i = 0; i < 100; i++) {
+    big += "ぁ‐Ӂ word ";
+  }
+  auto words = pieces(utf8::string_view(utf8::unsafe, big).split_whitespace());
+  ASSERT_EQ(200, words.size());
+  ASSERT_EQ("ぁ‐Ӂ"sv, words[198]);
+
+  static_assert(ranges::distance("a  b\tc"sv.split_whitespace()) == 3);
+}
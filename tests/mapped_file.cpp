@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <utf8.hpp>
+
+#include <unistd.h>  // getpid
+
+using namespace utf8::literals;
+
+namespace {
+
+// named after the test and the process, so parallel and repeated runs don't share files,
+// and removed even if the test fails
+class temp_file {
+  std::filesystem::path _path;
+
+ public:
+  explicit temp_file(std::string_view content) {
+    auto test = testing::UnitTest::GetInstance()->current_test_info()->name();
+    auto name = "utf8_mapped_" + std::string(test) + "_" + std::to_string(::getpid()) + ".txt";
+    _path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(_path, std::ios::binary) << content;
+  }
+
+  temp_file(const temp_file&) = delete;
+  auto operator=(const temp_file&) -> temp_file& = delete;
+
+  ~temp_file() {
+    std::error_code ignored;
+    std::filesystem::remove(_path, ignored);
+  }
+
+  [[nodiscard]] auto path() const -> const std::filesystem::path& {
+    return _path;
+  }
+};
+
+}  // namespace
+
+TEST(mapped_file, valid) {
+  temp_file temp("Glühwurm 😋");
+  auto& path = temp.path();
+
+  utf8::mapped_file file(path);
+  ASSERT_EQ("Glühwurm 😋"sv, file.view());
+  ASSERT_FALSE(file.repaired());
+
+  // copies share the mapping
+  utf8::string_view view = "";
+  {
+    auto copy = file;
+    view = copy;
+  }
+  ASSERT_TRUE(view.ends_with(utf8::char_t("😋")));
+}
+
+TEST(mapped_file, invalid) {
+  temp_file temp("H\xffl\xff\xff W\xff\xffrl\xf0\x9f!");
+  auto& path = temp.path();
+
+  ASSERT_THROW(utf8::mapped_file{path}, utf8::utf8_error);
+
+  utf8::mapped_file file(path, utf8::lossy);
+  ASSERT_TRUE(file.repaired());
+  ASSERT_EQ(utf8::parse_lossy("H\xffl\xff\xff W\xff\xffrl\xf0\x9f!"), file.view());
+
+  // the file itself is untouched
+  ASSERT_THROW(utf8::mapped_file{path}, utf8::utf8_error);
+}
+
+TEST(mapped_file, repaired_in_place) {
+  temp_file temp("ok \xF0\x9F\x98 ok");
+
+  utf8::mapped_file file(temp.path(), utf8::lossy);
+  ASSERT_EQ("ok � ok"sv, file.view());
+}
+
+TEST(mapped_file, empty_and_missing) {
+  std::filesystem::path path;
+  {
+    temp_file temp("");
+    path = temp.path();
+    ASSERT_EQ(0, utf8::mapped_file(path).size());
+  }
+
+  ASSERT_THROW(utf8::mapped_file{path}, std::system_error);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <utf8.hpp>
+
+#include "text.h"
+
+namespace ranges = std::ranges;
+using utf8::char_t;
+using namespace utf8::literals;
+
+namespace {
+
+auto all_matches(const utf8::multi_searcher& searcher, utf8::string_view haystack)
+    -> std::vector<utf8::multi_match> {
+  std::vector<utf8::multi_match> out;
+  for (auto match : searcher.matches(haystack)) {
+    out.push_back(match);
+  }
+  return out;
+}
+
+// every occurrence of every pattern, ordered by the end and the longer one first
+auto naive_matches(const std::vector<std::string>& patterns, std::string_view haystack)
+    -> std::vector<utf8::multi_match> {
+  std::vector<utf8::multi_match> out;
+  for (size_t id = 0; id < patterns.size(); id++) {
+    if (patterns[id].empty()) {
+      continue;
+    }
+    for (auto pos = haystack.find(patterns[id]); pos != haystack.npos;
+         pos = haystack.find(patterns[id], pos + 1)) {
+      out.push_back({id, pos});
+    }
+  }
+  ranges::sort(out, {}, [&](auto match) {
+    auto len = patterns[match.pattern].size();
+    return std::tuple(match.pos + len, -len, match.pattern);
+  });
+  return out;
+}
+
+}  // namespace
+
+TEST(multi_searcher, overlapping) {
+  utf8::multi_searcher searcher{"he", "she", "his", "hers"};
+  ASSERT_EQ((std::vector<utf8::multi_match>{{1, 1}, {0, 2}, {3, 2}}),
+            all_matches(searcher, "ushers"));
+
+  // matches never split a char, though `ж` and `з` share the lead byte
+  utf8::multi_searcher cyrillic{"жж", "з", "ж"};
+  ASSERT_EQ((std::vector<utf8::multi_match>{{2, 0}, {0, 0}, {2, 2}, {1, 4}}),
+            all_matches(cyrillic, "жжз"));
+
+  ASSERT_TRUE(all_matches(utf8::multi_searcher{""}, "abc").empty());
+  ASSERT_TRUE(all_matches(searcher, "").empty());
+}
+
+TEST(multi_searcher, against_naive) {
+  std::string text =
+      test::random_text(6000, U"aaaabbbb ж😋农€", {U"😋ab", U"ж ж", U"农€b", U"€农农"});
+  auto haystack = utf8::string_view(utf8::unsafe, text);
+
+  // up to 8 patterns are searched with Teddy, which fingerprints the last bytes of each pattern,
+  // as many as there are in the shortest one (up to 3), more patterns go to the automaton
+  std::vector<std::string> one_byte = {"ab", "😋ab", "bab", "ж", "a", "", "ab"};
+  std::vector<std::string> two_bytes = {"ж", "ab", "b ж", "😋ab", "жж", "€"};
+  std::vector<std::string> three_bytes = {"农", "€", "bab", "a农", "😋", "农€b", "ж ж", "€农农"};
+  std::vector<std::string> many = one_byte;
+  for (int i = 0; i < 40; i++) {
+    many.push_back(std::string(i % 4 + 1, i % 2 ? 'a' : 'b') + (i % 3 ? "ж" : " "));
+  }
+  auto valid = [](auto& str) { return utf8::string_view(utf8::unsafe, str); };
+  for (auto& patterns : {one_byte, two_bytes, three_bytes, many}) {
+    auto searcher = utf8::multi_searcher(patterns | std::views::transform(valid));
+    for (size_t cut : {text.size(), text.size() - 33, size_t(61), size_t(2)}) {
+      while (not haystack.is_boundary(cut)) {
+        cut--;
+      }
+      ASSERT_EQ(naive_matches(patterns, text.substr(0, cut)),
+                all_matches(searcher, haystack.substr(0, cut)))
+          << patterns.front() << " " << cut;
+    }
+  }
+}
+
+TEST(searcher, find_rfind) {
+  constexpr utf8::string_view text = "жёлтый, жёлудь, жёлтый";
+  static_assert(text.find(utf8::searcher("жёлтый")) == 0 &&
+                text.rfind(utf8::searcher("жёлтый")) == 28 &&
+                text.find(utf8::searcher("")) == 0 && text.rfind(utf8::searcher("")) == 40);
+  ASSERT_TRUE(text.contains(utf8::searcher("лудь")));
+  ASSERT_FALSE(text.contains(utf8::searcher("лудьж")));
+  ASSERT_EQ("лудь"sv, utf8::searcher("лудь").needle());
+
+  // the first byte is rare at the start and common later
+  auto sparse = std::string(5000, 'x') + std::string(3000, 'a') + "ab";
+  ASSERT_EQ(sparse.size() - 2, utf8::string_view(utf8::unsafe, sparse).find(utf8::searcher("ab")));
+}
+
+TEST(searcher, against_std) {
+  std::string text = test::random_text(3500, U"aaabbb ж😋", {U"жё"});
+  auto haystack = utf8::string_view(utf8::unsafe, text);
+
+  // short needles go through SIMD, long ones through Horspool
+  for (size_t len : {1, 2, 3, 8, 40, 100, 256, 257, 400}) {
+    for (size_t from = 0; from + len <= text.size(); from += 331) {
+      auto needle = std::string_view(text).substr(from, len);
+      if (not haystack.is_boundary(from) || not haystack.is_boundary(from + len)) {
+        continue;
+      }
+      for (auto tail : {"", "ж"}) {
+        auto full = std::string(needle) + tail;
+        auto search = utf8::searcher(utf8::string_view(utf8::unsafe, full));
+        for (size_t cut : {text.size(), text.size() - 70, size_t(150)}) {
+          while (not haystack.is_boundary(cut)) {
+            cut--;
+          }
+          auto part = haystack.substr(0, cut);
+          auto std_part = std::string_view(text).substr(0, cut);
+          ASSERT_EQ(std_part.find(full), part.find(search)) << len << " " << from;
+          ASSERT_EQ(std_part.rfind(full), part.rfind(search)) << len << " " << from;
+        }
+      }
+    }
+  }
+}
+
+TEST(find_char, every_width) {
+  constexpr utf8::string_view log = "12:00│init·ok、12:01│ready·ok、";
+  static_assert(log.find(char_t(U'│')) == 5 && log.rfind(char_t(U'│')) == 24 &&
+                log.count(char_t(U'、')) == 2 && log.count(char_t('1')) == 3);
+
+  std::string text = test::random_text(2500, U"aaaabbbb│││·、😋", {U"、、", U"·│"});
+  auto haystack = utf8::string_view(utf8::unsafe, text);
+
+  for (auto ch : {char_t('b'), char_t(U'·'), char_t(U'、'), char_t(U'│'), char_t(U'😋'),
+                  char_t(U'ж')}) {
+    char place[4] = {};
+    auto bytes = std::string_view(ch.encode_utf8(std::span(place)));
+    for (size_t cut : {text.size(), text.size() - 100, size_t(70), size_t(0)}) {
+      while (not haystack.is_boundary(cut)) {
+        cut--;
+      }
+      auto part = std::string_view(text).substr(0, cut);
+      std::vector<size_t> expected;
+      for (auto pos = part.find(bytes); pos != part.npos; pos = part.find(bytes, pos + 1)) {
+        expected.push_back(pos);
+      }
+      auto str = haystack.substr(0, cut);
+      ASSERT_EQ(part.find(bytes), str.find(ch));
+      ASSERT_EQ(part.rfind(bytes), str.rfind(ch));
+      ASSERT_EQ(expected.size(), str.count(ch));
+      auto all = str.find_all(ch);
+      ASSERT_EQ(expected, std::vector<size_t>(all.begin(), all.end()));
+    }
+  }
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <utf8.hpp>
+
+namespace ranges = std::ranges;
+using namespace utf8::literals;
+
+namespace {
+
+auto graphemes(utf8::string_view str) -> std::vector<std::string_view> {
+  std::vector<std::string_view> out;
+  for (auto cluster : str.graphemes()) {
+    out.emplace_back(cluster);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(graphemes, combining) {
+  // `y̆` is two chars, but a single grapheme
+  utf8::string_view text = "y̆es";
+  ASSERT_EQ(4, ranges::distance(text.chars()));
+  ASSERT_EQ((std::vector<std::string_view>{"y̆", "e", "s"}), graphemes(text));
+
+  ASSERT_EQ((std::vector<std::string_view>{"a", "\r\n", "\r\n", "\n", "b"}),
+            graphemes("a\r\n\r\n\nb"));
+}
+
+TEST(graphemes, emoji_and_flags) {
+  // family: man ZWJ woman ZWJ girl, then a skin tone modifier (Extend)
+  utf8::string_view family = "\U0001F468‍\U0001F469‍\U0001F467";
+  utf8::string_view thumbs = "\U0001F44D\U0001F3FD";
+  ASSERT_EQ(1, utf8::count_graphemes(family));
+  ASSERT_EQ(1, utf8::count_graphemes(thumbs));
+
+  // ZWJ joins pictographs only
+  ASSERT_EQ(2, utf8::count_graphemes("a‍\U0001F467"));
+
+  // regional indicators pair up: 🇺🇦🇯🇵 and a lone 🇫
+  utf8::string_view flags = "\U0001F1FA\U0001F1E6\U0001F1EF\U0001F1F5\U0001F1EB";
+  ASSERT_EQ((std::vector<std::string_view>{"\U0001F1FA\U0001F1E6", "\U0001F1EF\U0001F1F5",
+                                           "\U0001F1EB"}),
+            graphemes(flags));
+}
+
+TEST(graphemes, hangul_and_marks) {
+  // jamo L V T form one syllable, LV + T too
+  ASSERT_EQ(1, utf8::count_graphemes("각"));
+  ASSERT_EQ(1, utf8::count_graphemes("각"));
+  ASSERT_EQ(2, utf8::count_graphemes("ᆨᄀ"));
+
+  // Devanagari `कि` - a spacing mark, Arabic prepend `؀` before a letter
+  ASSERT_EQ(1, utf8::count_graphemes("कि"));
+  ASSERT_EQ(1, utf8::count_graphemes("؀a"));
+}
+
+TEST(graphemes, truncate) {
+  utf8::string_view text = "éé \U0001F468‍\U0001F469 ok";
+  ASSERT_EQ("é"sv, utf8::truncate_graphemes(text, 1));
+  ASSERT_EQ("éé \U0001F468‍\U0001F469"sv, utf8::truncate_graphemes(text, 4));
+  ASSERT_EQ(text, utf8::truncate_graphemes(text, 100));
+  ASSERT_EQ(""sv, utf8::truncate_graphemes(text, 0));
+
+  // an ascii char keeps the combining mark that follows it
+  ASSERT_EQ("abć"sv, utf8::truncate_graphemes("abćd", 3));
+
+  static_assert(utf8::count_graphemes("y̆ \U0001F1FA\U0001F1E6") == 3);
+}
+
+TEST(graphemes, matches_view) {
+  utf8::string text = "mixed: Ｓ́ \r\nab\r\n\n\U0001F44D\U0001F3FD 한국어 किष 🇺🇦!"sv;
+  for (size_t repeat = 0; repeat < 4; repeat++) {
+    text += text;
+  }
+  ASSERT_EQ(size_t(ranges::distance(text.graphemes())), utf8::count_graphemes(text));
+
+  std::string joined;
+  for (auto cluster : text.graphemes()) {
+    auto prefix = utf8::string_view(utf8::unsafe, joined);
+    ASSERT_EQ(prefix, utf8::truncate_graphemes(text, utf8::count_graphemes(prefix)));
+    joined += std::string_view(cluster);
+  }
+  ASSERT_EQ(std::string_view(text), joined);
+}
+
+namespace {
+
+template <typename View>
+auto segments(View view) -> std::vector<std::string_view> {
+  std::vector<std::string_view> out;
+  for (auto segment : view) {
+    out.emplace_back(segment);
+  }
+  return out;
+}
+
+auto line_breaks(utf8::string_view str) -> std::vector<std::pair<size_t, bool>> {
+  std::vector<std::pair<size_t, bool>> out;
+  for (auto [pos, mandatory] : str.line_break_opportunities()) {
+    out.emplace_back(pos, mandatory);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(words, boundaries) {
+  using list = std::vector<std::string_view>;
+  ASSERT_EQ((list{"The", " ", "quick", " ", "(", "\"", "brown", "\"", ")", " ", "fox", " ",
+                  "can't", " ", "jump", " ", "32.3", " ", "feet", ",", " ", "right", "?"}),
+            segments("The quick (\"brown\") fox can't jump 32.3 feet, right?"sv.words()));
+
+  // letters keep their marks, the apostrophe stays between letters only
+  ASSERT_EQ((list{"Ｓ́tudent's", "'", " ", "e", "-", "mail", ":", " ", "ŝ"}),
+            segments("Ｓ́tudent's' e-mail: ŝ"sv.words()));
+
+  // katakana runs, ideographs one by one, numbers with separators joined to identifiers
+  ASSERT_EQ((list{"カタカナ", "漢", "字", "1,000.5_foo_bar"}),
+            segments("カタカナ漢字1,000.5_foo_bar"sv.words()));
+
+  // emoji sequences and flags
+  utf8::string_view emoji = "\U0001F468‍\U0001F469\U0001F1FA\U0001F1E6\U0001F1EF\U0001F1F5\r\n";
+  ASSERT_EQ(
+      (list{"\U0001F468‍\U0001F469", "\U0001F1FA\U0001F1E6", "\U0001F1EF\U0001F1F5", "\r\n"}),
+      segments(emoji.words()));
+  ASSERT_TRUE(segments(""sv.words()).empty());
+}
+
+TEST(sentences, boundaries) {
+  using list = std::vector<std::string_view>;
+  ASSERT_EQ((list{"He said \"Hi.\" ", "Then he left!\r\n", "OK"}),
+            segments("He said \"Hi.\" Then he left!\r\nOK"sv.sentences()));
+
+  // an ATerm before a lowercase word, a number or an uppercase letter right after it
+  ASSERT_EQ((list{"Mr. smith arrived at 3.30 p.m. ", "U.S.A. is big."}),
+            segments("Mr. smith arrived at 3.30 p.m. U.S.A. is big."sv.sentences()));
+
+  ASSERT_EQ((list{"Что? ", "Да. ", "日本語。", "はい"}),
+            segments("Что? Да. 日本語。はい"sv.sentences()));
+}
+
+TEST(line_break, opportunities) {
+  using list = std::vector<std::pair<size_t, bool>>;
+  // after spaces and hyphens, mandatory after a line break and at the end
+  ASSERT_EQ((list{{4, false}, {9, false}, {16, true}, {19, true}}),
+            line_breaks("one well-known\r\nend"));
+
+  // never before closing punctuation or inside a number
+  ASSERT_EQ((list{{4, false}, {8, false}, {17, false}, {20, true}}),
+            line_breaks("see (p. 1,234.5) now"));
+
+  // a currency sign keeps any opening bracket, wide ones too
+  ASSERT_EQ((list{{5, true}}), line_breaks("$（a"));
+  ASSERT_EQ((list{{3, true}}), line_breaks("$(a"));
+
+  // ideographs break between each other, but not before `。`
+  ASSERT_EQ((list{{3, false}, {9, false}, {12, true}}), line_breaks("漢字。か"));
+
+  // a no-break space glues words, a zero width space splits them
+  ASSERT_EQ((list{{10, true}}), line_breaks("a\u00A0b\u00A0c\u00A0d"));
+  ASSERT_EQ((list{{4, false}, {5, true}}), line_breaks("a\u200Bb"));
+  ASSERT_TRUE(line_breaks("").empty());
+}
+
+TEST(segments, constexpr) {
+  static_assert(std::ranges::distance("a b."sv.words()) == 4);
+  static_assert(std::ranges::distance("A b. C d."sv.sentences()) == 2);
+  static_assert(std::ranges::distance("one two"sv.line_break_opportunities()) == 2);
+}
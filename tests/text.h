@@ -0,0 +1,49 @@
+#pragma once
+
+#include <random>
+#include <string_view>
+#include <utf8.hpp>
+
+namespace test {
+
+/// `len` random chars drawn from `alphabet` (repeat a char to make it more frequent),
+/// the `edges` are placed at the start, at the end and in turn across every 32-byte boundary,
+/// so that they also straddle the SIMD blocks; the same `seed` always gives the same text
+/// (valid text only, tests of invalid bytes or of UTF-16 build their own inputs)
+inline auto random_text(size_t len, std::u32string_view alphabet,
+                        std::initializer_list<std::u32string_view> edges = {},
+                        unsigned seed = 1) -> utf8::string {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+
+  utf8::string text;
+  auto append = [&](std::u32string_view chars) {
+    for (auto ch : chars) {
+      text.push_back(*utf8::char_t::from(ch));
+    }
+  };
+
+  auto edge = edges.begin();
+  auto next_edge = [&] {
+    append(*edge);
+    if (++edge == edges.end()) {
+      edge = edges.begin();
+    }
+  };
+
+  if (edges.size() != 0) {
+    next_edge();
+  }
+  for (size_t i = 0; i < len; i++) {
+    if (edges.size() != 0 && text.size() % 32 >= 30) {
+      next_edge();
+    }
+    append(alphabet.substr(pick(rng), 1));
+  }
+  if (edges.size() != 0) {
+    next_edge();
+  }
+  return text;
+}
+
+}  // namespace test
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utf8.hpp>
+
+using namespace utf8::literals;
+using utf8::char_t;
+
+namespace {
+
+// the same text in UTF-16 and UTF-8
+auto random_text(std::mt19937& rng, size_t len) -> std::pair<std::u16string, std::string> {
+  constexpr std::pair<std::u16string_view, std::string_view> pieces[] = {
+      {u"a", "a"}, {u" ", " "}, {u"é", "é"},   {u"ж", "ж"},
+      {u"€", "€"}, {u"农", "农"}, {u"💖", "💖"}, {u"\U0010FFFF", "\U0010FFFF"}};
+
+  std::pair<std::u16string, std::string> out;
+  // mostly short chars, so that whole blocks of them are common
+  std::uniform_int_distribution<size_t> piece(0, std::size(pieces) - 1);
+  std::bernoulli_distribution short_only(0.5);
+  auto limit = short_only(rng) ? 4 : std::size(pieces);
+  while (out.first.size() < len) {
+    auto [utf16, utf8] = pieces[piece(rng) % limit];
+    out.first.append(utf16);
+    out.second.append(utf8);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(utf16, round_trip) {
+  std::mt19937 rng(17);
+  for (size_t i = 0; i < 2000; i++) {
+    auto [text, expected] = random_text(rng, i % 100);
+    auto str = utf8::from_utf16(text);
+    ASSERT_EQ(expected, std::string_view(str));
+    ASSERT_EQ(utf8::utf8_length_from_utf16(text), str.size());
+    ASSERT_EQ(utf8::utf16_length_from_utf8(str), text.size());
+    ASSERT_EQ(text, utf8::to_utf16(str));
+  }
+
+  // every block kind: ascii, 2-byte only, BMP and pairs
+  auto text = std::u16string(u"0123456789abcdefабвгдежзийклмно农历新年快乐农历😋😋😋😋 tail");
+  ASSERT_EQ("0123456789abcdefабвгдежзийклмно农历新年快乐农历😋😋😋😋 tail"sv,
+            std::string_view(utf8::from_utf16(text)));
+  ASSERT_EQ(text, utf8::to_utf16("0123456789abcdefабвгдежзийклмно农历新年快乐农历😋😋😋😋 tail"));
+
+  static_assert(utf8::utf16_length_from_utf8("a😋") == 3);
+  static_assert(utf8::utf8_length_from_utf16(u"a😋") == 5);
+}
+
+TEST(utf16, block_kinds) {
+  // runs of one kind of text, so that every SIMD block kind is met at every offset and length
+  constexpr std::u16string_view alphabets[] = {
+      u"café",         // ascii and 2-byte chars
+      u"农历新年快乐",  // 3-byte chars only
+      u"农历 新年, 快乐",  // 3-byte chars and ascii
+      u"aé农",          // every BMP width
+      u"aé农a😋",       // and a rare pair
+  };
+
+  std::mt19937 rng(29);
+  for (auto alphabet : alphabets) {
+    std::uniform_int_distribution<size_t> piece(0, alphabet.size() - 1);
+    for (size_t len = 0; len < 80; len++) {
+      std::u16string text;
+      std::string expected;
+      while (text.size() < len) {
+        auto unit = alphabet[piece(rng)];
+        if (utf8::noexport::is_high_surrogate(unit)) {
+          text += u"😋";
+          expected += "😋";
+        } else if (not utf8::noexport::is_low_surrogate(unit)) {
+          text += unit;
+          char place[4];
+          expected.append(place, utf8::noexport::encode_utf8_unchecked(unit, place));
+        }
+      }
+
+      // exact buffers, so that writing past them is caught by the sanitizers
+      std::vector<char> bytes(utf8::utf8_length_from_utf16(text));
+      ASSERT_EQ(bytes.data() + bytes.size(), utf8::from_utf16(text, bytes.data()));
+      ASSERT_EQ(expected, std::string_view(bytes.data(), bytes.size()));
+      auto str = utf8::parse(expected);
+
+      std::vector<char16_t> units(utf8::utf16_length_from_utf8(str));
+      ASSERT_EQ(units.data() + units.size(), utf8::to_utf16(str, units.data()));
+      ASSERT_EQ(text, std::u16string_view(units.data(), units.size()));
+
+      std::vector<char_t> chars(utf8::utf32_length_from_utf8(str), char_t('\0'));
+      ASSERT_EQ(chars.size(), utf8::decode_all(str, chars).size());
+      ASSERT_TRUE(std::ranges::equal(str.chars(), chars));
+
+      std::vector<char> encoded(bytes.size());
+      ASSERT_EQ(encoded.data() + encoded.size(), utf8::encode_all(chars, encoded.data()));
+      ASSERT_EQ(bytes, encoded);
+    }
+  }
+}
+
+TEST(utf16, surrogates) {
+  std::u16string text = u"0123456789" u"\xD83D" u"ab" u"\xDE0B";
+  ASSERT_EQ(10, utf8::validate_utf16(text)->valid_to);
+
+  try {
+    (void)utf8::from_utf16(text);
+    FAIL();
+  } catch (utf8::utf16_error& err) {
+    ASSERT_EQ(10, err.valid_to);
+  }
+
+  auto lossy = utf8::from_utf16_lossy(text);
+  ASSERT_EQ("0123456789�ab�"sv, std::string_view(lossy));
+  ASSERT_EQ(utf8::utf8_length_from_utf16(text), lossy.size());
+
+  ASSERT_FALSE(utf8::validate_utf16(u"😋"));
+  ASSERT_TRUE(utf8::validate_utf16(std::u16string(1, u'\xDE0B')));
+}
+
+TEST(utf16, into_buffer) {
+  std::u16string_view text = u"Glühwurm 😋";
+  std::array<char, 16> place{};
+  auto end = utf8::from_utf16(text, place.data());
+  ASSERT_EQ("Glühwurm 😋"sv, std::string_view(place.data(), end));
+
+  std::array<char16_t, 16> units{};
+  auto units_end = utf8::to_utf16("Glühwurm 😋", units.data());
+  ASSERT_EQ(text, std::u16string_view(units.data(), units_end));
+}
+
+TEST(utf32, round_trip) {
+  std::mt19937 rng(19);
+  for (size_t i = 0; i < 2000; i++) {
+    auto [_, text] = random_text(rng, i % 100);
+    auto str = utf8::parse(text);
+
+    std::vector<char_t> chars(str.chars().begin(), str.chars().end());
+    ASSERT_EQ(chars.size(), utf8::utf32_length_from_utf8(str));
+    ASSERT_EQ(text.size(), utf8::utf8_length_from_utf32(chars));
+    ASSERT_EQ(text, std::string_view(utf8::encode_all(chars)));
+
+    std::vector<char_t> place(text.size(), char_t('\0'));
+    ASSERT_TRUE(std::ranges::equal(chars, utf8::decode_all(str, place)));
+  }
+}
+
+TEST(utf32, errors) {
+  std::vector<char_t> chars(20, char_t('a'));
+  chars[11] = char_t(utf8::unsafe, 0xD800);
+  ASSERT_THROW((void)utf8::encode_all(chars), std::logic_error);
+  chars[11] = char_t(utf8::unsafe, 0x110000);
+  ASSERT_THROW((void)utf8::encode_all(chars), std::logic_error);
+
+  std::vector<char_t> place(2, char_t('\0'));
+  ASSERT_THROW((void)utf8::decode_all("农历新年", place), std::logic_error);
+  ASSERT_EQ(2, utf8::decode_all("农历", place).size());
+}
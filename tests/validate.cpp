@@ -0,0 +1,354 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <utf8.hpp>
+
+using namespace utf8::literals;
+using utf8::char_t;
+namespace simd = utf8::noexport::simd;
+
+namespace {
+
+auto random_text(std::mt19937& rng, size_t len, double noise) -> std::string {
+  constexpr std::string_view pieces[] = {"a", "z", " ", "é", "ж", "€", "农", "💖", "\U0010FFFF"};
+
+  std::string out;
+  std::bernoulli_distribution is_noise(noise);
+  std::uniform_int_distribution<size_t> piece(0, std::size(pieces) - 1);
+  std::uniform_int_distribution<int> byte(0x80, 0xFF);
+  while (out.size() < len) {
+    if (is_noise(rng)) {
+      out.push_back(char(byte(rng)));
+    } else {
+      out.append(pieces[piece(rng)]);
+    }
+  }
+  return out;
+}
+
+auto same(const std::optional<utf8::utf8_error>& a, const std::optional<utf8::utf8_error>& b) {
+  if (a && b) {
+    return a->valid_to == b->valid_to && a->error_len == b->error_len;
+  }
+  return a.has_value() == b.has_value();
+}
+
+// well-formed second bytes of a 3- or 4-byte char by its lead, as in Table 3-7 of the Unicode
+// Standard
+auto second_ok(int lead, int next) -> bool {
+  if (lead == 0xE0) {
+    return next >= 0xA0 && next <= 0xBF;
+  }
+  if (lead == 0xED || lead == 0xF4) {
+    return next >= 0x80 && next <= (lead == 0xED ? 0x9F : 0x8F);
+  }
+  if (lead == 0xF0) {
+    return next >= 0x90 && next <= 0xBF;
+  }
+  return next >= 0x80 && next <= 0xBF;
+}
+
+}  // namespace
+
+TEST(validate, matches_scalar) {
+  std::mt19937 rng(42);
+  for (auto noise : {0.0, 0.001, 0.01, 0.2}) {
+    for (size_t i = 0; i < 2000; i++) {
+      auto text = random_text(rng, i % 300, noise);
+      ASSERT_TRUE(same(utf8::noexport::validate_scalar(text), utf8::validate(text))) << text;
+    }
+  }
+}
+
+TEST(validate, pairs_across_blocks) {
+  auto text = std::string(130, 'a');
+  for (size_t at : {0, 61, 62, 63, 64, 126, 128}) {
+    for (int a = 0x80; a < 0x100; a++) {
+      for (int b = 0; b < 0x100; b++) {
+        auto place = text;
+        place[at] = char(a);
+        place[at + 1] = char(b);
+        ASSERT_TRUE(same(utf8::noexport::validate_scalar(place), utf8::validate(place)));
+      }
+    }
+  }
+}
+
+TEST(validate, three_byte_leads_across_threshold) {
+  // short inputs never reach the SIMD kernels, long ones go through them block by block
+  for (size_t len : {3, 8, 63, 64, 65, 127, 257, 300}) {
+    for (size_t at : {size_t(0), (len - 3) / 2, len - 3}) {
+      for (int lead = 0xE0; lead <= 0xEF; lead++) {
+        for (int next = 0; next < 0x100; next++) {
+          auto text = std::string(len, 'a');
+          text[at] = char(lead);
+          text[at + 1] = char(next);
+          text[at + 2] = '\x80';
+
+          auto error = utf8::validate(text);
+          ASSERT_TRUE(same(utf8::noexport::validate_scalar(text), error)) << len << " " << at;
+          ASSERT_EQ(second_ok(lead, next), not error) << std::hex << lead << " " << next;
+          ASSERT_EQ(not error, utf8::is_utf8(text));
+        }
+      }
+    }
+  }
+}
+
+TEST(validate, ascii_words) {
+  for (size_t at = 0; at < 40; at++) {
+    auto text = std::string(48, 'w');
+    text[at] = '\xff';
+
+    auto error = utf8::noexport::validate_scalar(text);
+    ASSERT_TRUE(error);
+    ASSERT_EQ(at, error->valid_to);
+  }
+
+  // word-at-a-time skip also runs in constant evaluation
+  static_assert(not utf8::validate("a rather long literal: 0123456789abcdef, then 农历新年 and tail"));
+  static_assert(utf8::noexport::skip_ascii("0123456789abcdefé", 0) == 16);
+}
+
+#ifdef _UTF8_SIMD_X86
+TEST(validate, every_kernel) {
+  struct kernels {
+    decltype(&simd::sse42::validate_prefix) validate_prefix;
+    decltype(&simd::sse42::is_valid) is_valid;
+    decltype(&simd::sse42::skip_leads) skip_leads;
+  };
+
+  std::vector<kernels> isa;
+  switch (simd::best()) {
+    case simd::isa::avx512:
+      isa.push_back(
+          {simd::avx512::validate_prefix, simd::avx512::is_valid, simd::avx512::skip_leads});
+      [[fallthrough]];
+    case simd::isa::avx2:
+      isa.push_back(
+          {simd::avx2::validate_prefix, simd::avx2::is_valid, simd::avx2::skip_leads});
+      [[fallthrough]];
+    case simd::isa::sse42:
+      isa.push_back(
+          {simd::sse42::validate_prefix, simd::sse42::is_valid, simd::sse42::skip_leads});
+      [[fallthrough]];
+    default:
+      break;
+  }
+
+  std::mt19937 rng(7);
+  for (auto [validate_prefix, is_valid, skip_leads] : isa) {
+    for (size_t i = 0; i < 5000; i++) {
+      auto text = random_text(rng, i % 400, i % 2 ? 0.0 : 0.005);
+      auto prefix = validate_prefix(text.data(), text.size());
+      auto error = utf8::noexport::validate_scalar(text);
+
+      if (error) {
+        // stops at the block where the error was seen
+        ASSERT_LE(prefix, error->valid_to + 4);
+      } else {
+        ASSERT_EQ(text.size() / simd::BLOCK * simd::BLOCK, prefix);
+      }
+      ASSERT_EQ(not error, is_valid(text.data(), text.size()));
+
+      auto [bytes, leads] = skip_leads(text.data(), text.size(), SIZE_MAX);
+      ASSERT_EQ(text.size() / simd::BLOCK * simd::BLOCK, bytes);
+      ASSERT_EQ(utf8::noexport::count_leads(std::string_view(text).substr(0, bytes)), leads);
+    }
+  }
+}
+#endif
+
+TEST(validate, chunked) {
+  std::mt19937 rng(3);
+  for (size_t i = 0; i < 500; i++) {
+    auto text = random_text(rng, i % 100, i % 3 ? 0.0 : 0.02);
+    auto expected = utf8::validate(text);
+
+    for (size_t a = 0; a <= text.size(); a++) {
+      for (size_t b = a; b <= text.size(); b += 3) {
+        utf8::validator stream;
+        stream.feed(std::string_view(text).substr(0, a));
+        stream.feed(std::string_view(text).substr(a, b - a));
+        stream.feed(std::string_view(text).substr(b));
+        ASSERT_TRUE(same(expected, stream.finish())) << text << " split at " << a << ", " << b;
+      }
+    }
+  }
+}
+
+TEST(validate, chunk_keeps_split_char) {
+  utf8::validator stream;
+
+  ASSERT_FALSE(stream.feed("ab\xF0\x9F"));
+  ASSERT_EQ(2, stream.pending());
+  ASSERT_FALSE(stream.feed("\x92"));
+  ASSERT_FALSE(stream.feed("\x96!"));
+  ASSERT_EQ(0, stream.pending());
+
+  auto error = stream.feed("\xE2\x28");
+  ASSERT_TRUE(error);
+  ASSERT_EQ(7, error->valid_to);
+  ASSERT_EQ(1, error->error_len);
+}
+
+TEST(validate, threads) {
+  std::mt19937 rng(11);
+  auto text = random_text(rng, 8 << 20, 0.0);
+  ASSERT_FALSE(utf8::validate(text, 4));
+  ASSERT_FALSE(utf8::validate(text, 0));
+
+  // errors around the places where the text is split between threads
+  for (size_t threads : {2, 3, 8}) {
+    for (auto at : {text.size() / threads, text.size() / threads * (threads - 1)}) {
+      for (auto offset : {-3, -1, 0, 1, 2}) {
+        for (auto bad : {"\xff", "\xF0\x9F", "\x80\x80", "\xE2\x28"}) {
+          auto place = text;
+          place.replace(at + offset, std::strlen(bad), bad);
+          ASSERT_TRUE(same(utf8::validate(place), utf8::validate(place, threads)))
+              << threads << " " << at + offset << " " << bad;
+        }
+      }
+    }
+  }
+}
+
+TEST(is_utf8, matches_validate) {
+  std::mt19937 rng(5);
+  for (auto noise : {0.0, 0.001, 0.05}) {
+    for (size_t i = 0; i < 3000; i++) {
+      auto text = random_text(rng, i % 300, noise);
+      ASSERT_EQ(not utf8::validate(text), utf8::is_utf8(text)) << text;
+    }
+  }
+
+  static_assert(utf8::is_utf8("农历新年"));
+  ASSERT_FALSE(utf8::is_utf8(std::string(100, 'a') + "\xF0\x9F"));
+  ASSERT_TRUE(utf8::is_utf8(std::u8string_view(u8"💖💖💖")));
+  ASSERT_FALSE(utf8::is_utf8(std::as_bytes(std::span("\xC0\x80", 2))));
+}
+
+TEST(validate, parse) {
+  constexpr auto text = "H\xffl\xff\xff W\xff\xffrl\xf0\x9f!";
+
+  try {
+    utf8::parse(text);
+    FAIL();
+  } catch (utf8::utf8_error& err) {
+    ASSERT_EQ(1, err.valid_to);
+    ASSERT_EQ(1, err.error_len);
+  }
+
+  auto padded = std::string(64, 'x') + "Hello";
+  ASSERT_EQ("Hello"sv, utf8::parse(padded).substr(64));
+}
+
+TEST(parse_lossy, variants) {
+  std::mt19937 rng(13);
+  for (auto noise : {0.0, 0.01, 0.3}) {
+    for (size_t i = 0; i < 1000; i++) {
+      auto text = random_text(rng, i % 200, noise);
+      auto expected = utf8::parse_lossy(text);
+
+      std::string out(text.size() * 3, '\0');
+      auto end = utf8::parse_lossy(text, out.data());
+      ASSERT_EQ(std::string_view(expected), std::string_view(out.data(), end)) << text;
+
+      ASSERT_EQ(expected, utf8::parse_lossy_in_place(std::string(text))) << text;
+    }
+  }
+}
+
+TEST(parse_lossy, in_place) {
+  // U+FFFD (3 bytes) fits in place of `\xF0\x9F\x98` but not of `\xff`
+  std::string fits = std::string(32, 'a') + "\xF0\x9F\x98 b \xF0\x9F\x98";
+  auto buffer = fits.data();
+
+  auto repaired = utf8::parse_lossy_in_place(std::move(fits));
+  ASSERT_EQ(std::string(32, 'a') + "\uFFFD b \uFFFD", std::string_view(repaired));
+  ASSERT_EQ(buffer, repaired.data());
+
+  ASSERT_EQ("a\uFFFDb"sv, utf8::parse_lossy_in_place("a\xff" "b"));
+
+  // stray bytes grow the string once, a buffer with room for them is kept
+  std::string stray = "\xff" + std::string(32, 'a') + "\xC3 b \xF0\x9F\x98\xff\xE2\x82";
+  stray.reserve(stray.size() * 3);
+  buffer = stray.data();
+
+  repaired = utf8::parse_lossy_in_place(std::move(stray));
+  ASSERT_EQ("\uFFFD" + std::string(32, 'a') + "\uFFFD b \uFFFD\uFFFD\uFFFD",
+            std::string_view(repaired));
+  ASSERT_EQ(buffer, repaired.data());
+}
+
+TEST(validate, second_byte_bounds) {
+  ASSERT_FALSE(utf8::noexport::validate_scalar("\uE000\uF000\uF7FF"));
+
+  // a bad second byte is not a part of the invalid sequence
+  ASSERT_EQ("�a"sv, utf8::parse_lossy("\xF0" "a"));
+  ASSERT_EQ("��"sv, utf8::parse_lossy("\xF4\x90"));
+}
+
+TEST(validate, bad_second_byte_is_one_byte_long) {
+  for (size_t len : {8, 100}) {
+    for (int lead = 0xE0; lead <= 0xF4; lead++) {
+      for (int next = 0; next < 0x100; next++) {
+        if (second_ok(lead, next)) {
+          continue;
+        }
+        auto text = std::string(len, 'a');
+        text[2] = char(lead);
+        text[3] = char(next);
+        text[4] = text[5] = '\x80';
+
+        // only the lead is invalid, `next` starts the next sequence
+        auto error = utf8::validate(text);
+        ASSERT_TRUE(error) << std::hex << lead << " " << next;
+        ASSERT_EQ(2, error->valid_to);
+        ASSERT_EQ(1, error->error_len) << std::hex << lead << " " << next;
+        ASSERT_TRUE(same(utf8::noexport::validate_scalar(text), error));
+      }
+      auto lossy = utf8::parse_lossy(std::string{'x', char(lead), 'y'});
+      ASSERT_EQ("x\uFFFDy"sv, lossy) << std::hex << lead;
+    }
+  }
+}
+
+TEST(chars_lossy, matches_parse_lossy) {
+  std::mt19937 rng(23);
+  for (auto noise : {0.0, 0.01, 0.3}) {
+    for (size_t i = 0; i < 1000; i++) {
+      auto text = random_text(rng, i % 200, noise);
+      auto expected = utf8::parse_lossy(text);
+      ASSERT_TRUE(std::ranges::equal(expected.chars(), utf8::chars_lossy(text))) << text;
+
+      std::vector<char_t> chars;
+      std::optional<utf8::utf8_error> error;
+      for (auto ch : utf8::try_chars(text)) {
+        if (ch) {
+          chars.push_back(*ch);
+        } else {
+          error = ch.error();
+        }
+      }
+      ASSERT_TRUE(same(utf8::validate(text), error)) << text;
+
+      auto valid = error ? text.substr(0, error->valid_to) : text;
+      ASSERT_TRUE(std::ranges::equal(utf8::parse(valid).chars(), chars)) << text;
+    }
+  }
+}
+
+TEST(chars_lossy, truncated) {
+  auto lossy = utf8::chars_lossy("ok\xF0\x9F\x98");
+  ASSERT_EQ(3, std::ranges::distance(lossy));
+  ASSERT_EQ(char_t("�"), *std::ranges::next(lossy.begin(), 2));
+
+  auto tried = utf8::try_chars("ok\xE2\x82");
+  auto error = std::ranges::next(tried.begin(), 2);
+  ASSERT_FALSE(*error);
+  ASSERT_EQ(2, (*error).error().valid_to);
+  ASSERT_EQ(std::nullopt, (*error).error().error_len);
+  ASSERT_EQ(tried.end(), std::next(error));
+}
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+"""Generates the Unicode tables of include/unicode from the Unicode Character Database.
+
+    python3 tools/unicode_tables.py
+
+rewrites include/unicode/properties.h, the case mapping tables of
+include/unicode/conversions.h and `char_t::unicode_version` in place. The data is read through
+Perl's Unicode::UCD, which ships with Perl, so the UCD version is the one of the Perl in use and
+must match `UCD_VERSION`.
+"""
+
+import pathlib
+import re
+import subprocess
+
+UCD_VERSION = '14.0.0'
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+CODES = 0x110000
+
+
+def perl(script, *args):
+    return subprocess.run(['perl', '-MUnicode::UCD=prop_invmap,prop_invlist', '-e', script, *args],
+                          capture_output=True, text=True, check=True).stdout
+
+
+def ranges(prop):
+    """(start, end, value) of every range of `prop`, a multi-char value is a list of codes"""
+    out = perl('my ($list, $map) = prop_invmap(shift);'
+               'for my $i (0 .. $#$list) {'
+               '  my $v = $map->[$i]; $v = join(",", @$v) if ref $v; print "$list->[$i]\\t$v\\n";'
+               '}', prop)
+    rows = [line.split('\t') for line in out.strip().split('\n')]
+    for i, (start, value) in enumerate(rows):
+        end = int(rows[i + 1][0]) if i + 1 < len(rows) else CODES
+        yield int(start), end, value
+
+
+def invmap(prop):
+    values = [None] * CODES
+    for start, end, value in ranges(prop):
+        values[start:end] = [value] * (end - start)
+    return values
+
+
+def invlist(prop):
+    inv = [int(x) for x in perl('print join(",", prop_invlist(shift))', prop).split(',')]
+    inv += [CODES] if len(inv) % 2 else []
+    return {code for i in range(0, len(inv), 2) for code in range(inv[i], inv[i + 1])}
+
+
+def mappings(prop):
+    """the codes every code maps to by a case property of format `al`, unmapped codes are omitted"""
+    out = {}
+    for start, end, value in ranges(prop):
+        for code in range(start, end):
+            if ',' in value:
+                out[code] = [int(x) for x in value.split(',')]
+            elif value != '0':
+                # a range maps its codes to consecutive ones
+                out[code] = [int(value) + code - start]
+    return {code: to for code, to in out.items() if to != [code]}
+
+
+LOW, MID = 4, 5
+
+
+def two_stage(values, shift):
+    size = 1 << shift
+    blocks, index = {}, []
+    for start in range(0, len(values), size):
+        block = tuple(values[start:start + size])
+        index.append(blocks.setdefault(block, len(blocks)))
+    return index, list(blocks)
+
+
+def trie(ids):
+    """the stages of `property_trie`: blocks of 16 values, rows of 32 blocks, equal ones shared"""
+    idx, blocks = two_stage(ids, LOW)
+    rows_idx, rows = two_stage(idx, MID)
+    assert len(blocks) <= 65536 and len(rows) <= 256
+    return rows_idx, [x for r in rows for x in r], [x for b in blocks for x in b]
+
+
+def array(name, data, typ='std::uint8_t', per_line=16):
+    out = [f'constexpr {typ} {name}[] = {{']
+    for i in range(0, len(data), per_line):
+        out.append('    ' + ', '.join(str(x) for x in data[i:i + per_line]) + ',')
+    out.append('};')
+    return '\n'.join(out)
+
+
+def trie_arrays(prefix, ids, scope=''):
+    rows_idx, rows, blocks = trie(ids)
+    size = len(rows_idx) + 2 * len(rows) + len(blocks)
+    return size, [array(f'{prefix}_ROWS', rows_idx), '',
+                  array(f'{prefix}_BLOCKS', rows, 'std::uint16_t'), '',
+                  array(f'{prefix}_VALUES', blocks), '',
+                  f'constexpr auto {prefix} = {scope}property_trie'
+                  f'{{{prefix}_ROWS, {prefix}_BLOCKS, {prefix}_VALUES}};']
+
+
+def snake(name):
+    return re.sub(r'(?<=[a-z])(?=[A-Z])', '_', name).lower()
+
+
+def table(prefix, enum, doc, values, order, rename={}):
+    values = [rename.get(v, v) for v in values]
+    unknown = set(values) - set(order)
+    assert not unknown, unknown
+    size, arrays = trie_arrays(prefix, [order.index(v) for v in values])
+    arrays[-1] += f'  // {size} bytes'
+    enum_values = ''.join(f'\n  {snake(v)},' for v in order)
+    return '\n'.join([f'// {doc}', f'enum class {enum} : std::uint8_t {{{enum_values}\n}};', '',
+                      *arrays])
+
+
+def deltas(prefix, doc, mapped):
+    diffs = [mapped.get(code, [code])[0] - code for code in range(CODES)]
+    order = [0] + sorted(set(diffs) - {0})
+    assert len(order) <= 256
+    index = {d: i for i, d in enumerate(order)}
+    size, arrays = trie_arrays(prefix, [index[d] for d in diffs])
+    arrays[-1] += f'  // {size + 4 * len(order)} bytes'
+    return '\n'.join([f'// {doc}', array(f'{prefix}_DELTAS', order, 'std::int32_t', 12), '',
+                      *arrays])
+
+
+HEADER = f'''#pragma once
+
+// generated by tools/unicode_tables.py from the Unicode Character Database {UCD_VERSION},
+// do not edit by hand
+namespace utf8::noexport::unicode {{
+
+// a byte-sized property of every code in three stages: `code >> 9` selects a row of 32 blocks,
+// a block holds the property of 16 codes, equal rows and blocks are stored once
+struct property_trie {{
+  std::span<const std::uint8_t> rows;
+  std::span<const std::uint16_t> blocks;
+  std::span<const std::uint8_t> values;
+
+  [[nodiscard]] constexpr auto operator[](std::uint32_t code) const noexcept -> std::uint8_t {{
+    auto block = blocks[rows[code >> 9] * 32 + (code >> 4 & 31)];
+    return values[block * 16 + (code & 15)];
+  }}
+}};
+'''
+
+GCB = ['Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend',
+       'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT', 'Extended_Pictographic']
+
+WB = ['Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator', 'Format', 'Katakana',
+      'Hebrew_Letter', 'ALetter', 'Single_Quote', 'Double_Quote', 'MidNumLet', 'MidLetter',
+      'MidNum', 'Numeric', 'ExtendNumLet', 'WSegSpace', 'Extended_Pictographic',
+      'ALetter_Extended_Pictographic']
+
+SB = ['Other', 'CR', 'LF', 'Extend', 'Sep', 'Format', 'Sp', 'Lower', 'Upper', 'OLetter',
+      'Numeric', 'ATerm', 'SContinue', 'STerm', 'Close']
+
+LB = ['BK', 'CR', 'LF', 'NL', 'SP', 'ZW', 'ZWJ', 'CM', 'WJ', 'GL', 'BA', 'HY', 'BB', 'B2', 'CB',
+      'CL', 'CP', 'OP', 'OP_Wide', 'QU', 'EX', 'IS', 'SY', 'NS', 'IN', 'NU', 'PR', 'PO', 'AL', 'HL',
+      'ID', 'ID_Pictographic', 'EB', 'EM', 'H2', 'H3', 'JL', 'JV', 'JT', 'RI']
+
+
+def word_breaks():
+    # Perl merges WSegSpace with other horizontal spaces, those are Other in the standard
+    spaces = invlist('WB=WSegSpace')
+    return [v if v != 'Perl_Tailored_HSpace' else 'WSegSpace' if code in spaces else 'Other'
+            for code, v in enumerate(invmap('WB'))]
+
+
+def line_breaks():
+    gc, ea, gcb = invmap('Gc'), invmap('Ea'), invmap('GCB')
+    values = []
+    for code, v in enumerate(invmap('Lb')):
+        # LB1: resolve the classes without rules of their own
+        if v in ('AI', 'SG', 'Unknown'):
+            v = 'AL'
+        elif v == 'SA':
+            v = 'CM' if gc[code] in ('Mn', 'Mc') else 'AL'
+        elif v == 'CJ':
+            v = 'NS'
+        # LB30 excludes east asian brackets, LB30b needs unassigned pictographs
+        if v == 'OP' and ea[code] in ('F', 'W', 'H'):
+            v = 'OP_Wide'
+        if v == 'ID' and gcb[code] == 'ExtPict_XX' and gc[code] == 'Cn':
+            v = 'ID_Pictographic'
+        values.append(v)
+    return values
+
+
+def properties():
+    fold = mappings('Simple_Case_Folding')
+    into_ascii = ', '.join(hex(code) for code, to in sorted(fold.items())
+                           if code >= 0x80 and to[0] < 0x80)
+    return '\n'.join([
+        HEADER,
+        table('GCB', 'gcb', 'Grapheme_Cluster_Break, with Extended_Pictographic as one more value',
+              invmap('GCB'), GCB, {'ExtPict_XX': 'Extended_Pictographic'}),
+        table('WB', 'wb',
+              'Word_Break, with Extended_Pictographic as one more value (or two for ALetter ones)',
+              word_breaks(), WB, {'ExtPict_XX': 'Extended_Pictographic',
+                                  'ExtPict_LE': 'ALetter_Extended_Pictographic'}),
+        table('SB', 'sb', 'Sentence_Break', invmap('SB'), SB),
+        table('LB', 'lb',
+              'Line_Break after LB1, with wide OP and unassigned pictographic ID split out',
+              line_breaks(), LB),
+        deltas('FOLD', 'Simple_Case_Folding as an index into `FOLD_DELTAS`, '
+                       'the difference to the folded code', fold),
+        '\n// the only chars out of ascii that fold into it',
+        f'constexpr char32_t FOLD_INTO_ASCII[] = {{{into_ascii}}};',
+        '\n}  // namespace utf8::noexport::unicode\n'])
+
+
+EXPANDS = 255
+
+
+def literal(code):
+    if code < 0x80:
+        return "'\\''" if chr(code) == "'" else repr(chr(code))
+    return f"u'\\u{code:04x}'" if code < 0x10000 else f"U'\\U{code:08x}'"
+
+
+def case_table(prefix, prop):
+    mapped = mappings(prop)
+    singles = {code: to[0] - code for code, to in mapped.items() if len(to) == 1}
+    order = [0] + sorted(set(singles.values()) - {0})
+    assert len(order) < EXPANDS
+    index = {d: i for i, d in enumerate(order)}
+    ids = [0] * CODES
+    for code, delta in singles.items():
+        ids[code] = index[delta]
+    expands = sorted(code for code, to in mapped.items() if len(to) > 1)
+    for code in expands:
+        ids[code] = EXPANDS
+    size, arrays = trie_arrays(prefix, ids, 'unicode::')
+    side = [f'    {{{literal(code)}, {{{", ".join(literal(c) for c in mapped[code])}}}}},'
+            for code in expands]
+    return '\n'.join([
+        f'// {prop}, {size + 4 * len(order)} bytes',
+        array(f'{prefix}_DELTAS', order, 'std::int32_t', 12), '', *arrays, '',
+        f'constexpr auto {prefix}_EXPANSIONS = std::to_array<std::pair<char_t, str_t>>({{',
+        *side, '});', ''])
+
+
+CASES_BEGIN = '// generated by tools/unicode_tables.py'
+CASES_END = '// the mapping of a char as a delta from the trie'
+
+
+def conversions(src):
+    begin, end = src.index(CASES_BEGIN), src.index(CASES_END)
+    return src[:begin] + '\n'.join([
+        f'{CASES_BEGIN} from the Unicode Character Database {UCD_VERSION},',
+        '// everything down to `convert`, do not edit by hand', '',
+        '// case mappings as an index into the deltas to the mapped code, or `EXPANDS` for the'
+        ' few chars',
+        '// that map to more than one, those are in a side table',
+        f'constexpr std::uint8_t EXPANDS = {EXPANDS};', '',
+        case_table('LOWER', 'Lowercase_Mapping'),
+        case_table('UPPER', 'Uppercase_Mapping'), '']) + src[end:]
+
+
+def char_t_version(src):
+    """`char_t::unicode_version` names the UCD the tables come from"""
+    numbers = ', '.join(UCD_VERSION.split('.'))
+    return re.sub(r'(unicode_version = std::array<std::uint8_t, 3>)\{[^}]*\}', rf'\1{{{numbers}}}',
+                  src)
+
+
+def main():
+    version = perl('print Unicode::UCD::UnicodeVersion()')
+    assert version == UCD_VERSION, f'Perl has the UCD {version}, the tables are {UCD_VERSION}'
+
+    (ROOT / 'include/unicode/properties.h').write_text(properties())
+    path = ROOT / 'include/unicode/conversions.h'
+    path.write_text(conversions(path.read_text()))
+    path = ROOT / 'include/char_t.h'
+    path.write_text(char_t_version(path.read_text()))
+
+
+if __name__ == '__main__':
+    main()